@@ -27,12 +27,19 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <utility>
 #include <unistd.h>
 
+#include "builder/BuilderArrow.h"
+#include "builder/BuilderAvro.h"
 #include "builder/BuilderJson.h"
+#include "common/Compressor.h"
 #include "common/Ctx.h"
+#include "common/MemoryGovernor.h"
 #include "common/MemoryManager.h"
+#include "common/SwapPolicyCost.h"
+#include "common/SwapPolicyOrder.h"
 #include "common/exception/ConfigurationException.h"
 #include "common/exception/RuntimeException.h"
 #include "common/metrics/Metrics.h"
+#include "common/table/SysCol.h"
 #include "common/table/SysObj.h"
 #include "common/table/SysUser.h"
 #include "common/types/Types.h"
@@ -118,6 +125,11 @@ namespace OpenLogReplicator {
             delete locales;
         localess.clear();
 
+        // 清理内存调节线程
+        for (MemoryGovernor* memoryGovernor: memoryGovernors)
+            delete memoryGovernor;
+        memoryGovernors.clear();
+
         // 清理内存管理器
         for (MemoryManager* memoryManager: memoryManagers)
             delete memoryManager;
@@ -225,7 +237,7 @@ namespace OpenLogReplicator {
             if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                 static const std::vector<std::string> sourceNames {"alias", "memory", "name", "reader", "flags", "state", "debug", "transaction-max-mb",
                                                                    "metrics", "format", "redo-read-sleep-us", "arch-read-sleep-us", "arch-read-tries",
-                                                                   "redo-verify-delay-us", "refresh-interval-us", "arch", "filter"};
+                                                                   "redo-verify-delay-us", "refresh-interval-us", "arch", "filter", "flush-threads"};
                 Ctx::checkJsonFields(configFileName, sourceJson, sourceNames);
             }
 
@@ -239,16 +251,23 @@ namespace OpenLogReplicator {
             uint64_t memorySwapMb = memoryMaxMb * 3 / 4;
             std::string memorySwapPath{"."};
             uint64_t memoryUnswapBufferMinMb = 4;
+            uint64_t memoryUnswapPrefetchMb = 0;
+            uint64_t memoryOrphanedLobMaxMb = 0;
+            uint64_t memorySwapReadThreads = 2;
+            std::string memorySwapPolicy{"cost"};
             uint64_t memoryWriteBufferMaxMb = memoryMaxMb;
             uint64_t memoryWriteBufferMinMb = 4;
+            uint64_t memoryRebalanceIntervalMs = 0;
 
             // MEMORY
             if (sourceJson.HasMember("memory")) {
                 const rapidjson::Value& memoryJson = Ctx::getJsonFieldO(configFileName, sourceJson, "memory");
 
                 if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
-                    static const std::vector<std::string> memoryNames {"min-mb", "max-mb", "read-buffer-max-mb", "read-buffer-min-mb", "swap-mb", "swap-path",
-                                                                       "unswap-buffer-min-mb", "write-buffer-max-mb", "write-buffer-min-mb"};
+                    static const std::vector<std::string> memoryNames {"huge-pages", "min-mb", "max-mb", "numa-local", "orphaned-lob-max-mb",
+                                                                       "read-buffer-max-mb", "read-buffer-min-mb", "rebalance-interval-ms", "swap-mb",
+                                                                       "swap-path", "swap-policy", "swap-read-threads", "unswap-buffer-min-mb",
+                                                                       "unswap-prefetch-mb", "write-buffer-max-mb", "write-buffer-min-mb"};
                     Ctx::checkJsonFields(configFileName, memoryJson, memoryNames);
                 }
 
@@ -338,6 +357,75 @@ namespace OpenLogReplicator {
                 if (memoryJson.HasMember("swap-path") && memorySwapMb > 0)
                     memorySwapPath = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, memoryJson, "swap-path");
 
+                if (memoryJson.HasMember("swap-policy")) {
+                    memorySwapPolicy = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, memoryJson, "swap-policy");
+                    if (memorySwapPolicy != "cost" && memorySwapPolicy != "order")
+                        throw ConfigurationException(30001, R"(bad JSON, invalid "swap-policy" value: ")" + memorySwapPolicy +
+                                                            R"(", expected: one of {"cost", "order"})");
+                }
+
+                if (memoryJson.HasMember("swap-read-threads")) {
+                    memorySwapReadThreads = Ctx::getJsonFieldU64(configFileName, memoryJson, "swap-read-threads");
+                    if (memorySwapReadThreads < 1 || memorySwapReadThreads > MemoryManager::SWAP_READ_THREADS_MAX)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"swap-read-threads\" value: " + std::to_string(memorySwapReadThreads) +
+                                                            ", expected: one of {1 .. " + std::to_string(MemoryManager::SWAP_READ_THREADS_MAX) + "}");
+                }
+
+                if (memoryJson.HasMember("unswap-prefetch-mb")) {
+                    memoryUnswapPrefetchMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "unswap-prefetch-mb");
+                    memoryUnswapPrefetchMb = (memoryUnswapPrefetchMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                    if (memoryUnswapPrefetchMb < Ctx::MEMORY_CHUNK_SIZE_MB ||
+                            memoryUnswapPrefetchMb > std::max<uint64_t>(memoryUnswapBufferMinMb, Ctx::MEMORY_CHUNK_SIZE_MB))
+                        throw ConfigurationException(30001, "bad JSON, invalid \"unswap-prefetch-mb\" value: " +
+                                                            std::to_string(memoryUnswapPrefetchMb) + ", expected: at least " +
+                                                            std::to_string(Ctx::MEMORY_CHUNK_SIZE_MB) + " and not greater than \"unswap-buffer-min-mb\" value (" +
+                                                            std::to_string(memoryUnswapBufferMinMb) + ")");
+                }
+
+                if (memoryJson.HasMember("orphaned-lob-max-mb")) {
+                    memoryOrphanedLobMaxMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "orphaned-lob-max-mb");
+                    memoryOrphanedLobMaxMb = (memoryOrphanedLobMaxMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                    // The last chunk is kept for new pages, so at least two are needed
+                    if (memoryOrphanedLobMaxMb < 2 * Ctx::MEMORY_CHUNK_SIZE_MB || memoryOrphanedLobMaxMb > memoryMaxMb)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"orphaned-lob-max-mb\" value: " +
+                                                            std::to_string(memoryOrphanedLobMaxMb) + ", expected: at least " +
+                                                            std::to_string(2 * Ctx::MEMORY_CHUNK_SIZE_MB) + " and not greater than \"max-mb\" value (" +
+                                                            std::to_string(memoryMaxMb) + ")");
+                }
+
+                if (memoryJson.HasMember("rebalance-interval-ms")) {
+                    memoryRebalanceIntervalMs = Ctx::getJsonFieldU64(configFileName, memoryJson, "rebalance-interval-ms");
+                    if (memoryRebalanceIntervalMs != 0 && (memoryRebalanceIntervalMs < MemoryGovernor::REBALANCE_INTERVAL_MIN_MS ||
+                            memoryRebalanceIntervalMs > MemoryGovernor::REBALANCE_INTERVAL_MAX_MS))
+                        throw ConfigurationException(30001, "bad JSON, invalid \"rebalance-interval-ms\" value: " +
+                                                            std::to_string(memoryRebalanceIntervalMs) + ", expected: 0 or one of {" +
+                                                            std::to_string(MemoryGovernor::REBALANCE_INTERVAL_MIN_MS) + " .. " +
+                                                            std::to_string(MemoryGovernor::REBALANCE_INTERVAL_MAX_MS) + "}");
+                }
+
+                if (memoryJson.HasMember("huge-pages")) {
+                    const std::string hugePages = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, memoryJson, "huge-pages");
+                    if (hugePages == "none")
+                        ctx->memoryHugePages = Ctx::MEMORY_HUGE_PAGES::NONE;
+                    else if (hugePages == "transparent")
+                        ctx->memoryHugePages = Ctx::MEMORY_HUGE_PAGES::TRANSPARENT;
+                    else if (hugePages == "2mb")
+                        ctx->memoryHugePages = Ctx::MEMORY_HUGE_PAGES::HUGETLB_2MB;
+                    else if (hugePages == "1gb")
+                        ctx->memoryHugePages = Ctx::MEMORY_HUGE_PAGES::HUGETLB_1GB;
+                    else
+                        throw ConfigurationException(30001, R"(bad JSON, invalid "huge-pages" value: ")" + hugePages +
+                                                            R"(", expected: one of {"none", "transparent", "2mb", "1gb"})");
+                }
+
+                if (memoryJson.HasMember("numa-local")) {
+                    const uint64_t numaLocal = Ctx::getJsonFieldU64(configFileName, memoryJson, "numa-local");
+                    if (numaLocal > 1)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"numa-local\" value: " + std::to_string(numaLocal) +
+                                                            ", expected: one of {0, 1}");
+                    ctx->memoryNumaLocal = (numaLocal == 1);
+                }
+
                 if (memoryUnswapBufferMinMb + memoryReadBufferMinMb + memoryWriteBufferMinMb + 4 > memoryMaxMb)
                     throw ConfigurationException(30001, R"(bad JSON, invalid "unswap-buffer-min-mb" + "read-buffer-min-mb" + "write-buffer-min-mb" + 4 ()" +
                                                         std::to_string(memoryUnswapBufferMinMb) + " + " + std::to_string(memoryReadBufferMinMb) +
@@ -480,6 +568,9 @@ namespace OpenLogReplicator {
             // MEMORY MANAGER
             ctx->initialize(memoryMinMb, memoryMaxMb, memoryReadBufferMaxMb, memoryReadBufferMinMb, memorySwapMb, memoryUnswapBufferMinMb,
                             memoryWriteBufferMaxMb, memoryWriteBufferMinMb);
+            if (memoryOrphanedLobMaxMb == 0)
+                memoryOrphanedLobMaxMb = std::max<uint64_t>(memoryMaxMb / 4, 2 * Ctx::MEMORY_CHUNK_SIZE_MB);
+            ctx->memoryChunksOrphanedLobsMax = memoryOrphanedLobMaxMb / Ctx::MEMORY_CHUNK_SIZE_MB;
 
             // METADATA
             auto* metadata = new Metadata(ctx, locales, name, conId, startScn, startSequence, startTime, startTimeRel);
@@ -505,13 +596,36 @@ namespace OpenLogReplicator {
             ctx->spawnThread(checkpoint);
 
             // MEMORY MANAGER
-            auto* memoryManager = new MemoryManager(ctx, alias + "-memory-manager", memorySwapPath);
+            if (memoryUnswapPrefetchMb == 0)
+                memoryUnswapPrefetchMb = std::max<uint64_t>(memoryUnswapBufferMinMb, Ctx::MEMORY_CHUNK_SIZE_MB);
+            SwapPolicy* swapPolicy;
+            if (memorySwapPolicy == "order")
+                swapPolicy = new SwapPolicyOrder(ctx);
+            else
+                swapPolicy = new SwapPolicyCost(ctx);
+            auto* memoryManager = new MemoryManager(ctx, alias + "-memory-manager", memorySwapPath, memorySwapReadThreads,
+                                                    memoryUnswapPrefetchMb / Ctx::MEMORY_CHUNK_SIZE_MB, swapPolicy);
             memoryManager->initialize();
             memoryManagers.push_back(memoryManager);
             ctx->spawnThread(memoryManager);
 
+            // MEMORY GOVERNOR
+            if (memoryRebalanceIntervalMs > 0) {
+                auto* memoryGovernor = new MemoryGovernor(ctx, alias + "-memory-governor", memoryRebalanceIntervalMs);
+                memoryGovernor->initialize();
+                memoryGovernors.push_back(memoryGovernor);
+                ctx->spawnThread(memoryGovernor);
+            }
+
             // TRANSACTION BUFFER
-            auto* transactionBuffer = new TransactionBuffer(ctx);
+            uint64_t flushThreads = 0;
+            if (sourceJson.HasMember("flush-threads")) {
+                flushThreads = Ctx::getJsonFieldU64(configFileName, sourceJson, "flush-threads");
+                if (flushThreads > TransactionBuffer::FLUSH_THREADS_MAX)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"flush-threads\" value: " + std::to_string(flushThreads) +
+                                                        ", expected: one of {0 .. " + std::to_string(TransactionBuffer::FLUSH_THREADS_MAX) + "}");
+            }
+            auto* transactionBuffer = new TransactionBuffer(ctx, alias, flushThreads);
             transactionBuffers.push_back(transactionBuffer);
 
             // METRICS
@@ -566,7 +680,9 @@ namespace OpenLogReplicator {
             if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                 static const std::vector<std::string> formatNames {"db", "attributes", "interval-dts", "interval-ytm", "message", "rid", "xid", "timestamp",
                                                                    "timestamp-tz", "timestamp-all", "char", "scn", "scn-type", "unknown", "schema", "column",
-                                                                   "unknown-type", "flush-buffer", "type"};
+                                                                   "unknown-type", "flush-buffer", "stream-transaction-mb", "lob-stream-mb", "arrow-batch-rows",
+                                                                   "arrow-batch-mb", "arrow-batch-latency-us", "avro-registry", "pack-bytes",
+                                                                   "pack-latency-us", "type"};
                 Ctx::checkJsonFields(configFileName, formatJson, formatNames);
             }
 
@@ -723,6 +839,69 @@ namespace OpenLogReplicator {
             if (formatJson.HasMember("flush-buffer"))
                 flushBuffer = Ctx::getJsonFieldU64(configFileName, formatJson, "flush-buffer");
 
+            uint64_t streamTransactionMb = 0;
+            if (formatJson.HasMember("stream-transaction-mb")) {
+                streamTransactionMb = Ctx::getJsonFieldU64(configFileName, formatJson, "stream-transaction-mb");
+                if (streamTransactionMb > 0 && (static_cast<uint>(messageFormat) & static_cast<uint>(Format::MESSAGE_FORMAT::SKIP_COMMIT)) != 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"stream-transaction-mb\" value: " + std::to_string(streamTransactionMb) +
+                                                        ", expected: 0 when commit messages are skipped");
+            }
+
+            uint64_t lobStreamMb = 0;
+            if (formatJson.HasMember("lob-stream-mb")) {
+                lobStreamMb = Ctx::getJsonFieldU64(configFileName, formatJson, "lob-stream-mb");
+                if (lobStreamMb > 0 && (static_cast<uint>(messageFormat) & static_cast<uint>(Format::MESSAGE_FORMAT::FULL)) != 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"lob-stream-mb\" value: " + std::to_string(lobStreamMb) +
+                                                        ", expected: 0 when full transaction message format is used");
+            }
+
+            uint64_t arrowBatchRows = 65536;
+            if (formatJson.HasMember("arrow-batch-rows")) {
+                arrowBatchRows = Ctx::getJsonFieldU64(configFileName, formatJson, "arrow-batch-rows");
+                if (arrowBatchRows < 1 || arrowBatchRows > 1000000000)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"arrow-batch-rows\" value: " + std::to_string(arrowBatchRows) +
+                                                        ", expected: one of {1 .. 1000000000}");
+            }
+
+            uint64_t arrowBatchMb = 16;
+            if (formatJson.HasMember("arrow-batch-mb")) {
+                arrowBatchMb = Ctx::getJsonFieldU64(configFileName, formatJson, "arrow-batch-mb");
+                if (arrowBatchMb < 1 || arrowBatchMb > 1024)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"arrow-batch-mb\" value: " + std::to_string(arrowBatchMb) +
+                                                        ", expected: one of {1 .. 1024}");
+            }
+
+            uint64_t arrowBatchLatencyUs = 1000000;
+            if (formatJson.HasMember("arrow-batch-latency-us")) {
+                arrowBatchLatencyUs = Ctx::getJsonFieldU64(configFileName, formatJson, "arrow-batch-latency-us");
+                if (arrowBatchLatencyUs > 3600000000)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"arrow-batch-latency-us\" value: " + std::to_string(arrowBatchLatencyUs) +
+                                                        ", expected: one of {0 .. 3600000000}");
+            }
+
+            uint64_t packBytes = 0;
+            if (formatJson.HasMember("pack-bytes")) {
+                packBytes = Ctx::getJsonFieldU64(configFileName, formatJson, "pack-bytes");
+                if (packBytes > 1073741824)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"pack-bytes\" value: " + std::to_string(packBytes) +
+                                                        ", expected: one of {0 .. 1073741824}");
+                if (packBytes > 0 && (static_cast<uint>(messageFormat) & static_cast<uint>(Format::MESSAGE_FORMAT::FULL)) == 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"pack-bytes\" value: " + std::to_string(packBytes) +
+                                                        ", expected: 0 when full transaction message format is not used");
+                // Flush threads publish every transaction separately
+                if (packBytes > 0 && flushThreads > 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"pack-bytes\" value: " + std::to_string(packBytes) +
+                                                        ", expected: 0 when \"flush-threads\" is used");
+            }
+
+            uint64_t packLatencyUs = 10000;
+            if (formatJson.HasMember("pack-latency-us")) {
+                packLatencyUs = Ctx::getJsonFieldU64(configFileName, formatJson, "pack-latency-us");
+                if (packLatencyUs > 3600000000)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"pack-latency-us\" value: " + std::to_string(packLatencyUs) +
+                                                        ", expected: one of {0 .. 3600000000}");
+            }
+
             const std::string formatType = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, formatJson, "type");
 
             Builder* builder;
@@ -732,13 +911,49 @@ namespace OpenLogReplicator {
                 builder = new BuilderJson(ctx, locales, metadata, format, flushBuffer);
             } else if (formatType == "protobuf") {
 #ifdef LINK_LIBRARY_PROTOBUF
+                // Concatenated protobuf messages are merged by the parser, so transactions can't be packed
+                if (packBytes > 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
+                                                        ", expected: not \"protobuf\" when \"pack-bytes\" is used");
                 builder = new BuilderProtobuf(ctx, locales, metadata, format, flushBuffer);
 #else
                 throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
                                              ", expected: not \"protobuf\" since the code is not compiled");
 #endif /* LINK_LIBRARY_PROTOBUF */
+            } else if (formatType == "arrow") {
+                // Rows are kept in record batches until a bound is reached, so they are never sent partially
+                if (streamTransactionMb > 0 || lobStreamMb > 0 || packBytes > 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
+                                                        ", expected: not \"arrow\" when \"stream-transaction-mb\", \"lob-stream-mb\" or \"pack-bytes\" is used");
+                if (ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
+                                                        ", expected: not used when flags has set schemaless mode (flags: " + std::to_string(ctx->flags) + ")");
+                // Batches are built per table, rows of system transactions can have no table
+                if (ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
+                                                        ", expected: not used when flags has set show system transactions (flags: " +
+                                                        std::to_string(ctx->flags) + ")");
+                builder = new BuilderArrow(ctx, locales, metadata, format, flushBuffer, arrowBatchRows, arrowBatchMb * 1024 * 1024, arrowBatchLatencyUs);
+            } else if (formatType == "avro") {
+                // Messages refer to schemas by fingerprint, the schemas are kept in the registry file
+                if (lobStreamMb > 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
+                                                        ", expected: not \"avro\" when \"lob-stream-mb\" is used");
+                if (ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
+                                                        ", expected: not used when flags has set schemaless mode (flags: " + std::to_string(ctx->flags) + ")");
+                // Schemas are derived from the table definition, rows of system transactions can have no table
+                if (ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
+                                                        ", expected: not used when flags has set show system transactions (flags: " +
+                                                        std::to_string(ctx->flags) + ")");
+                const std::string avroRegistry = Ctx::getJsonFieldS(configFileName, Ctx::MAX_PATH_LENGTH, formatJson, "avro-registry");
+                builder = new BuilderAvro(ctx, locales, metadata, format, flushBuffer, avroRegistry);
             } else
-                throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType + R"(, expected: "protobuf" or "json")");
+                throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType + R"(, expected: "protobuf", "arrow", "avro" or "json")");
+            builder->setStreamTransactionMb(streamTransactionMb);
+            builder->setLobStreamMb(lobStreamMb);
+            builder->setPackMessage(packBytes, packLatencyUs);
             builders.push_back(builder);
 
             // READER
@@ -856,7 +1071,7 @@ namespace OpenLogReplicator {
                         const rapidjson::Value& tableElementJson = Ctx::getJsonFieldO(configFileName, tableArrayJson, "table", k);
 
                         if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
-                            static const std::vector<std::string> tableElementNames {"owner", "table", "key", "condition", "tag"};
+                            static const std::vector<std::string> tableElementNames {"owner", "table", "key", "condition", "tag", "columns"};
                             Ctx::checkJsonFields(configFileName, tableElementJson, tableElementNames);
                         }
 
@@ -878,6 +1093,30 @@ namespace OpenLogReplicator {
                             element->tag = Ctx::getJsonFieldS(configFileName, Ctx::JSON_TAG_LENGTH, tableElementJson, "tag");
                             element->parseTag(element->tag, separator);
                         }
+
+                        if (tableElementJson.HasMember("columns")) {
+                            const rapidjson::Value& columnsJson = Ctx::getJsonFieldO(configFileName, tableElementJson, "columns");
+
+                            if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+                                static const std::vector<std::string> columnsNames {"include", "exclude"};
+                                Ctx::checkJsonFields(configFileName, columnsJson, columnsNames);
+                            }
+
+                            if (columnsJson.HasMember("include") == columnsJson.HasMember("exclude"))
+                                throw ConfigurationException(30001, R"(bad JSON, invalid "columns" value: both or none of lists defined, )"
+                                                                    R"(expected: one of {"include", "exclude"})");
+
+                            const char* columnsField = "include";
+                            element->columnsType = SchemaElement::COLUMNS_TYPE::INCLUDE;
+                            if (columnsJson.HasMember("exclude")) {
+                                columnsField = "exclude";
+                                element->columnsType = SchemaElement::COLUMNS_TYPE::EXCLUDE;
+                            }
+
+                            const rapidjson::Value& columnsArrayJson = Ctx::getJsonFieldA(configFileName, columnsJson, columnsField);
+                            for (rapidjson::SizeType l = 0; l < columnsArrayJson.Size(); ++l)
+                                element->columnsList.push_back(Ctx::getJsonFieldS(configFileName, SysCol::NAME_LENGTH, columnsArrayJson, columnsField, l));
+                        }
                     }
                 }
 
@@ -939,7 +1178,7 @@ namespace OpenLogReplicator {
             if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                 static const std::vector<std::string> writerNames {"type", "poll-interval-us", "queue-size", "max-file-size", "timestamp-format", "output",
                                                                    "new-line", "append", "max-message-mb", "topic", "properties", "uri",
-                                                                   "write-buffer-flush-size"};
+                                                                   "write-buffer-flush-size", "compression"};
                 Ctx::checkJsonFields(configFileName, writerJson, writerNames);
             }
 
@@ -1008,6 +1247,16 @@ namespace OpenLogReplicator {
                         throw ConfigurationException(30001, "bad JSON, invalid \"max-message-mb\" value: " + std::to_string(maxMessageMb) +
                                                             ", expected: one of {1 .. " + std::to_string(WriterKafka::MAX_KAFKA_MESSAGE_MB) + "}");
                 }
+                // Packed transactions are sent as one message, which must not exceed the message size limit
+                if (replicator2->builder->getPackBytes() >= maxMessageMb * 1024 * 1024)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"max-message-mb\" value: " + std::to_string(maxMessageMb) +
+                                                        ", expected: more than \"pack-bytes\" value: " +
+                                                        std::to_string(replicator2->builder->getPackBytes()) + " bytes");
+                // A BLOB chunk is sent hex encoded in one message, so it takes twice the chunk size plus the message envelope
+                if (replicator2->builder->getLobStreamMb() * 2 >= maxMessageMb)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"max-message-mb\" value: " + std::to_string(maxMessageMb) +
+                                                        ", expected: more than twice \"lob-stream-mb\" value: " +
+                                                        std::to_string(replicator2->builder->getLobStreamMb()));
                 replicator2->builder->setMaxMessageMb(maxMessageMb);
 
                 const std::string topic = Ctx::getJsonFieldS(configFileName, Ctx::JSON_TOPIC_LENGTH, writerJson, "topic");
@@ -1052,6 +1301,53 @@ namespace OpenLogReplicator {
                 throw ConfigurationException(30001, "bad JSON, invalid \"type\" value: " + writerType +
                                                     R"(, expected: one of {"file", "kafka", "zeromq", "network", "discard"})");
 
+            if (writerJson.HasMember("compression")) {
+                const rapidjson::Value& compressionJson = Ctx::getJsonFieldO(configFileName, writerJson, "compression");
+
+                if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+                    static const std::vector<std::string> compressionNames {"type", "level", "dictionary-kb"};
+                    Ctx::checkJsonFields(configFileName, compressionJson, compressionNames);
+                }
+
+                // Kafka has own compression in librdkafka, frames are not line separated
+                if (writerType != "file" && writerType != "network" && writerType != "zeromq")
+                    throw ConfigurationException(30001, "bad JSON, invalid \"compression\" value, expected: not set for \"" + writerType + "\" writer");
+                if (writerType == "file" && (!writerJson.HasMember("new-line") || Ctx::getJsonFieldU64(configFileName, writerJson, "new-line") > 0))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"compression\" value, expected: \"new-line\" set to 0 for \"file\" writer");
+
+                const std::string compressionType = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, compressionJson, "type");
+                Compressor::CODEC codec;
+                if (compressionType == "zstd")
+                    codec = Compressor::CODEC::ZSTD;
+                else if (compressionType == "lz4")
+                    codec = Compressor::CODEC::LZ4;
+                else
+                    throw ConfigurationException(30001, "bad JSON, invalid \"type\" value: " + compressionType + R"(, expected: one of {"zstd", "lz4"})");
+                if (!Compressor::isCompiled(codec))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"type\" value: " + compressionType +
+                                                        ", expected: not \"" + compressionType + "\" since the code is not compiled");
+
+                uint64_t level = 3;
+                if (compressionJson.HasMember("level")) {
+                    level = Ctx::getJsonFieldU64(configFileName, compressionJson, "level");
+                    if (level < 1 || level > 19)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"level\" value: " + std::to_string(level) + ", expected: one of {1 .. 19}");
+                    // LZ4 is always used with default acceleration
+                    if (codec == Compressor::CODEC::LZ4)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"level\" value: " + std::to_string(level) + ", expected: not set for \"lz4\" type");
+                }
+
+                uint64_t dictionaryKb = 32;
+                if (compressionJson.HasMember("dictionary-kb")) {
+                    dictionaryKb = Ctx::getJsonFieldU64(configFileName, compressionJson, "dictionary-kb");
+                    if (dictionaryKb > 1024)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"dictionary-kb\" value: " + std::to_string(dictionaryKb) +
+                                                            ", expected: one of {0 .. 1024}");
+                }
+
+                writer->setCompressor(new Compressor(codec, static_cast<int>(level), dictionaryKb * 1024));
+            }
+
             writers.push_back(writer);
             writer->initialize();
             ctx->spawnThread(writer);
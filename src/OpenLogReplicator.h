@@ -31,6 +31,7 @@ namespace OpenLogReplicator {
     class Ctx;
     class Checkpoint;
     class Locales;
+    class MemoryGovernor;
     class MemoryManager;
     class Metadata;
     class Replicator;
@@ -44,6 +45,7 @@ namespace OpenLogReplicator {
         std::vector<Locales*> localess;
         std::vector<Builder*> builders;
         std::vector<Metadata*> metadatas;
+        std::vector<MemoryGovernor*> memoryGovernors;
         std::vector<MemoryManager*> memoryManagers;
         std::vector<TransactionBuffer*> transactionBuffers;
         std::vector<Writer*> writers;
@@ -18,8 +18,10 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
 #include <atomic>
+#include <cstring>
 
 #include "common/ClockHW.h"
+#include "common/Compressor.h"
 #include "common/Ctx.h"
 #include "common/OraProtoBuf.pb.h"
 #include "common/exception/ConfigurationException.h"
@@ -50,8 +52,22 @@ static void send(OpenLogReplicator::pb::RedoRequest& request, OpenLogReplicator:
     stream->sendMessage(buffer.c_str(), buffer.length());
 }
 
-static uint64_t receive(OpenLogReplicator::pb::RedoResponse& response, OpenLogReplicator::Stream* stream, OpenLogReplicator::Ctx* ctx, uint8_t* buffer, bool decode) {
-    const uint64_t length = stream->receiveMessage(buffer, MAX_CLIENT_MESSAGE_SIZE);
+static uint64_t receive(OpenLogReplicator::pb::RedoResponse& response, OpenLogReplicator::Stream* stream, OpenLogReplicator::Ctx* ctx,
+                        OpenLogReplicator::Compressor* compressor, uint8_t* buffer, bool decode) {
+    uint64_t length = stream->receiveMessage(buffer, MAX_CLIENT_MESSAGE_SIZE);
+
+    // Compressed message: dictionary frames are kept, the data frame is decoded in place
+    if (length >= OpenLogReplicator::Compressor::HEADER_SIZE && buffer[0] == OpenLogReplicator::Compressor::MAGIC0 &&
+            buffer[1] == OpenLogReplicator::Compressor::MAGIC1) {
+        std::string decoded;
+        uint64_t pos = 0;
+        while (pos < length)
+            pos += compressor->decompress(buffer + pos, length - pos, decoded);
+        if (decoded.length() >= MAX_CLIENT_MESSAGE_SIZE)
+            throw OpenLogReplicator::RuntimeException(0, "decompressed message too big: " + std::to_string(decoded.length()));
+        memcpy(reinterpret_cast<void*>(buffer), reinterpret_cast<const void*>(decoded.data()), decoded.length());
+        length = decoded.length();
+    }
 
     response.Clear();
     if (decode && !response.ParseFromArray(buffer, length)) {
@@ -109,6 +125,7 @@ int main(int argc, char** argv) {
     OpenLogReplicator::pb::RedoResponse response;
     OpenLogReplicator::Stream* stream = nullptr;
     auto* buffer = new uint8_t[MAX_CLIENT_MESSAGE_SIZE];
+    OpenLogReplicator::Compressor compressor(OpenLogReplicator::Compressor::CODEC::STORED, 0, 0);
 
     try {
         const std::string arg1 = argv[1];
@@ -138,7 +155,7 @@ int main(int argc, char** argv) {
         request.set_database_name(argv[3]);
         ctx.info(0, "database: " + request.database_name());
         send(request, stream, &ctx);
-        receive(response, stream, &ctx, buffer, true);
+        receive(response, stream, &ctx, &compressor, buffer, true);
         ctx.info(0, "- code: " + std::to_string(static_cast<uint>(response.code())) + ", scn: " + std::to_string(response.scn()) +
                     ", confirmed: " + std::to_string(response.c_scn()) + "," + std::to_string(response.c_idx()));
 
@@ -197,7 +214,7 @@ int main(int argc, char** argv) {
         uint64_t last = ctx.clock->getTimeUt();
 
         send(request, stream, &ctx);
-        receive(response, stream, &ctx, buffer, true);
+        receive(response, stream, &ctx, &compressor, buffer, true);
         ctx.info(0, "- code: " + std::to_string(static_cast<uint>(response.code())));
 
         // Either after start or after continue, the server is expected to start streaming
@@ -206,7 +223,7 @@ int main(int argc, char** argv) {
                                                          " for request code: " + std::to_string(request.code()));
 
         for (;;) {
-            const uint64_t length = receive(response, stream, &ctx, buffer, formatProtobuf);
+            const uint64_t length = receive(response, stream, &ctx, &compressor, buffer, formatProtobuf);
 
             OpenLogReplicator::Scn cScn;
             uint64_t cIdx;
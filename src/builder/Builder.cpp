@@ -18,6 +18,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
 #include <cmath>
+#include <utility>
 #include <vector>
 
 #include "../common/DbColumn.h"
@@ -88,6 +89,8 @@ namespace OpenLogReplicator {
 
     void Builder::processValue(LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeCol col, const uint8_t* data, uint32_t size,
                                FileOffset fileOffset, bool after, bool compressed) {
+        valueColumn = nullptr;
+
         // 如果数据是压缩的，直接以RAW格式输出
         if (compressed) {
             const std::string columnName("COMPRESSED");
@@ -104,6 +107,7 @@ namespace OpenLogReplicator {
         
         // 获取列定义
         DbColumn* column = table->columns[col];
+        valueColumn = column;
         
         // 如果配置为显示RAW列数据，以原始格式输出
         if (ctx->isFlagSet(Ctx::REDO_FLAGS::RAW_COLUMN_DATA)) {
@@ -146,14 +150,21 @@ namespace OpenLogReplicator {
                 break;
 
             case SysCol::COLTYPE::NUMBER:
-                // 解析数字类型数据
-                parseNumber(data, size, fileOffset);
-                columnNumber(column->name, column->precision, column->scale);
+                // 解析数字类型数据，无穷大没有十进制表示
+                if (unlikely(Data::isNumberInfinity(data, size)))
+                    columnUnknown(column->name, data, size);
+                else {
+                    parseNumber(data, size, fileOffset);
+                    columnNumber(column->name, column->precision, column->scale);
+                }
                 break;
 
             case SysCol::COLTYPE::BLOB:
                 // 处理BLOB类型，可能包含XML数据
                 if (after) {
+                    if (lobStreamMb > 0 && !column->xmlType && !format.isMessageFormatFull() &&
+                            streamLob(lobCtx, data, size, column->name, 0, fileOffset, false, table->sys))
+                        break;
                     if (parseLob(lobCtx, data, size, 0, table->obj, fileOffset, false, table->sys)) {
                         if (column->xmlType && ctx->isFlagSet(Ctx::REDO_FLAGS::EXPERIMENTAL_XMLTYPE)) {
                             if (parseXml(xmlCtx, reinterpret_cast<const uint8_t*>(valueBuffer), valueSize, fileOffset))
@@ -176,6 +187,9 @@ namespace OpenLogReplicator {
             case SysCol::COLTYPE::CLOB:
                 // 处理CLOB类型数据
                 if (after) {
+                    if (lobStreamMb > 0 && !format.isMessageFormatFull() &&
+                            streamLob(lobCtx, data, size, column->name, column->charsetId, fileOffset, true, table->systemTable > DbTable::TABLE::NONE))
+                        break;
                     if (parseLob(lobCtx, data, size, column->charsetId, table->obj, fileOffset, true, table->systemTable > DbTable::TABLE::NONE))
                         columnString(column->name);
                 }
@@ -705,6 +719,170 @@ namespace OpenLogReplicator {
         maxMessageMb = maxMessageMb_;
     }
 
+    uint64_t Builder::getStreamTransactionMb() const {
+        return streamTransactionMb;
+    }
+
+    void Builder::setStreamTransactionMb(uint64_t newStreamTransactionMb) {
+        streamTransactionMb = newStreamTransactionMb;
+    }
+
+    uint64_t Builder::getLobStreamMb() const {
+        return lobStreamMb;
+    }
+
+    void Builder::setLobStreamMb(uint64_t newLobStreamMb) {
+        lobStreamMb = newLobStreamMb;
+    }
+
+    void Builder::setPackMessage(uint64_t newPackBytes, uint64_t newPackLatencyUs) {
+        packBytes = newPackBytes;
+        packLatencyUs = newPackLatencyUs;
+    }
+
+    uint64_t Builder::getPackBytes() const {
+        return packBytes;
+    }
+
+    void Builder::packReserve(uint64_t size) {
+        // The transaction would otherwise be divided only because earlier transactions share the message
+        if (packSize > 0 && maxMessageMb > 0 && packSize + size > maxMessageMb * 1024 * 1024)
+            packFlush();
+    }
+
+    bool Builder::packBegin(Scn scn, Seq sequence) {
+        // Next transaction is appended to the open message
+        if (packSize > 0)
+            return true;
+
+        builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+        return false;
+    }
+
+    void Builder::packCommit() {
+        if (packBytes == 0) {
+            builderCommit();
+            return;
+        }
+
+        if (packSize == 0)
+            packTime = ctx->clock->getTimeUt();
+        packSize = messageSize + messagePosition;
+
+        if (packSize >= packBytes || ctx->clock->getTimeUt() - packTime >= static_cast<time_ut>(packLatencyUs))
+            packFlush();
+    }
+
+    void Builder::packFlush() {
+        if (packSize == 0)
+            return;
+
+        // The message contains all packed transactions, so it is confirmed at the position of the last one
+        msg->lwnScn = lwnScn;
+        msg->lwnIdx = lwnIdx++;
+        packSize = 0;
+        builderCommit();
+    }
+
+    bool Builder::packCheckpoint(bool redo) {
+        if (packSize == 0)
+            return false;
+
+        // The checkpoint can't be sent before the packed transactions, otherwise the writer could confirm the position before they are sent
+        if (!redo && !ctx->softShutdown && ctx->clock->getTimeUt() - packTime < static_cast<time_ut>(packLatencyUs))
+            return true;
+
+        packFlush();
+        return false;
+    }
+
+    const uint8_t* Builder::getLobPage(const LobData* lobData, uint32_t pageNo, uint64_t& pageSize) {
+        const uint8_t* pageData = lobData->getPageData(pageNo);
+        if (pageData == nullptr)
+            return nullptr;
+
+        pageSize = lobData->pageSize;
+        if (pageNo == lobData->sizePages)
+            pageSize = lobData->sizeRest;
+
+        const auto* redoLogRecordLob = reinterpret_cast<const RedoLogRecord*>(pageData + sizeof(typeTransactionSize));
+        if (redoLogRecordLob->lobDataSize < pageSize)
+            return nullptr;
+        return redoLogRecordLob->data(redoLogRecordLob->lobData);
+    }
+
+    bool Builder::streamLob(LobCtx* lobCtx, const uint8_t* data, uint32_t size, const std::string& columnName, uint64_t charsetId, FileOffset fileOffset,
+                            bool isClob, bool isSystem) {
+        // In-row values are short, only LOBs kept in indexed pages are streamed
+        if (size < 20)
+            return false;
+
+        const LobId lobId(data + 10);
+        lobCtx->checkOrphanedLobs(ctx, lobId, lastXid, fileOffset);
+
+        auto lobsIt = lobCtx->lobs.find(lobId);
+        if (lobsIt == lobCtx->lobs.end())
+            return false;
+        const LobData* lobData = lobsIt->second;
+        if (lobData->pageSize == 0)
+            return false;
+
+        const uint64_t chunkSize = lobStreamMb * 1024 * 1024;
+        const uint64_t lobSize = (static_cast<uint64_t>(lobData->pageSize) * lobData->sizePages) + lobData->sizeRest;
+        if (lobSize <= chunkSize)
+            return false;
+
+        // Missing pages are reported by the regular path
+        const uint32_t pages = lobData->sizePages + (lobData->sizeRest > 0 ? 1 : 0);
+        for (uint32_t pageNo = 0; pageNo < pages; ++pageNo) {
+            uint64_t pageSize;
+            if (getLobPage(lobData, pageNo, pageSize) == nullptr)
+                return false;
+        }
+
+        const uint64_t pagesPerChunk = std::max<uint64_t>(chunkSize / lobData->pageSize, 1);
+        lobStreams.push_back({lobData, lobId, columnName, lobSize, charsetId, fileOffset, isClob, isSystem});
+        columnLob(columnName, lobId, lobSize, (pages + pagesPerChunk - 1) / pagesPerChunk);
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::LOB)))
+            ctx->logTrace(Ctx::TRACE::LOB, "id: " + lobId.lower() + " stream size: " + std::to_string(lobSize) + " pages: " + std::to_string(pages));
+        return true;
+    }
+
+    void Builder::processLobStreams(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                                    typeSlot slot) {
+        const uint64_t chunkSize = lobStreamMb * 1024 * 1024;
+        for (const LobStream& lobStream: lobStreams) {
+            const LobData* lobData = lobStream.lobData;
+            const uint32_t pages = lobData->sizePages + (lobData->sizeRest > 0 ? 1 : 0);
+            const uint64_t pagesPerChunk = std::max<uint64_t>(chunkSize / lobData->pageSize, 1);
+
+            uint64_t chunk = 0;
+            uint64_t chunkOffset = 0;
+            uint32_t pageNo = 0;
+            while (pageNo < pages) {
+                // Pages are referenced in place, the value is never assembled as a whole
+                lobChunkPages.clear();
+                uint64_t chunkBytes = 0;
+                for (uint64_t i = 0; i < pagesPerChunk && pageNo < pages; ++i, ++pageNo) {
+                    uint64_t pageSize;
+                    const uint8_t* pageData = getLobPage(lobData, pageNo, pageSize);
+                    if (unlikely(pageData == nullptr))
+                        throw RedoLogException(50074, "missing LOB page: " + std::to_string(pageNo) + ", lobid: " + lobStream.lobId.upper() +
+                                                      ", xid: " + lastXid.toString() + ", offset: " + lobStream.fileOffset.toString());
+                    lobChunkPages.emplace_back(pageData, pageSize);
+                    chunkBytes += pageSize;
+                }
+
+                processLobChunk(scn, sequence, timestamp, table, obj, dataObj, bdba, slot, lobStream, chunk, chunkOffset, pageNo == pages);
+                chunkOffset += chunkBytes;
+                ++chunk;
+            }
+        }
+        lobStreams.clear();
+        lobChunkPages.clear();
+    }
+
     void Builder::processBegin(Xid xid, Scn scn, Scn newLwnScn, const std::unordered_map<std::string, std::string>* newAttributes) {
         lastXid = xid;
         commitScn = scn;
@@ -714,6 +892,7 @@ namespace OpenLogReplicator {
         }
         newTran = true;
         attributes = newAttributes;
+        conditionCache.reset();
 
         if (attributes->empty()) {
             metadata->ctx->warning(50065, "empty attributes for XID: " + lastXid.toString());
@@ -770,7 +949,8 @@ namespace OpenLogReplicator {
                     }
                 }
 
-                if (colSize > 0 || format.columnFormat >= Format::COLUMN_FORMAT::FULL_INS_DEC || table == nullptr || table->columns[i]->numPk > 0)
+                if ((colSize > 0 || format.columnFormat >= Format::COLUMN_FORMAT::FULL_INS_DEC || table == nullptr || table->columns[i]->numPk > 0) &&
+                        (table == nullptr || !table->isColumnSkipped(i)))
                     valueSet(Format::VALUE_TYPE::AFTER, i, redoLogRecord2->data(fieldPos + pos), colSize, 0, dump);
                 pos += colSize;
             }
@@ -781,7 +961,7 @@ namespace OpenLogReplicator {
                                                  redoLogRecord1->fileOffset);
 
             if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                 table->matchesCondition(ctx, 'i', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+                 table->matchesCondition(ctx, 'i', attributes, this, &conditionCache)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                 ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
 
                 processInsert(scn, sequence, timestamp, lobCtx, xmlCtx, table, redoLogRecord2->obj, redoLogRecord2->dataObj, redoLogRecord2->bdba,
@@ -863,7 +1043,8 @@ namespace OpenLogReplicator {
                     }
                 }
 
-                if (colSize > 0 || format.columnFormat >= Format::COLUMN_FORMAT::FULL_INS_DEC || table == nullptr || table->columns[i]->numPk > 0)
+                if ((colSize > 0 || format.columnFormat >= Format::COLUMN_FORMAT::FULL_INS_DEC || table == nullptr || table->columns[i]->numPk > 0) &&
+                        (table == nullptr || !table->isColumnSkipped(i)))
                     valueSet(Format::VALUE_TYPE::BEFORE, i, redoLogRecord1->data(fieldPos + pos), colSize, 0, dump);
                 pos += colSize;
             }
@@ -874,7 +1055,7 @@ namespace OpenLogReplicator {
                                                  redoLogRecord1->fileOffset);
 
             if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                 table->matchesCondition(ctx, 'd', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+                 table->matchesCondition(ctx, 'd', attributes, this, &conditionCache)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                 ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
 
                 processDelete(scn, sequence, timestamp, lobCtx, xmlCtx, table, redoLogRecord2->obj, redoLogRecord2->dataObj, redoLogRecord2->bdba,
@@ -906,6 +1087,30 @@ namespace OpenLogReplicator {
         }
     }
 
+    bool Builder::columnValue(char op, typeCol column, const uint8_t*& data, uint64_t& size) const {
+        if (column >= valuesMax || (valuesSet[column >> 6] & (1ULL << (column & 0x3F))) == 0)
+            return false;
+
+        // Delete is evaluated on the removed row, insert and update on the new one
+        auto first = static_cast<uint>(Format::VALUE_TYPE::AFTER);
+        auto second = static_cast<uint>(Format::VALUE_TYPE::BEFORE);
+        if (op == 'd')
+            std::swap(first, second);
+
+        if (values[column][first] != nullptr) {
+            data = values[column][first];
+            size = sizes[column][first];
+            return true;
+        }
+
+        if (values[column][second] != nullptr) {
+            data = values[column][second];
+            size = sizes[column][second];
+            return true;
+        }
+        return false;
+    }
+
     void Builder::processDml(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx,
                              const std::deque<const RedoLogRecord*>& redo1, const std::deque<const RedoLogRecord*>& redo2,
                              Format::TRANSACTION_TYPE transactionType, bool system, bool schema, bool dump) {
@@ -1069,7 +1274,9 @@ namespace OpenLogReplicator {
                         colSize = fieldSize;
                     }
 
-                    valueSet(Format::VALUE_TYPE::BEFORE, colNum, redoLogRecord1p->data(fieldPos), colSize, fb, dump);
+                    // Columns not selected by the filter are dropped before any copying or decoding
+                    if (table == nullptr || !table->isColumnSkipped(colNum))
+                        valueSet(Format::VALUE_TYPE::BEFORE, colNum, redoLogRecord1p->data(fieldPos), colSize, fb, dump);
 
                     bits <<= 1;
                     if (bits == 0) {
@@ -1143,14 +1350,16 @@ namespace OpenLogReplicator {
                         suppPrev = true;
                     }
 
+                    const bool skipped = table != nullptr && table->isColumnSkipped(colNum);
+
                     // Insert, lock, update, supplemental log data
-                    if (redoLogRecord2p->opCode == 0x0B02 || redoLogRecord2p->opCode == 0x0B04 || redoLogRecord2p->opCode == 0x0B05 ||
-                        redoLogRecord2p->opCode == 0x0B10)
+                    if (!skipped && (redoLogRecord2p->opCode == 0x0B02 || redoLogRecord2p->opCode == 0x0B04 || redoLogRecord2p->opCode == 0x0B05 ||
+                        redoLogRecord2p->opCode == 0x0B10))
                         valueSet(Format::VALUE_TYPE::AFTER_SUPP, colNum, redoLogRecord1p->data(fieldPos), colSize, fb, dump);
 
                     // Delete, update, overwrite, supplemental log data
-                    if (redoLogRecord2p->opCode == 0x0B03 || redoLogRecord2p->opCode == 0x0B05 || redoLogRecord2p->opCode == 0x0B06 ||
-                        redoLogRecord2p->opCode == 0x0B10)
+                    if (!skipped && (redoLogRecord2p->opCode == 0x0B03 || redoLogRecord2p->opCode == 0x0B05 || redoLogRecord2p->opCode == 0x0B06 ||
+                        redoLogRecord2p->opCode == 0x0B10))
                         valueSet(Format::VALUE_TYPE::BEFORE_SUPP, colNum, redoLogRecord1p->data(fieldPos), colSize, fb, dump);
 
                     colSizes += 2;
@@ -1254,7 +1463,8 @@ namespace OpenLogReplicator {
                     else
                         colSize = fieldSize;
 
-                    valueSet(Format::VALUE_TYPE::AFTER, colNum, redoLogRecord2p->data(fieldPos), colSize, fb, dump);
+                    if (table == nullptr || !table->isColumnSkipped(colNum))
+                        valueSet(Format::VALUE_TYPE::AFTER, colNum, redoLogRecord2p->data(fieldPos), colSize, fb, dump);
 
                     bits <<= 1;
                     if (bits == 0) {
@@ -1309,6 +1519,24 @@ namespace OpenLogReplicator {
                                                           " is already set when merging, xid: " + lastXid.toString() + ", offset: " +
                                                           redoLogRecord1->fileOffset.toString());
 
+                        // Just one part present, the value is used in place from the redo vector
+                        uint64_t partLast = 0;
+                        uint64_t parts = 0;
+                        for (uint64_t part = 0; part < 3; ++part) {
+                            if (valuesPart[part][column][j] != nullptr && sizesPart[part][column][j] > 0) {
+                                partLast = part;
+                                ++parts;
+                            }
+                        }
+                        if (parts == 1) {
+                            values[column][j] = valuesPart[partLast][column][j];
+                            sizes[column][j] = sizesPart[partLast][column][j];
+                            valuesPart[0][column][j] = nullptr;
+                            valuesPart[1][column][j] = nullptr;
+                            valuesPart[2][column][j] = nullptr;
+                            continue;
+                        }
+
                         auto* buffer = new uint8_t[mergeSize];
                         merges[mergesMax++] = buffer;
 
@@ -1440,6 +1668,10 @@ namespace OpenLogReplicator {
         }
 
         if (transactionType == Format::TRANSACTION_TYPE::UPDATE) {
+            // Evaluated before unchanged column values are removed
+            const bool conditionMatches = !schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
+                                          table->matchesCondition(ctx, 'u', attributes, this, &conditionCache);
+
             if (!compressedBefore && !compressedAfter) {
                 baseMax = valuesMax >> 6;
                 for (typeCol base = 0; base <= baseMax; ++base) {
@@ -1561,8 +1793,7 @@ namespace OpenLogReplicator {
             if (system && table != nullptr && DbTable::isSystemTable(table->options))
                 systemTransaction->processUpdate(table, dataObj, bdba, slot, redoLogRecord1->fileOffset);
 
-            if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                 table->matchesCondition(ctx, 'u', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+            if (conditionMatches || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                 ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
 
                 processUpdate(scn, sequence, timestamp, lobCtx, xmlCtx, table, obj, dataObj, bdba, slot, redoLogRecord1->fileOffset);
@@ -1644,7 +1875,7 @@ namespace OpenLogReplicator {
                 systemTransaction->processInsert(table, dataObj, bdba, slot, redoLogRecord1->fileOffset);
 
             if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                 table->matchesCondition(ctx, 'i', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+                 table->matchesCondition(ctx, 'i', attributes, this, &conditionCache)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                 ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
 
                 processInsert(scn, sequence, timestamp, lobCtx, xmlCtx, table, obj, dataObj, bdba, slot, redoLogRecord1->fileOffset);
@@ -1722,7 +1953,7 @@ namespace OpenLogReplicator {
                 systemTransaction->processDelete(table, dataObj, bdba, slot, redoLogRecord1->fileOffset);
 
             if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                 table->matchesCondition(ctx, 'd', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+                 table->matchesCondition(ctx, 'd', attributes, this, &conditionCache)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                 ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
 
                 processDelete(scn, sequence, timestamp, lobCtx, xmlCtx, table, obj, dataObj, bdba, slot, redoLogRecord1->fileOffset);
@@ -1871,14 +2102,14 @@ namespace OpenLogReplicator {
         valueSize = 0;
 
         // bool bigint = false;
-        std::string out;
         uint pos = 0;
-        std::vector<std::string> tags;
-        std::map<std::string, std::string> dictNmSpcMap;
-        std::map<std::string, std::string> nmSpcPrefixMap;
+        std::vector<const XmlCtx::XmlToken*> tags;
+        std::map<uint64_t, uint64_t> dictNmSpcMap;
+        std::map<uint64_t, std::string> nmSpcPrefixMap;
+        std::unordered_map<uint64_t, XmlCtx::XmlToken> prefixedTokens;
         bool tagOpen = false;
         bool attributeOpen = false;
-        std::string lastTag;
+        const XmlCtx::XmlToken* lastTag = nullptr;
 
         while (pos < size) {
             // Header
@@ -2073,37 +2304,15 @@ namespace OpenLogReplicator {
                     isSingle = true;
                 }
 
-                std::string codeStr;
-                if (code < 0x100)
-                    codeStr = {Data::map16U((code >> 4) & 0x0F), Data::map16U(code & 0x0F)};
-                else if (code < 0x10000)
-                    codeStr = {Data::map16U((code >> 12) & 0x0F), Data::map16U((code >> 8) & 0x0F),
-                               Data::map16U((code >> 4) & 0x0F), Data::map16U(code & 0x0F)};
-                else if (code < 0x1000000)
-                    codeStr = {Data::map16U((code >> 20) & 0x0F), Data::map16U((code >> 16) & 0x0F),
-                               Data::map16U((code >> 12) & 0x0F), Data::map16U((code >> 8) & 0x0F),
-                               Data::map16U((code >> 4) & 0x0F), Data::map16U(code & 0x0F)};
-                else
-                    codeStr = {Data::map16U((code >> 28) & 0x0F), Data::map16U((code >> 24) & 0x0F),
-                               Data::map16U((code >> 20) & 0x0F), Data::map16U((code >> 16) & 0x0F),
-                               Data::map16U((code >> 12) & 0x0F), Data::map16U((code >> 8) & 0x0F),
-                               Data::map16U((code >> 4) & 0x0F), Data::map16U(code & 0x0F)};
-
-                auto xdbXQnMapIdIt = xmlCtx->xdbXQnPack.unorderedMapKey.find(XdbXQnKey(codeStr));
-                if (xdbXQnMapIdIt == xmlCtx->xdbXQnPack.unorderedMapKey.end()) {
-                    ctx->warning(60036, "incorrect XML data: string too short, can't decode qn   " + codeStr);
+                const XmlCtx::XmlToken* token = xmlCtx->findQn(code);
+                if (token == nullptr) {
+                    ctx->warning(60036, "incorrect XML data: string too short, can't decode qn   " + XmlCtx::tokenIdToString(code));
                     return false;
                 }
 
-                std::string tag = xdbXQnMapIdIt->second->localName;
-                // not very efficient, but it's not a problem
-                const uint64_t flagsSize = xdbXQnMapIdIt->second->flags.length();
-                const bool isAttribute = (((xdbXQnMapIdIt->second->flags.at(flagsSize - 1) - '0') & XdbXQn::FLAG_ISATTRIBUTE) != 0);
-
-                if (isAttribute) {
-                    out = " " + tag + "=\"";
-                    valueBufferCheck(out.length(), fileOffset);
-                    valueBufferAppend(out.c_str(), out.length());
+                if (token->isAttribute) {
+                    valueBufferCheck(token->attribute.length(), fileOffset);
+                    valueBufferAppend(token->attribute.c_str(), token->attribute.length());
                 } else {
                     if (attributeOpen) {
                         valueBufferCheck(2, fileOffset);
@@ -2115,19 +2324,30 @@ namespace OpenLogReplicator {
                         tagOpen = false;
                     }
 
-                    // append namespace to tag name
-                    const std::string nmSpcId = xdbXQnMapIdIt->second->nmSpcId;
-                    auto nmSpcPrefixMapIt = nmSpcPrefixMap.find(nmSpcId);
-                    if (nmSpcPrefixMapIt != nmSpcPrefixMap.end())
-                        tag = nmSpcPrefixMapIt->second + ":" + tag;
+                    // append namespace to tag name, prefixed fragments are built once per document
+                    if (!nmSpcPrefixMap.empty()) {
+                        auto nmSpcPrefixMapIt = nmSpcPrefixMap.find(token->nmSpcId);
+                        if (nmSpcPrefixMapIt != nmSpcPrefixMap.end()) {
+                            auto prefixedTokensIt = prefixedTokens.find(code);
+                            if (prefixedTokensIt == prefixedTokens.end()) {
+                                XmlCtx::XmlToken prefixed;
+                                prefixed.valid = true;
+                                prefixed.nmSpcId = token->nmSpcId;
+                                prefixed.localName = nmSpcPrefixMapIt->second + ":" + token->localName;
+                                prefixed.tagOpen = "<" + prefixed.localName;
+                                prefixed.tagClose = "</" + prefixed.localName + ">";
+                                prefixedTokensIt = prefixedTokens.emplace(code, std::move(prefixed)).first;
+                            }
+                            token = &prefixedTokensIt->second;
+                        }
+                    }
 
-                    if (tagSize == 0 && !isSingle) {
-                        out = "<" + tag;
+                    valueBufferCheck(token->tagOpen.length() + 1, fileOffset);
+                    valueBufferAppend(token->tagOpen.c_str(), token->tagOpen.length());
+                    if (tagSize == 0 && !isSingle)
                         tagOpen = true;
-                    } else
-                        out = "<" + tag + ">";
-                    valueBufferCheck(out.length(), fileOffset);
-                    valueBufferAppend(out.c_str(), out.length());
+                    else
+                        valueBufferAppend('>');
                 }
 
                 if (tagSize > 0) {
@@ -2140,7 +2360,7 @@ namespace OpenLogReplicator {
                     pos += tagSize;
                 }
 
-                if (isAttribute) {
+                if (token->isAttribute) {
                     if (isSingle) {
                         valueBufferCheck(1, fileOffset);
                         valueBufferAppend('"');
@@ -2148,11 +2368,10 @@ namespace OpenLogReplicator {
                         attributeOpen = true;
                 } else {
                     if (isSingle) {
-                        out = "</" + tag + ">";
-                        valueBufferCheck(out.length(), fileOffset);
-                        valueBufferAppend(out.c_str(), out.length());
+                        valueBufferCheck(token->tagClose.length(), fileOffset);
+                        valueBufferAppend(token->tagClose.c_str(), token->tagClose.length());
                     } else
-                        tags.push_back(tag);
+                        tags.push_back(token);
                 }
 
                 continue;
@@ -2175,37 +2394,23 @@ namespace OpenLogReplicator {
                 const uint16_t dict = Ctx::read16Big(data + pos);
                 pos += 2;
 
-                std::string nmSpcId;
-                if (nmSpc < 256)
-                    nmSpcId = {Data::map16U((nmSpc >> 4) & 0x0F), Data::map16U(nmSpc & 0x0F)};
-                else
-                    nmSpcId = {Data::map16U((nmSpc >> 12) & 0x0F), Data::map16U((nmSpc >> 8) & 0x0F),
-                               Data::map16U((nmSpc >> 4) & 0x0F), Data::map16U(nmSpc & 0x0F)};
-
-                std::string dictId;
-                if (dict < 256)
-                    dictId = {Data::map16U((dict >> 4) & 0x0F), Data::map16U(dict & 0x0F)};
-                else
-                    dictId = {Data::map16U((dict >> 12) & 0x0F), Data::map16U((dict >> 8) & 0x0F),
-                              Data::map16U((dict >> 4) & 0x0F), Data::map16U(dict & 0x0F)};
-
-                auto dictNmSpcMapIt = dictNmSpcMap.find(dictId);
+                auto dictNmSpcMapIt = dictNmSpcMap.find(dict);
                 if (dictNmSpcMapIt != dictNmSpcMap.end()) {
-                    ctx->warning(60036, "incorrect XML data: namespace " + dictId + " duplicated dict");
+                    ctx->warning(60036, "incorrect XML data: namespace " + XmlCtx::tokenIdToString(dict) + " duplicated dict");
                     return false;
                 }
-                dictNmSpcMap.insert_or_assign(dictId, nmSpcId);
+                dictNmSpcMap.insert_or_assign(dict, nmSpc);
 
                 if (tagSize > 0) {
                     const std::string prefix(reinterpret_cast<const char*>(data + pos), tagSize);
                     pos += tagSize;
 
-                    auto nmSpcPrefixMapIt = nmSpcPrefixMap.find(nmSpcId);
+                    auto nmSpcPrefixMapIt = nmSpcPrefixMap.find(nmSpc);
                     if (nmSpcPrefixMapIt != nmSpcPrefixMap.end()) {
-                        ctx->warning(60036, "incorrect XML data: namespace " + nmSpcId + " duplicated prefix");
+                        ctx->warning(60036, "incorrect XML data: namespace " + XmlCtx::tokenIdToString(nmSpc) + " duplicated prefix");
                         return false;
                     }
-                    nmSpcPrefixMap.insert_or_assign(nmSpcId, prefix);
+                    nmSpcPrefixMap.insert_or_assign(nmSpc, prefix);
                 }
 
                 continue;
@@ -2222,24 +2427,17 @@ namespace OpenLogReplicator {
                 const uint16_t dict = Ctx::read16Big(data + pos);
                 pos += 2;
 
-                std::string dictId;
-                if (dict < 256)
-                    dictId = {Data::map16U((dict >> 4) & 0x0F), Data::map16U(dict & 0x0F)};
-                else
-                    dictId = {Data::map16U((dict >> 12) & 0x0F), Data::map16U((dict >> 8) & 0x0F),
-                              Data::map16U((dict >> 4) & 0x0F), Data::map16U(dict & 0x0F)};
-
-                auto dictNmSpcMapIt = dictNmSpcMap.find(dictId);
+                auto dictNmSpcMapIt = dictNmSpcMap.find(dict);
                 if (dictNmSpcMapIt == dictNmSpcMap.end()) {
-                    ctx->warning(60036, "incorrect XML data: namespace " + dictId + " not found for namespace");
+                    ctx->warning(60036, "incorrect XML data: namespace " + XmlCtx::tokenIdToString(dict) + " not found for namespace");
                     return false;
                 }
-                const std::string nmSpcId = dictNmSpcMapIt->second;
+                const uint64_t nmSpcId = dictNmSpcMapIt->second;
 
                 // search url
-                auto xdbXNmMapIdIt = xmlCtx->xdbXNmPack.unorderedMapKey.find(XdbXNmKey(nmSpcId));
-                if (xdbXNmMapIdIt == xmlCtx->xdbXNmPack.unorderedMapKey.end()) {
-                    ctx->warning(60036, "incorrect XML data: namespace " + nmSpcId + " not found");
+                const std::string* nmSpcUri = xmlCtx->findNmSpcUri(nmSpcId);
+                if (nmSpcUri == nullptr) {
+                    ctx->warning(60036, "incorrect XML data: namespace " + XmlCtx::tokenIdToString(nmSpcId) + " not found");
                     return false;
                 }
 
@@ -2258,8 +2456,8 @@ namespace OpenLogReplicator {
                 valueBufferCheck(2, fileOffset);
                 valueBufferAppend("=\"", 2);
 
-                valueBufferCheck(xdbXNmMapIdIt->second->nmSpcUri.length(), fileOffset);
-                valueBufferAppend(xdbXNmMapIdIt->second->nmSpcUri.c_str(), xdbXNmMapIdIt->second->nmSpcUri.length());
+                valueBufferCheck(nmSpcUri->length(), fileOffset);
+                valueBufferAppend(nmSpcUri->c_str(), nmSpcUri->length());
 
                 valueBufferCheck(1, fileOffset);
                 valueBufferAppend('"');
@@ -2318,7 +2516,8 @@ namespace OpenLogReplicator {
             // end tag
             if (data[pos] == 0xD9) {
                 if (attributeOpen) {
-                    out = "\"";
+                    valueBufferCheck(1, fileOffset);
+                    valueBufferAppend('"');
                     attributeOpen = false;
                     tagOpen = true;
                 } else {
@@ -2328,11 +2527,10 @@ namespace OpenLogReplicator {
                     }
                     lastTag = tags.back();
                     tags.pop_back();
-                    out = "</" + lastTag + ">";
+                    valueBufferCheck(lastTag->tagClose.length(), fileOffset);
+                    valueBufferAppend(lastTag->tagClose.c_str(), lastTag->tagClose.length());
                 }
 
-                valueBufferCheck(out.length(), fileOffset);
-                valueBufferAppend(out.c_str(), out.length());
                 ++pos;
                 continue;
             }
@@ -2345,11 +2543,14 @@ namespace OpenLogReplicator {
 
             // repeat last tag
             if (data[pos] >= 0xD4 && data[pos] <= 0xD5) {
+                if (lastTag == nullptr) {
+                    ctx->warning(60036, "incorrect XML data: repeat tag found, but no tag closed before");
+                    return false;
+                }
                 tags.push_back(lastTag);
-                out = "<" + lastTag;
                 tagOpen = true;
-                valueBufferCheck(out.length(), fileOffset);
-                valueBufferAppend(out.c_str(), out.length());
+                valueBufferCheck(lastTag->tagOpen.length(), fileOffset);
+                valueBufferAppend(lastTag->tagOpen.c_str(), lastTag->tagOpen.length());
                 ++pos;
                 continue;
             }
@@ -2366,6 +2567,94 @@ namespace OpenLogReplicator {
         return true;
     }
 
+    void Builder::publish(Thread* t, Builder* workerBuilder) {
+        if (workerBuilder->firstBuilderQueue == workerBuilder->lastBuilderQueue && workerBuilder->lastBuilderSize == 0)
+            return;
+
+        // Messages get ids and checkpoint positions in the order they are published
+        BuilderQueue* builderQueue = workerBuilder->firstBuilderQueue;
+        uint64_t pos = builderQueue->start;
+        while (builderQueue != nullptr) {
+            if (pos >= builderQueue->confirmedSize) {
+                builderQueue = builderQueue->next;
+                if (builderQueue != nullptr)
+                    pos = builderQueue->start;
+                continue;
+            }
+
+            auto* workerMsg = reinterpret_cast<BuilderMsg*>(builderQueue->data + pos);
+            workerMsg->id = msgId++;
+            if (workerMsg->lwnScn != lwnScn) {
+                lwnScn = workerMsg->lwnScn;
+                lwnIdx = 0;
+            }
+            workerMsg->lwnIdx = lwnIdx++;
+
+            // A big message may continue in the following buffers
+            uint64_t length = (sizeof(BuilderMsg) + workerMsg->size + 7) & 0xFFFFFFFFFFFFFFF8;
+            while (pos + length > OUTPUT_BUFFER_DATA_SIZE && builderQueue->next != nullptr) {
+                length -= OUTPUT_BUFFER_DATA_SIZE - pos;
+                builderQueue = builderQueue->next;
+                pos = 0;
+            }
+            pos += length;
+        }
+
+        // Small output is copied, so that every transaction does not take a separate buffer
+        if (workerBuilder->firstBuilderQueue == workerBuilder->lastBuilderQueue &&
+            lastBuilderSize + workerBuilder->lastBuilderSize <= OUTPUT_BUFFER_DATA_SIZE) {
+            memcpy(reinterpret_cast<void*>(lastBuilderQueue->data + lastBuilderSize),
+                   reinterpret_cast<const void*>(workerBuilder->lastBuilderQueue->data), workerBuilder->lastBuilderSize);
+
+            // Message data follows its header, move the pointers with the copy
+            for (pos = 0; pos < workerBuilder->lastBuilderSize;) {
+                auto* copiedMsg = reinterpret_cast<BuilderMsg*>(lastBuilderQueue->data + lastBuilderSize + pos);
+                if (!copiedMsg->isFlagSet(BuilderMsg::OUTPUT_BUFFER::ALLOCATED))
+                    copiedMsg->data = reinterpret_cast<uint8_t*>(copiedMsg) + sizeof(BuilderMsg);
+                pos += (sizeof(BuilderMsg) + copiedMsg->size + 7) & 0xFFFFFFFFFFFFFFF8;
+            }
+
+            {
+                t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::BUILDER_COMMIT);
+                std::unique_lock<std::mutex> const lck(mtx);
+                lastBuilderSize += workerBuilder->lastBuilderSize;
+                lastBuilderQueue->confirmedSize = lastBuilderSize;
+                condNoWriterWork.notify_all();
+            }
+            t->contextSet(Thread::CONTEXT::CPU);
+
+            workerBuilder->lastBuilderSize = 0;
+            workerBuilder->lastBuilderQueue->confirmedSize = 0;
+            return;
+        }
+
+        auto* nextBuilderQueue = reinterpret_cast<BuilderQueue*>(ctx->getMemoryChunk(t, Ctx::MEMORY::BUILDER));
+        nextBuilderQueue->id = 0;
+        nextBuilderQueue->next = nullptr;
+        nextBuilderQueue->data = reinterpret_cast<uint8_t*>(nextBuilderQueue) + sizeof(struct BuilderQueue);
+        nextBuilderQueue->confirmedSize = 0;
+        nextBuilderQueue->start = 0;
+
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::BUILDER_ROTATE);
+            std::unique_lock<std::mutex> const lck(mtx);
+            uint64_t id = lastBuilderQueue->id;
+            for (builderQueue = workerBuilder->firstBuilderQueue; builderQueue != nullptr; builderQueue = builderQueue->next)
+                builderQueue->id = ++id;
+            lastBuilderQueue->next = workerBuilder->firstBuilderQueue;
+            lastBuilderQueue = workerBuilder->lastBuilderQueue;
+            lastBuilderSize = workerBuilder->lastBuilderSize;
+            buffersAllocated += workerBuilder->buffersAllocated;
+            condNoWriterWork.notify_all();
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+
+        workerBuilder->firstBuilderQueue = nextBuilderQueue;
+        workerBuilder->lastBuilderQueue = nextBuilderQueue;
+        workerBuilder->lastBuilderSize = 0;
+        workerBuilder->buffersAllocated = 1;
+    }
+
     void Builder::releaseBuffers(Thread* t, uint64_t maxId) {
         BuilderQueue* builderQueue;
         {
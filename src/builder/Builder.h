@@ -29,6 +29,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "../common/Ctx.h"
 #include "../common/Format.h"
@@ -38,6 +39,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "../common/RedoLogRecord.h"
 #include "../common/Thread.h"
 #include "../common/exception/RedoLogException.h"
+#include "../common/expression/Condition.h"
 #include "../common/table/SysUser.h"
 #include "../common/types/Data.h"
 #include "../common/types/FileOffset.h"
@@ -56,6 +58,7 @@ namespace OpenLogReplicator {
     class BuilderProtobuf;
     class Column;
     class Ctx;
+    class DbColumn;
     class RedoLogRecord;
     class SchemaElement;
     class TransactionChunk;
@@ -126,7 +129,7 @@ namespace OpenLogReplicator {
     };
 
     // 构建器基类 - 负责构建消息
-    class Builder : public Thread {
+    class Builder : public Thread, public ExpressionRow {
     protected:
         // 常量定义
         static constexpr uint64_t FLAGS_SCHEMALESS{1};   // 无模式标志
@@ -146,7 +149,9 @@ namespace OpenLogReplicator {
         enum class FORMAT : unsigned char {
             JSON = 0,           // JSON格式
             PROTOBUF = 1,       // Protobuf格式
-            ORACLE_ORANRM_TRACE = 2 // Oracle跟踪格式
+            ORACLE_ORANRM_TRACE = 2, // Oracle跟踪格式
+            ARROW = 3,          // Arrow IPC格式
+            AVRO = 4            // Avro二进制格式
         };
 
         std::mutex mtx;         // 互斥锁
@@ -163,6 +168,48 @@ namespace OpenLogReplicator {
         BuilderJson* builderJson; // JSON构建器
         BuilderProtobuf* builderProtobuf; // Protobuf构建器
         uint64_t messagesConfirmedTotal; // 已确认消息总数
+        uint64_t streamTransactionMb{0}; // 大事务流式输出阈值，0表示禁用
+        uint64_t packBytes{0}; // 多事务打包消息大小上限，0表示禁用
+        uint64_t packLatencyUs{0}; // 打包消息最长等待时间
+        uint64_t packSize{0}; // 已打包事务的数据大小，0表示没有打开的打包消息
+        time_ut packTime{0}; // 第一个打包事务的提交时间
+        ConditionCache conditionCache; // 当前事务中只依赖事务属性的条件结果
+        const DbColumn* valueColumn{nullptr}; // 当前输出值所属的列
+
+        // 大LOB分块输出 - 行消息只包含LOB引用，数据直接从LOB页面按块输出
+        struct LobStream {
+            const LobData* lobData;
+            LobId lobId;
+            std::string columnName;
+            uint64_t size;
+            uint64_t charsetId;
+            FileOffset fileOffset;
+            bool isClob;
+            bool isSystem;
+        };
+
+        uint64_t lobStreamMb{0}; // LOB分块输出阈值及块大小，0表示禁用
+        std::vector<LobStream> lobStreams; // 当前行中等待输出的LOB
+        std::vector<std::pair<const uint8_t*, uint64_t>> lobChunkPages; // 当前块的页面数据
+
+        [[nodiscard]] static const uint8_t* getLobPage(const LobData* lobData, uint32_t pageNo, uint64_t& pageSize);
+        bool streamLob(LobCtx* lobCtx, const uint8_t* data, uint32_t size, const std::string& columnName, uint64_t charsetId, FileOffset fileOffset,
+                       bool isClob, bool isSystem);
+        void processLobStreams(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                               typeSlot slot);
+        virtual void columnLob(const std::string& columnName, const LobId& lobId, uint64_t size, uint64_t chunks) = 0;
+        virtual void processLobChunk(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                                     typeSlot slot, const LobStream& lobStream, uint64_t chunk, uint64_t chunkOffset, bool last) = 0;
+
+        // 多事务打包 - 全事务模式下连续的事务追加到同一条消息，达到大小或时间上限后发送
+        // 打包消息按最后一个事务的位置确认，检查点在打包消息发送前不输出
+        bool packBegin(Scn scn, Seq sequence);
+        void packCommit();
+        void packFlush();
+        [[nodiscard]] bool packCheckpoint(bool redo);
+
+        // 行条件表达式读取列值
+        bool columnValue(char op, typeCol column, const uint8_t*& data, uint64_t& size) const override;
         
         BuilderQueue* getBuilderQueue(Thread* t); // 获取构建队列
         virtual void bufferFree(Thread* t, uint64_t num); // 释放缓冲区
@@ -220,7 +267,15 @@ namespace OpenLogReplicator {
         // writerQueueSize: 写入器队列当前大小
         // usec: 休眠微秒数
         void sleepForWriterWork(Writer* writer, uint64_t writerQueueSize, uint64_t usec);
-        
+
+        // 将Oracle NUMBER转换为十进制文本，结果写入valueBuffer
+        // 查表按两位一组输出，整数值直接按64位整数格式化
+        void parseNumber(const uint8_t* data, uint64_t size, FileOffset fileOffset) {
+            valueSize = Data::numberToText(data, size, valueBuffer);
+            if (unlikely(valueSize == 0))
+                throw RedoLogException(50009, "error parsing numeric value at offset: " + fileOffset.toString());
+        }
+
         // 数据处理接口
         virtual void discard() = 0;
         virtual void commit() = 0;
@@ -239,6 +294,29 @@ namespace OpenLogReplicator {
         virtual void appendUpdate(TransactionChunk* transactionChunk, uint64_t bid, typeRowId rowId, const SchemaElement* schemaElement,
                                typeScn scn, const std::vector<Column*>& columns, const std::vector<Column*>& columnsOld) = 0;
         
+        // 大事务流式输出 - 未提交事务超过阈值后，以临时(provisional)消息提前输出，最终以提交或回滚消息结束
+        [[nodiscard]] uint64_t getStreamTransactionMb() const;
+        void setStreamTransactionMb(uint64_t newStreamTransactionMb);
+        virtual void processProvisional(Scn scn, Seq sequence, time_t timestamp) = 0;
+        virtual void processRollback(Scn scn, Seq sequence, time_t timestamp) = 0;
+
+        // 大LOB分块输出 - 超过阈值的LOB在行消息之后以单独的块消息输出
+        [[nodiscard]] uint64_t getLobStreamMb() const;
+        void setLobStreamMb(uint64_t newLobStreamMb);
+
+        // 多事务打包 - 小事务合并为一条消息，减少每条消息的写入开销
+        void setPackMessage(uint64_t newPackBytes, uint64_t newPackLatencyUs);
+        [[nodiscard]] uint64_t getPackBytes() const;
+        // 事务输出前调用 - 已打包的事务加上新事务超过消息大小上限时先发送打包消息，避免小事务被强制拆分
+        void packReserve(uint64_t size);
+
+        // 并行事务刷新 - 每个刷新线程使用独立的构建器，完成后按提交顺序将消息追加到主构建器队列
+        [[nodiscard]] virtual Builder* newWorkerBuilder() = 0;
+        void publish(Thread* t, Builder* workerBuilder);
+
+        // 元数据更新前调用 - 按表缓存行数据或表结构的构建器需先输出并释放，之后表定义可能被释放
+        virtual void flushTables() {}
+
         // 消息处理计数
         [[nodiscard]] uint64_t getMessagesConfirmedTotal() const;
         virtual void resetCounters();
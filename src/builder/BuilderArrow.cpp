@@ -0,0 +1,618 @@
+/* Memory buffer for handling output buffer in Arrow IPC format
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include "../common/Clock.h"
+#include "../common/DbColumn.h"
+#include "../common/DbTable.h"
+#include "../common/table/SysCol.h"
+#include "../common/types/Data.h"
+#include "../common/types/RowId.h"
+#include "BuilderArrow.h"
+
+namespace OpenLogReplicator {
+    static uint64_t pad8(uint64_t size) {
+        return (size + 7) & 0xFFFFFFFFFFFFFFF8;
+    }
+
+    BuilderArrow::BuilderArrow(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, Format& newFormat, uint64_t newFlushBuffer,
+                               uint64_t newBatchRows, uint64_t newBatchBytes, uint64_t newBatchLatencyUs) :
+            Builder(newCtx, newLocales, newMetadata, newFormat, newFlushBuffer),
+            batchRows(newBatchRows),
+            batchBytes(newBatchBytes),
+            batchLatencyUs(newBatchLatencyUs) {
+    }
+
+    BuilderArrow::~BuilderArrow() {
+        releaseBatches();
+    }
+
+    BuilderArrow::TYPE BuilderArrow::columnType(const DbColumn* column) {
+        switch (column->type) {
+            case SysCol::COLTYPE::NUMBER:
+                if (column->scale == 0 && column->precision > 0 && column->precision <= 18)
+                    return TYPE::INT64;
+                if (column->precision > 0 && column->precision <= 38 && column->scale >= 0 && column->scale <= column->precision)
+                    return TYPE::DECIMAL;
+                // Unconstrained precision or negative scale, kept as text
+                return TYPE::UTF8;
+
+            case SysCol::COLTYPE::BOOLEAN:
+                return TYPE::INT64;
+
+            case SysCol::COLTYPE::FLOAT:
+            case SysCol::COLTYPE::DOUBLE:
+                return TYPE::FLOAT64;
+
+            case SysCol::COLTYPE::DATE:
+            case SysCol::COLTYPE::TIMESTAMP:
+                return TYPE::TIMESTAMP;
+
+            case SysCol::COLTYPE::TIMESTAMP_WITH_TZ:
+            case SysCol::COLTYPE::TIMESTAMP_WITH_LOCAL_TZ:
+                return TYPE::TIMESTAMP_TZ;
+
+            case SysCol::COLTYPE::RAW:
+            case SysCol::COLTYPE::LONG_RAW:
+            case SysCol::COLTYPE::BLOB:
+            case SysCol::COLTYPE::JSON:
+                return TYPE::BINARY;
+
+            default:
+                return TYPE::UTF8;
+        }
+    }
+
+    BuilderArrow::ArrowBatch* BuilderArrow::newBatch(const DbTable* table) {
+        auto* createdBatch = new ArrowBatch;
+        createdBatch->table = table;
+        createdBatch->columns.emplace_back("op", TYPE::UTF8, 0, 0);
+        createdBatch->columns.emplace_back("scn", TYPE::UINT64, 0, 0);
+        createdBatch->columns.emplace_back("tm", TYPE::TM, 0, 0);
+        createdBatch->columns.emplace_back("xid", TYPE::UTF8, 0, 0);
+        if (format.ridFormat == Format::RID_FORMAT::TEXT)
+            createdBatch->columns.emplace_back("rid", TYPE::UTF8, 0, 0);
+
+        // Columns which are never sent are left out of the schema
+        createdBatch->columnIdx.reserve(table->columns.size());
+        for (typeCol i = 0; i < static_cast<typeCol>(table->columns.size()); ++i) {
+            const DbColumn* column = table->columns[i];
+            if (table->isColumnSkipped(i) ||
+                    (column->guard && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_GUARD_COLUMNS)) ||
+                    (column->nested && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_NESTED_COLUMNS)) ||
+                    (column->hidden && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_HIDDEN_COLUMNS)) ||
+                    (column->unused && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_UNUSED_COLUMNS))) {
+                createdBatch->columnIdx.push_back(-1);
+                continue;
+            }
+
+            createdBatch->columnIdx.push_back(static_cast<int64_t>(createdBatch->columns.size()));
+            createdBatch->columns.emplace_back(column->name, columnType(column), column->precision, column->scale);
+        }
+
+        // Update rows carry the before image in the same columns with "_before" suffix, they are null for other operations
+        createdBatch->columnBeforeIdx.reserve(table->columns.size());
+        for (typeCol i = 0; i < static_cast<typeCol>(table->columns.size()); ++i) {
+            if (createdBatch->columnIdx[i] < 0) {
+                createdBatch->columnBeforeIdx.push_back(-1);
+                continue;
+            }
+
+            const DbColumn* column = table->columns[i];
+            createdBatch->columnBeforeIdx.push_back(static_cast<int64_t>(createdBatch->columns.size()));
+            createdBatch->columns.emplace_back(column->name + "_before", columnType(column), column->precision, column->scale);
+        }
+
+        encodeSchema(createdBatch->schemaMessage, createdBatch->columns,
+                     {{"owner", table->owner}, {"table", table->name}, {"obj", std::to_string(table->obj)}});
+        return createdBatch;
+    }
+
+    void BuilderArrow::encodeSchema(std::string& message, const std::vector<ArrowColumn>& columns,
+                                    const std::vector<std::pair<std::string, std::string>>& keyValues) {
+        uint64_t offsets[3];
+        fb.assign(sizeof(uint32_t), '\0');
+        fbPatch(0, fbTable({{0, 2, METADATA_V5}, {1, 1, HEADER_SCHEMA}, {2, 0, 0}, {3, 8, 0}}, offsets));
+        const uint64_t schemaOffset = offsets[0];
+        fbPatch(schemaOffset, fbTable({{0, 2, 0}, {1, 0, 0}, {2, 0, 0}}, offsets));
+        const uint64_t fieldsOffset = offsets[0];
+        const uint64_t keyValuesOffset = offsets[1];
+
+        const uint64_t fieldsPos = fbVector(fieldsOffset, columns.size(), 4);
+        fb.append(columns.size() * sizeof(uint32_t), '\0');
+        for (uint64_t i = 0; i < columns.size(); ++i) {
+            const ArrowColumn& column = columns[i];
+            uint64_t typeId;
+            switch (column.type) {
+                case TYPE::INT64:
+                case TYPE::UINT64:
+                    typeId = TYPE_INT;
+                    break;
+
+                case TYPE::DECIMAL:
+                    typeId = TYPE_DECIMAL;
+                    break;
+
+                case TYPE::FLOAT64:
+                    typeId = TYPE_FLOATING_POINT;
+                    break;
+
+                case TYPE::TIMESTAMP:
+                case TYPE::TIMESTAMP_TZ:
+                case TYPE::TM:
+                    typeId = TYPE_TIMESTAMP;
+                    break;
+
+                case TYPE::BINARY:
+                    typeId = TYPE_BINARY;
+                    break;
+
+                default:
+                    typeId = TYPE_UTF8;
+            }
+
+            fbPatch(fieldsPos + (i * sizeof(uint32_t)), fbTable({{0, 0, 0}, {1, 1, 1}, {2, 1, typeId}, {3, 0, 0}, {5, 0, 0}}, offsets));
+            const uint64_t typeOffset = offsets[1];
+            const uint64_t childrenOffset = offsets[2];
+            fbString(offsets[0], column.name);
+
+            switch (column.type) {
+                case TYPE::INT64:
+                case TYPE::UINT64:
+                    fbPatch(typeOffset, fbTable({{0, 4, 64}, {1, 1, column.type == TYPE::INT64 ? 1U : 0U}}, offsets));
+                    break;
+
+                case TYPE::DECIMAL:
+                    fbPatch(typeOffset, fbTable({{0, 4, static_cast<uint64_t>(column.precision)}, {1, 4, static_cast<uint64_t>(column.scale)},
+                                                 {2, 4, 128}}, offsets));
+                    break;
+
+                case TYPE::FLOAT64:
+                    fbPatch(typeOffset, fbTable({{0, 2, PRECISION_DOUBLE}}, offsets));
+                    break;
+
+                case TYPE::TIMESTAMP:
+                    fbPatch(typeOffset, fbTable({{0, 2, UNIT_MICROSECOND}}, offsets));
+                    break;
+
+                case TYPE::TIMESTAMP_TZ:
+                case TYPE::TM:
+                    fbPatch(typeOffset, fbTable({{0, 2, column.type == TYPE::TM ? UNIT_SECOND : UNIT_MICROSECOND}, {1, 0, 0}}, offsets));
+                    fbString(offsets[0], "UTC");
+                    break;
+
+                default:
+                    fbPatch(typeOffset, fbTable({}, offsets));
+            }
+            fbVector(childrenOffset, 0, 4);
+        }
+
+        const uint64_t keyValuesPos = fbVector(keyValuesOffset, keyValues.size(), 4);
+        fb.append(keyValues.size() * sizeof(uint32_t), '\0');
+        for (uint64_t i = 0; i < keyValues.size(); ++i) {
+            fbPatch(keyValuesPos + (i * sizeof(uint32_t)), fbTable({{0, 0, 0}, {1, 0, 0}}, offsets));
+            const uint64_t valueOffset = offsets[1];
+            fbString(offsets[0], keyValues[i].first);
+            fbString(valueOffset, keyValues[i].second);
+        }
+        fbAlign(8);
+
+        uint8_t prefix[8];
+        Ctx::write32Little(prefix, CONTINUATION);
+        Ctx::write32Little(prefix + 4, fb.size());
+        message.assign(reinterpret_cast<const char*>(prefix), sizeof(prefix));
+        message.append(fb);
+    }
+
+    void BuilderArrow::appendSchemaMessage(Scn scn, Seq sequence, typeObj obj, BuilderMsg::OUTPUT_BUFFER outputFlags,
+                                           const std::vector<std::pair<std::string, std::string>>& keyValues) {
+        std::string message;
+        encodeSchema(message, {}, keyValues);
+
+        uint8_t eos[8];
+        Ctx::write32Little(eos, CONTINUATION);
+        Ctx::write32Little(eos + 4, 0);
+        builderBegin(scn, sequence, obj, outputFlags);
+        appendArr(message.data(), message.length());
+        appendArr(reinterpret_cast<const char*>(eos), sizeof(eos));
+        builderCommit();
+    }
+
+    void BuilderArrow::appendRowBegin(const DbTable* table, Scn scn, Seq sequence, time_t timestamp, const char* op, typeDataObj dataObj,
+                                      typeDba bdba, typeSlot slot) {
+        if (unlikely(schemaScn != metadata->schema->scn)) {
+            flushTables();
+            schemaScn = metadata->schema->scn;
+        }
+
+        if (batch == nullptr || batch->table != table) {
+            auto it = batches.find(table);
+            if (it != batches.end()) {
+                batch = it->second;
+            } else {
+                batch = newBatch(table);
+                batches.insert_or_assign(table, batch);
+                batchList.push_back(batch);
+            }
+        }
+
+        if (pendingRows == 0)
+            pendingTime = ctx->clock->getTimeUt();
+        batch->scn = scn;
+        batch->sequence = sequence;
+
+        appendVariable(batch->columns[FIELD_OP], op, 1);
+        appendFixed(batch->columns[FIELD_SCN], scn.getData());
+        appendFixed(batch->columns[FIELD_TM], static_cast<uint64_t>(timestamp));
+        appendVariable(batch->columns[FIELD_XID], xidText.data(), xidText.length());
+        if (format.ridFormat == Format::RID_FORMAT::TEXT) {
+            const RowId rowId(dataObj, bdba, slot);
+            char str[RowId::SIZE + 1];
+            rowId.toString(str);
+            appendVariable(batch->columns[FIELD_RID], str, RowId::SIZE);
+        }
+    }
+
+    void BuilderArrow::appendRowEnd() {
+        for (ArrowColumn& column: batch->columns) {
+            if (column.length == batch->rows)
+                appendNull(column);
+        }
+        ++batch->rows;
+        ++pendingRows;
+
+        if (batch->rows >= batchRows || batch->bytes >= batchBytes)
+            flushBatches();
+    }
+
+    void BuilderArrow::flushBatch(ArrowBatch* flushedBatch) {
+        // Every column has a validity buffer followed by values, or by offsets and data; buffers are padded to 8 bytes
+        uint64_t bodyLength = 0;
+        uint64_t buffersCount = 0;
+        for (const ArrowColumn& column: flushedBatch->columns) {
+            if (column.nulls > 0)
+                bodyLength += pad8(column.validity.size());
+            if (column.isVariable()) {
+                bodyLength += pad8(column.offsets.size()) + pad8(column.values.size());
+                buffersCount += 3;
+            } else {
+                bodyLength += pad8(column.values.size());
+                buffersCount += 2;
+            }
+        }
+
+        uint64_t offsets[2];
+        fb.assign(sizeof(uint32_t), '\0');
+        fbPatch(0, fbTable({{0, 2, METADATA_V5}, {1, 1, HEADER_RECORD_BATCH}, {2, 0, 0}, {3, 8, bodyLength}}, offsets));
+        const uint64_t recordBatchOffset = offsets[0];
+        fbPatch(recordBatchOffset, fbTable({{0, 8, flushedBatch->rows}, {1, 0, 0}, {2, 0, 0}}, offsets));
+        const uint64_t nodesOffset = offsets[0];
+        const uint64_t buffersOffset = offsets[1];
+
+        fbVector(nodesOffset, flushedBatch->columns.size(), 8);
+        for (const ArrowColumn& column: flushedBatch->columns) {
+            fbPut(column.length);
+            fbPut(column.nulls);
+        }
+
+        fbVector(buffersOffset, buffersCount, 8);
+        uint64_t bodyOffset = 0;
+        for (const ArrowColumn& column: flushedBatch->columns) {
+            const uint64_t validitySize = column.nulls > 0 ? column.validity.size() : 0;
+            fbPut(bodyOffset);
+            fbPut(validitySize);
+            bodyOffset += pad8(validitySize);
+            if (column.isVariable()) {
+                fbPut(bodyOffset);
+                fbPut(static_cast<uint64_t>(column.offsets.size()));
+                bodyOffset += pad8(column.offsets.size());
+            }
+            fbPut(bodyOffset);
+            fbPut(static_cast<uint64_t>(column.values.size()));
+            bodyOffset += pad8(column.values.size());
+        }
+        fbAlign(8);
+
+        uint8_t prefix[8];
+        Ctx::write32Little(prefix, CONTINUATION);
+        Ctx::write32Little(prefix + 4, fb.size());
+
+        builderBegin(flushedBatch->scn, flushedBatch->sequence, flushedBatch->table->obj, BuilderMsg::OUTPUT_BUFFER::NONE);
+        appendArr(flushedBatch->schemaMessage.data(), flushedBatch->schemaMessage.length());
+        appendArr(reinterpret_cast<const char*>(prefix), sizeof(prefix));
+        appendArr(fb.data(), fb.length());
+
+        static constexpr char padding[8] {};
+        for (ArrowColumn& column: flushedBatch->columns) {
+            if (column.nulls > 0) {
+                appendArr(reinterpret_cast<const char*>(column.validity.data()), column.validity.size());
+                appendArr(padding, pad8(column.validity.size()) - column.validity.size());
+            }
+            if (column.isVariable()) {
+                appendArr(reinterpret_cast<const char*>(column.offsets.data()), column.offsets.size());
+                appendArr(padding, pad8(column.offsets.size()) - column.offsets.size());
+            }
+            appendArr(reinterpret_cast<const char*>(column.values.data()), column.values.size());
+            appendArr(padding, pad8(column.values.size()) - column.values.size());
+
+            column.length = 0;
+            column.nulls = 0;
+            column.validity.clear();
+            column.values.clear();
+            if (column.isVariable())
+                column.offsets.resize(sizeof(uint32_t));
+        }
+
+        Ctx::write32Little(prefix + 4, 0);
+        appendArr(reinterpret_cast<const char*>(prefix), sizeof(prefix));
+        builderCommit();
+
+        flushedBatch->rows = 0;
+        flushedBatch->bytes = 0;
+    }
+
+    void BuilderArrow::flushBatches() {
+        // All tables are sent together, so that a confirmed message never leaves rows of other tables behind
+        for (ArrowBatch* pendingBatch: batchList) {
+            if (pendingBatch->rows > 0)
+                flushBatch(pendingBatch);
+        }
+        pendingRows = 0;
+    }
+
+    void BuilderArrow::releaseBatches() {
+        for (ArrowBatch* releasedBatch: batchList)
+            delete releasedBatch;
+        batchList.clear();
+        batches.clear();
+        batch = nullptr;
+    }
+
+    void BuilderArrow::flushTables() {
+        flushBatches();
+        releaseBatches();
+    }
+
+    void BuilderArrow::columnFloat(const std::string& columnName __attribute__((unused)), double value) {
+        ArrowColumn* column = valueTarget();
+        if (column == nullptr || column->type != TYPE::FLOAT64)
+            return;
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        appendFixed(*column, bits);
+    }
+
+    void BuilderArrow::columnDouble(const std::string& columnName, long double value) {
+        columnFloat(columnName, static_cast<double>(value));
+    }
+
+    void BuilderArrow::columnString(const std::string& columnName __attribute__((unused))) {
+        ArrowColumn* column = valueTarget();
+        if (column == nullptr || !column->isVariable())
+            return;
+        appendVariable(*column, valueBuffer, valueSize);
+    }
+
+    void BuilderArrow::columnNumber(const std::string& columnName, int precision __attribute__((unused)), int scale __attribute__((unused))) {
+        ArrowColumn* column = valueTarget();
+        if (column == nullptr)
+            return;
+
+        switch (column->type) {
+            case TYPE::INT64: {
+                const bool minus = valueSize > 0 && valueBuffer[0] == '-';
+                uint64_t value = 0;
+                for (uint64_t i = minus ? 1 : 0; i < valueSize && valueBuffer[i] != '.'; ++i)
+                    value = (value * 10) + static_cast<uint>(valueBuffer[i] - '0');
+                appendFixed(*column, minus ? ~value + 1 : value);
+                break;
+            }
+
+            case TYPE::DECIMAL: {
+                typeUInt128 value;
+                if (Data::decimalToUnscaled(valueBuffer, valueSize, column->precision, column->scale, value))
+                    appendFixed(*column, static_cast<uint64_t>(value), static_cast<uint64_t>(value >> 64));
+                else
+                    ctx->warning(60041, "value: " + std::string(valueBuffer, valueSize) + " of column: " + columnName + " doesn't fit in decimal(" +
+                                        std::to_string(column->precision) + ", " + std::to_string(column->scale) + "), sent as null");
+                break;
+            }
+
+            case TYPE::FLOAT64: {
+                valueBuffer[valueSize] = 0;
+                char* retPtr;
+                const double value = strtod(valueBuffer, &retPtr);
+                uint64_t bits;
+                memcpy(&bits, &value, sizeof(bits));
+                appendFixed(*column, bits);
+                break;
+            }
+
+            case TYPE::UTF8:
+            case TYPE::BINARY:
+                appendVariable(*column, valueBuffer, valueSize);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void BuilderArrow::columnRaw(const std::string& columnName __attribute__((unused)), const uint8_t* data, uint64_t size) {
+        ArrowColumn* column = valueTarget();
+        if (column == nullptr || column->type != TYPE::BINARY)
+            return;
+        appendVariable(*column, reinterpret_cast<const char*>(data), size);
+    }
+
+    void BuilderArrow::columnRowId(const std::string& columnName __attribute__((unused)), RowId rowId) {
+        ArrowColumn* column = valueTarget();
+        if (column == nullptr || column->type != TYPE::UTF8)
+            return;
+        char str[RowId::SIZE + 1];
+        rowId.toString(str);
+        appendVariable(*column, str, RowId::SIZE);
+    }
+
+    void BuilderArrow::columnTimestamp(const std::string& columnName __attribute__((unused)), time_t timestamp, uint64_t fraction) {
+        ArrowColumn* column = valueTarget();
+        if (column == nullptr || (column->type != TYPE::TIMESTAMP && column->type != TYPE::TIMESTAMP_TZ))
+            return;
+        appendFixed(*column, static_cast<uint64_t>((timestamp * 1000000) + static_cast<time_t>(fraction / 1000)));
+    }
+
+    void BuilderArrow::columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction,
+                                         const std::string_view& tz __attribute__((unused))) {
+        columnTimestamp(columnName, timestamp, fraction);
+    }
+
+    void BuilderArrow::columnLob(const std::string& columnName __attribute__((unused)), const LobId& lobId __attribute__((unused)),
+                                 uint64_t size __attribute__((unused)), uint64_t chunks __attribute__((unused))) {
+        // LOB streaming is not used with this format
+    }
+
+    void BuilderArrow::processBeginMessage(Scn scn __attribute__((unused)), Seq sequence __attribute__((unused)),
+                                           time_t timestamp __attribute__((unused))) {
+        newTran = false;
+        xidText = lastXid.toString();
+    }
+
+    void BuilderArrow::processLobChunk(Scn scn __attribute__((unused)), Seq sequence __attribute__((unused)), time_t timestamp __attribute__((unused)),
+                                       const DbTable* table __attribute__((unused)), typeObj obj __attribute__((unused)),
+                                       typeDataObj dataObj __attribute__((unused)), typeDba bdba __attribute__((unused)),
+                                       typeSlot slot __attribute__((unused)), const LobStream& lobStream __attribute__((unused)),
+                                       uint64_t chunk __attribute__((unused)), uint64_t chunkOffset __attribute__((unused)),
+                                       bool last __attribute__((unused))) {
+        // LOB streaming is not used with this format
+    }
+
+    void BuilderArrow::processInsert(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table,
+                                     typeObj obj __attribute__((unused)), typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) {
+        if (newTran)
+            processBeginMessage(scn, sequence, timestamp);
+
+        appendRowBegin(table, scn, sequence, timestamp, "c", dataObj, bdba, slot);
+        appendImage(lobCtx, xmlCtx, table, fileOffset, Format::VALUE_TYPE::AFTER, false);
+        appendRowEnd();
+        ++num;
+    }
+
+    void BuilderArrow::processUpdate(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table,
+                                     typeObj obj __attribute__((unused)), typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) {
+        if (newTran)
+            processBeginMessage(scn, sequence, timestamp);
+
+        appendRowBegin(table, scn, sequence, timestamp, "u", dataObj, bdba, slot);
+        appendImage(lobCtx, xmlCtx, table, fileOffset, Format::VALUE_TYPE::AFTER, false);
+        appendImage(lobCtx, xmlCtx, table, fileOffset, Format::VALUE_TYPE::BEFORE, true);
+        appendRowEnd();
+        ++num;
+    }
+
+    void BuilderArrow::processDelete(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table,
+                                     typeObj obj __attribute__((unused)), typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) {
+        if (newTran)
+            processBeginMessage(scn, sequence, timestamp);
+
+        appendRowBegin(table, scn, sequence, timestamp, "d", dataObj, bdba, slot);
+        appendImage(lobCtx, xmlCtx, table, fileOffset, Format::VALUE_TYPE::BEFORE, false);
+        appendRowEnd();
+        ++num;
+    }
+
+    void BuilderArrow::processDdl(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj) {
+        if (newTran)
+            processBeginMessage(scn, sequence, timestamp);
+        flushBatches();
+
+        std::vector<std::pair<std::string, std::string>> keyValues {{"op", "ddl"}, {"scn", std::to_string(scn.getData())},
+                                                                    {"tm", std::to_string(timestamp)}, {"xid", xidText}};
+        if (table != nullptr) {
+            keyValues.emplace_back("owner", table->owner);
+            keyValues.emplace_back("table", table->name);
+        }
+        keyValues.emplace_back("obj", std::to_string(obj));
+
+        std::string sql;
+        for (uint8_t* chunk = ddlFirst; chunk != nullptr; chunk = *reinterpret_cast<uint8_t**>(chunk)) {
+            const typeTransactionSize* chunkSize = reinterpret_cast<typeTransactionSize*>(chunk + sizeof(uint8_t*));
+            sql.append(reinterpret_cast<const char*>(chunk + sizeof(uint8_t*) + sizeof(uint64_t)), *chunkSize);
+        }
+        keyValues.emplace_back("sql", sql);
+
+        appendSchemaMessage(scn, sequence, obj, BuilderMsg::OUTPUT_BUFFER::NONE, keyValues);
+        ++num;
+    }
+
+    void BuilderArrow::processCommit(Scn scn __attribute__((unused)), Seq sequence __attribute__((unused)), time_t timestamp __attribute__((unused))) {
+        // Skip empty transaction
+        if (newTran) {
+            newTran = false;
+            return;
+        }
+
+        if (pendingRows > 0 && (worker || ctx->clock->getTimeUt() - pendingTime >= static_cast<time_ut>(batchLatencyUs)))
+            flushBatches();
+        num = 0;
+    }
+
+    void BuilderArrow::processProvisional(Scn scn __attribute__((unused)), Seq sequence __attribute__((unused)), time_t timestamp __attribute__((unused))) {
+        // Transaction streaming is not used with this format
+        newTran = false;
+        num = 0;
+    }
+
+    void BuilderArrow::processRollback(Scn scn __attribute__((unused)), Seq sequence __attribute__((unused)), time_t timestamp __attribute__((unused))) {
+        // Transaction streaming is not used with this format
+        newTran = false;
+        num = 0;
+    }
+
+    void BuilderArrow::processCheckpoint(Scn scn, Seq sequence, time_t timestamp, FileOffset fileOffset, bool redo) {
+        if (lwnScn != scn) {
+            lwnScn = scn;
+            lwnIdx = 0;
+        }
+
+        // The checkpoint is not sent before pending rows, otherwise the writer could confirm the position before they are sent
+        if (pendingRows > 0) {
+            if (!redo && !ctx->softShutdown && ctx->clock->getTimeUt() - pendingTime < static_cast<time_ut>(batchLatencyUs))
+                return;
+            flushBatches();
+        }
+
+        BuilderMsg::OUTPUT_BUFFER flags = BuilderMsg::OUTPUT_BUFFER::CHECKPOINT;
+        if (redo)
+            flags = static_cast<BuilderMsg::OUTPUT_BUFFER>(static_cast<uint>(flags) | static_cast<uint>(BuilderMsg::OUTPUT_BUFFER::REDO));
+
+        std::vector<std::pair<std::string, std::string>> keyValues {{"op", "chkpt"}, {"scn", std::to_string(scn.getData())},
+                                                                    {"tm", std::to_string(timestamp)}, {"seq", std::to_string(sequence.getData())},
+                                                                    {"offset", std::to_string(fileOffset.getData())}};
+        if (redo)
+            keyValues.emplace_back("redo", "true");
+        appendSchemaMessage(scn, sequence, 0, flags, keyValues);
+    }
+
+    Builder* BuilderArrow::newWorkerBuilder() {
+        auto* workerBuilder = new BuilderArrow(ctx, locales, metadata, format, flushBuffer, batchRows, batchBytes, batchLatencyUs);
+        workerBuilder->worker = true;
+        workerBuilder->setMaxMessageMb(maxMessageMb);
+        workerBuilder->initialize();
+        return workerBuilder;
+    }
+}
@@ -0,0 +1,358 @@
+/* Header for BuilderArrow class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef BUILDER_ARROW_H_
+#define BUILDER_ARROW_H_
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../common/DbTable.h"
+#include "../metadata/Metadata.h"
+#include "../metadata/Schema.h"
+#include "Builder.h"
+
+namespace OpenLogReplicator {
+
+    // Rows are collected per table in Arrow columnar layout, every batch is sent as a separate Arrow IPC stream: schema, record batch, end of stream
+    class BuilderArrow final : public Builder {
+    protected:
+        // Values from format/Message.fbs and format/Schema.fbs
+        static constexpr uint64_t METADATA_V5{4};
+        static constexpr uint64_t HEADER_SCHEMA{1};
+        static constexpr uint64_t HEADER_RECORD_BATCH{3};
+        static constexpr uint64_t TYPE_INT{2};
+        static constexpr uint64_t TYPE_FLOATING_POINT{3};
+        static constexpr uint64_t TYPE_BINARY{4};
+        static constexpr uint64_t TYPE_UTF8{5};
+        static constexpr uint64_t TYPE_DECIMAL{7};
+        static constexpr uint64_t TYPE_TIMESTAMP{10};
+        static constexpr uint64_t PRECISION_DOUBLE{2};
+        static constexpr uint64_t UNIT_SECOND{0};
+        static constexpr uint64_t UNIT_MICROSECOND{2};
+        static constexpr uint32_t CONTINUATION{0xFFFFFFFF};
+
+        // Metadata columns present in every batch before table columns
+        static constexpr uint64_t FIELD_OP{0};
+        static constexpr uint64_t FIELD_SCN{1};
+        static constexpr uint64_t FIELD_TM{2};
+        static constexpr uint64_t FIELD_XID{3};
+        static constexpr uint64_t FIELD_RID{4};
+
+        enum class TYPE : unsigned char {
+            INT64, UINT64, DECIMAL, FLOAT64, TIMESTAMP, TIMESTAMP_TZ, TM, UTF8, BINARY
+        };
+
+        struct ArrowColumn {
+            std::string name;
+            TYPE type;
+            int precision;
+            int scale;
+            uint64_t length{0};
+            uint64_t nulls{0};
+            std::vector<uint8_t> validity;
+            // Fixed size values, or data of variable size values
+            std::vector<uint8_t> values;
+            // Variable size values: int32 offsets to data, one more than values
+            std::vector<uint8_t> offsets;
+
+            ArrowColumn(std::string newName, TYPE newType, int newPrecision, int newScale) :
+                    name(std::move(newName)),
+                    type(newType),
+                    precision(newPrecision),
+                    scale(newScale) {
+                if (isVariable())
+                    offsets.resize(sizeof(uint32_t), 0);
+            }
+
+            [[nodiscard]] bool isVariable() const {
+                return type == TYPE::UTF8 || type == TYPE::BINARY;
+            }
+
+            [[nodiscard]] uint64_t width() const {
+                return type == TYPE::DECIMAL ? 16 : 8;
+            }
+        };
+
+        struct ArrowBatch {
+            const DbTable* table;
+            // Encoded schema message, sent in front of every record batch
+            std::string schemaMessage;
+            std::vector<ArrowColumn> columns;
+            // Position in columns for every column of the table, -1 when the column is not sent
+            std::vector<int64_t> columnIdx;
+            // Position of the "_before" column with the before image of an update
+            std::vector<int64_t> columnBeforeIdx;
+            uint64_t rows{0};
+            uint64_t bytes{0};
+            Scn scn{Scn::none()};
+            Seq sequence{Seq::none()};
+        };
+
+        uint64_t batchRows;
+        uint64_t batchBytes;
+        uint64_t batchLatencyUs;
+        // Worker builders are published per transaction, so they can't keep rows after commit
+        bool worker{false};
+        std::unordered_map<const DbTable*, ArrowBatch*> batches;
+        std::vector<ArrowBatch*> batchList;
+        ArrowBatch* batch{nullptr};
+        // Schema version of the batches, worker builders don't get flushTables() and check it on every row
+        Scn schemaScn{Scn::none()};
+        typeCol valueCol{0};
+        bool valueBefore{false};
+        uint64_t pendingRows{0};
+        time_ut pendingTime{0};
+        std::string xidText;
+        std::string fb;
+
+        // FlatBuffers metadata is written front to back, offsets to child objects are patched when the child is written
+        struct FbField {
+            uint16_t slot;
+            // 0 for an offset to a child object
+            uint8_t size;
+            uint64_t value;
+        };
+
+        template<typename T>
+        void fbPut(T value) {
+            uint8_t buffer[sizeof(T)];
+            if constexpr (sizeof(T) == 1)
+                buffer[0] = value;
+            else if constexpr (sizeof(T) == 2)
+                Ctx::write16Little(buffer, value);
+            else if constexpr (sizeof(T) == 4)
+                Ctx::write32Little(buffer, value);
+            else
+                Ctx::write64Little(buffer, value);
+            fb.append(reinterpret_cast<const char*>(buffer), sizeof(T));
+        }
+
+        void fbAlign(uint64_t alignment, uint64_t shift = 0) {
+            while ((fb.size() + shift) % alignment != 0)
+                fb.push_back('\0');
+        }
+
+        void fbPatch(uint64_t pos, uint64_t target) {
+            Ctx::write32Little(reinterpret_cast<uint8_t*>(fb.data() + pos), static_cast<uint32_t>(target - pos));
+        }
+
+        // Fields are placed from the widest, positions of offset fields are returned in the order of the list
+        uint64_t fbTable(std::initializer_list<FbField> fields, uint64_t* offsets) {
+            uint16_t slots = 0;
+            bool wide = false;
+            for (const FbField& field: fields) {
+                slots = std::max(slots, static_cast<uint16_t>(field.slot + 1));
+                if (field.size == 8)
+                    wide = true;
+            }
+
+            uint16_t fieldPos[8] {};
+            uint16_t tableSize = sizeof(int32_t);
+            for (const uint8_t width: {8, 4, 2, 1}) {
+                for (const FbField& field: fields) {
+                    if ((field.size == 0 ? 4 : field.size) != width)
+                        continue;
+                    fieldPos[field.slot] = tableSize;
+                    tableSize += width;
+                }
+            }
+
+            const uint64_t vtableSize = 4 + (2 * slots);
+            if (wide)
+                fbAlign(8, vtableSize + 4);
+            else
+                fbAlign(4, vtableSize);
+            const uint64_t vtablePos = fb.size();
+            fbPut(static_cast<uint16_t>(vtableSize));
+            fbPut(tableSize);
+            for (uint16_t slot = 0; slot < slots; ++slot)
+                fbPut<uint16_t>(fieldPos[slot]);
+
+            const uint64_t tablePos = fb.size();
+            fbPut<int32_t>(static_cast<int32_t>(tablePos - vtablePos));
+            for (const uint8_t width: {8, 4, 2, 1}) {
+                uint64_t offsetNum = 0;
+                for (const FbField& field: fields) {
+                    if (field.size == 0)
+                        ++offsetNum;
+                    if ((field.size == 0 ? 4 : field.size) != width)
+                        continue;
+
+                    switch (field.size) {
+                        case 0:
+                            offsets[offsetNum - 1] = fb.size();
+                            fbPut<uint32_t>(0);
+                            break;
+                        case 1:
+                            fbPut(static_cast<uint8_t>(field.value));
+                            break;
+                        case 2:
+                            fbPut(static_cast<uint16_t>(field.value));
+                            break;
+                        case 4:
+                            fbPut(static_cast<uint32_t>(field.value));
+                            break;
+                        default:
+                            fbPut<uint64_t>(field.value);
+                    }
+                }
+            }
+            return tablePos;
+        }
+
+        void fbString(uint64_t offset, const std::string& str) {
+            fbAlign(4);
+            fbPatch(offset, fb.size());
+            fbPut(static_cast<uint32_t>(str.length()));
+            fb.append(str);
+            fb.push_back('\0');
+        }
+
+        // Returns position of the first element
+        uint64_t fbVector(uint64_t offset, uint64_t count, uint64_t alignment) {
+            fbAlign(alignment, 4);
+            fbPatch(offset, fb.size());
+            fbPut(static_cast<uint32_t>(count));
+            return fb.size();
+        }
+
+        static void appendBit(ArrowColumn& column, bool valid) {
+            if ((column.length & 7) == 0)
+                column.validity.push_back(0);
+            if (valid)
+                column.validity.back() |= static_cast<uint8_t>(1 << (column.length & 7));
+            else
+                ++column.nulls;
+            ++column.length;
+        }
+
+        void appendNull(ArrowColumn& column) {
+            if (column.isVariable()) {
+                const uint64_t pos = column.offsets.size();
+                column.offsets.resize(pos + sizeof(uint32_t));
+                memcpy(column.offsets.data() + pos, column.offsets.data() + pos - sizeof(uint32_t), sizeof(uint32_t));
+            } else
+                column.values.resize(column.values.size() + column.width(), 0);
+            appendBit(column, false);
+        }
+
+        void appendFixed(ArrowColumn& column, uint64_t value, uint64_t valueHigh = 0) {
+            const uint64_t pos = column.values.size();
+            column.values.resize(pos + column.width());
+            Ctx::write64Little(column.values.data() + pos, value);
+            if (column.type == TYPE::DECIMAL)
+                Ctx::write64Little(column.values.data() + pos + 8, valueHigh);
+            batch->bytes += column.width();
+            appendBit(column, true);
+        }
+
+        void appendVariable(ArrowColumn& column, const char* data, uint64_t size) {
+            column.values.insert(column.values.end(), data, data + size);
+            const uint64_t pos = column.offsets.size();
+            column.offsets.resize(pos + sizeof(uint32_t));
+            Ctx::write32Little(column.offsets.data() + pos, static_cast<uint32_t>(column.values.size()));
+            batch->bytes += size + sizeof(uint32_t);
+            appendBit(column, true);
+        }
+
+        // Column of the table which is being processed, nullptr when not sent or already set in this row
+        ArrowColumn* valueTarget() {
+            if (unlikely(batch == nullptr || valueColumn == nullptr || valueCol >= static_cast<typeCol>(batch->columnIdx.size())))
+                return nullptr;
+            const int64_t idx = valueBefore ? batch->columnBeforeIdx[valueCol] : batch->columnIdx[valueCol];
+            if (idx < 0 || batch->columns[idx].length > batch->rows)
+                return nullptr;
+            return &batch->columns[idx];
+        }
+
+        // The before image of an update is written to the "_before" columns, otherwise to the table columns
+        void appendImage(LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, FileOffset fileOffset, Format::VALUE_TYPE valueType,
+                         bool beforeColumns) {
+            valueBefore = beforeColumns;
+            const uint type = static_cast<uint>(valueType);
+            const bool after = valueType == Format::VALUE_TYPE::AFTER;
+            const bool compressed = after ? compressedAfter : compressedBefore;
+            const typeCol baseMax = valuesMax >> 6;
+            for (typeCol base = 0; base <= baseMax; ++base) {
+                const auto columnBase = static_cast<typeCol>(base << 6);
+                typeMask set = valuesSet[base];
+                while (set != 0) {
+                    const typeCol pos = ffsll(set) - 1;
+                    set &= ~(1ULL << pos);
+                    const typeCol column = columnBase + pos;
+
+                    // Missing and null values are filled with nulls at the end of the row
+                    if (values[column][type] != nullptr && sizes[column][type] > 0) {
+                        valueCol = column;
+                        processValue(lobCtx, xmlCtx, table, column, values[column][type], sizes[column][type], fileOffset, after, compressed);
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] static TYPE columnType(const DbColumn* column);
+        [[nodiscard]] ArrowBatch* newBatch(const DbTable* table);
+        void encodeSchema(std::string& message, const std::vector<ArrowColumn>& columns, const std::vector<std::pair<std::string, std::string>>& keyValues);
+        void appendSchemaMessage(Scn scn, Seq sequence, typeObj obj, BuilderMsg::OUTPUT_BUFFER outputFlags,
+                                 const std::vector<std::pair<std::string, std::string>>& keyValues);
+        void appendRowBegin(const DbTable* table, Scn scn, Seq sequence, time_t timestamp, const char* op, typeDataObj dataObj, typeDba bdba,
+                            typeSlot slot);
+        void appendRowEnd();
+        void flushBatch(ArrowBatch* flushedBatch);
+        void flushBatches();
+        void releaseBatches();
+
+        void columnFloat(const std::string& columnName, double value) override;
+        void columnDouble(const std::string& columnName, long double value) override;
+        void columnString(const std::string& columnName) override;
+        void columnNumber(const std::string& columnName, int precision, int scale) override;
+        void columnRaw(const std::string& columnName, const uint8_t* data, uint64_t size) override;
+        void columnRowId(const std::string& columnName, RowId rowId) override;
+        void columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) override;
+        void columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction, const std::string_view& tz) override;
+        void columnLob(const std::string& columnName, const LobId& lobId, uint64_t size, uint64_t chunks) override;
+        void processInsert(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                           typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
+        void processUpdate(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                           typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
+        void processDelete(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                           typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
+        void processDdl(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj) override;
+        void processBeginMessage(Scn scn, Seq sequence, time_t timestamp) override;
+        void processLobChunk(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                             typeSlot slot, const LobStream& lobStream, uint64_t chunk, uint64_t chunkOffset, bool last) override;
+
+    public:
+        BuilderArrow(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, Format& newFormat, uint64_t newFlushBuffer, uint64_t newBatchRows,
+                     uint64_t newBatchBytes, uint64_t newBatchLatencyUs);
+        ~BuilderArrow() override;
+
+        void processCommit(Scn scn, Seq sequence, time_t timestamp) override;
+        void processProvisional(Scn scn, Seq sequence, time_t timestamp) override;
+        void processRollback(Scn scn, Seq sequence, time_t timestamp) override;
+        void processCheckpoint(Scn scn, Seq sequence, time_t timestamp, FileOffset fileOffset, bool redo) override;
+        void flushTables() override;
+        [[nodiscard]] Builder* newWorkerBuilder() override;
+    };
+}
+
+#endif
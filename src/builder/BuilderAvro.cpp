@@ -0,0 +1,658 @@
+/* Memory buffer for handling output buffer in Avro format
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include "../common/DbColumn.h"
+#include "../common/DbTable.h"
+#include "../common/exception/RuntimeException.h"
+#include "../common/table/SysCol.h"
+#include "../common/types/Data.h"
+#include "../common/types/RowId.h"
+#include "BuilderAvro.h"
+
+namespace OpenLogReplicator {
+    // CRC-64-AVRO lookup table for one byte
+    static constexpr std::array<uint64_t, 256> fingerprintTable() {
+        std::array<uint64_t, 256> table{};
+        for (uint64_t i = 0; i < 256; ++i) {
+            uint64_t value = i;
+            for (int j = 0; j < 8; ++j)
+                value = (value >> 1) ^ (0xC15D213AA4D7A795 & (0 - (value & 1)));
+            table[i] = value;
+        }
+        return table;
+    }
+
+    static constexpr std::array<uint64_t, 256> FINGERPRINT_TABLE = fingerprintTable();
+
+    BuilderAvro::BuilderAvro(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, Format& newFormat, uint64_t newFlushBuffer,
+                             std::string newRegistryPath, BuilderAvro* newRegistry) :
+            Builder(newCtx, newLocales, newMetadata, newFormat, newFlushBuffer),
+            registryPath(std::move(newRegistryPath)),
+            registry(newRegistry != nullptr ? newRegistry : this) {
+        std::string json(R"({"type":"record","name":"Control","namespace":"OpenLogReplicator","fields":[)");
+        std::string canonical(R"({"name":"OpenLogReplicator.Control","type":"record","fields":[)");
+        appendSchemaField(json, canonical, "op", TYPE::STRING, 0, 0, false);
+        appendSchemaField(json, canonical, "scn", TYPE::LONG, 0, 0, false);
+        appendSchemaField(json, canonical, "tm", TYPE::TIMESTAMP, 0, 0, false);
+        appendSchemaField(json, canonical, "xid", TYPE::STRING, 0, 0, true);
+        appendSchemaField(json, canonical, "seq", TYPE::LONG, 0, 0, true);
+        appendSchemaField(json, canonical, "offset", TYPE::LONG, 0, 0, true);
+        appendSchemaField(json, canonical, "redo", TYPE::BOOLEAN, 0, 0, true);
+        appendSchemaField(json, canonical, "owner", TYPE::STRING, 0, 0, true);
+        appendSchemaField(json, canonical, "table", TYPE::STRING, 0, 0, true);
+        appendSchemaField(json, canonical, "obj", TYPE::LONG, 0, 0, true);
+        appendSchemaField(json, canonical, "ddl", TYPE::STRING, 0, 0, true);
+        json.append("]}");
+        canonical.append("]}");
+        controlFingerprint = fingerprint(canonical);
+
+        if (registry != this)
+            return;
+
+        // Schemas which are already present in the registry file are not appended again
+        std::ifstream inputStream;
+        inputStream.open(registryPath.c_str(), std::ios::in);
+        if (inputStream.is_open()) {
+            std::string line;
+            while (std::getline(inputStream, line)) {
+                if (line.length() > 16 && line[16] == ' ')
+                    registered.insert(strtoull(line.substr(0, 16).c_str(), nullptr, 16));
+            }
+            inputStream.close();
+        }
+        registerSchema(controlFingerprint, json);
+    }
+
+    BuilderAvro::~BuilderAvro() {
+        flushTables();
+    }
+
+    uint64_t BuilderAvro::fingerprint(const std::string& canonical) {
+        uint64_t value = FINGERPRINT_EMPTY;
+        for (const char character: canonical)
+            value = (value >> 8) ^ FINGERPRINT_TABLE[(value ^ static_cast<uint8_t>(character)) & 0xFF];
+        return value;
+    }
+
+    // Avro names are limited to [A-Za-z_][A-Za-z0-9_]*, other characters are replaced with '_'
+    std::string BuilderAvro::fieldName(const std::string& name) {
+        std::string result;
+        result.reserve(name.length() + 1);
+        if (name.empty() || (name[0] >= '0' && name[0] <= '9'))
+            result.push_back('_');
+        for (const char character: name) {
+            if ((character >= 'A' && character <= 'Z') || (character >= 'a' && character <= 'z') || (character >= '0' && character <= '9'))
+                result.push_back(character);
+            else
+                result.push_back('_');
+        }
+        return result;
+    }
+
+    // The schema is written in full form for the registry and in Parsing Canonical Form for the fingerprint
+    void BuilderAvro::appendSchemaField(std::string& json, std::string& canonical, const std::string& name, TYPE type, int precision, int scale,
+                                        bool nullable) {
+        std::string typeJson;
+        std::string typeCanonical;
+        switch (type) {
+            case TYPE::BOOLEAN:
+                typeJson = R"("boolean")";
+                typeCanonical = typeJson;
+                break;
+
+            case TYPE::LONG:
+                typeJson = R"("long")";
+                typeCanonical = typeJson;
+                break;
+
+            case TYPE::DECIMAL:
+                typeJson = R"({"type":"bytes","logicalType":"decimal","precision":)" + std::to_string(precision) + R"(,"scale":)" +
+                           std::to_string(scale) + "}";
+                typeCanonical = R"("bytes")";
+                break;
+
+            case TYPE::FLOAT:
+                typeJson = R"("float")";
+                typeCanonical = typeJson;
+                break;
+
+            case TYPE::DOUBLE:
+                typeJson = R"("double")";
+                typeCanonical = typeJson;
+                break;
+
+            case TYPE::TIMESTAMP:
+                typeJson = R"({"type":"long","logicalType":"timestamp-micros"})";
+                typeCanonical = R"("long")";
+                break;
+
+            case TYPE::TIMESTAMP_LOCAL:
+                typeJson = R"({"type":"long","logicalType":"local-timestamp-micros"})";
+                typeCanonical = R"("long")";
+                break;
+
+            case TYPE::BYTES:
+                typeJson = R"("bytes")";
+                typeCanonical = typeJson;
+                break;
+
+            case TYPE::STRING:
+                typeJson = R"("string")";
+                typeCanonical = typeJson;
+                break;
+        }
+
+        if (json.back() != '[')
+            json.push_back(',');
+        if (canonical.back() != '[')
+            canonical.push_back(',');
+
+        json.append(R"({"name":")" + name + R"(","type":)");
+        canonical.append(R"({"name":")" + name + R"(","type":)");
+        if (nullable) {
+            json.append(R"(["null",)" + typeJson + R"(],"default":null})");
+            canonical.append(R"(["null",)" + typeCanonical + "]}");
+        } else {
+            json.append(typeJson + "}");
+            canonical.append(typeCanonical + "}");
+        }
+    }
+
+    BuilderAvro::AvroSchema* BuilderAvro::getSchema(const DbTable* table) {
+        if (unlikely(schemaScn != metadata->schema->scn)) {
+            flushTables();
+            schemaScn = metadata->schema->scn;
+        }
+
+        auto it = schemas.find(table);
+        if (it != schemas.end())
+            return it->second;
+
+        auto* schema = new AvroSchema;
+        const std::string space(fieldName(table->owner));
+        const std::string name(fieldName(table->name));
+        std::string json(R"({"type":"record","name":")" + name + R"(","namespace":")" + space + R"(","fields":[)");
+        std::string canonical(R"({"name":")" + space + "." + name + R"(","type":"record","fields":[)");
+        appendSchemaField(json, canonical, "op", TYPE::STRING, 0, 0, false);
+        appendSchemaField(json, canonical, "scn", TYPE::LONG, 0, 0, false);
+        appendSchemaField(json, canonical, "tm", TYPE::TIMESTAMP, 0, 0, false);
+        appendSchemaField(json, canonical, "xid", TYPE::STRING, 0, 0, false);
+        if (format.ridFormat == Format::RID_FORMAT::TEXT)
+            appendSchemaField(json, canonical, "rid", TYPE::STRING, 0, 0, false);
+
+        // Before and after images share one record type, columns which are never sent are left out
+        std::string rowJson(R"({"type":"record","name":")" + name + R"(_row","fields":[)");
+        std::string rowCanonical(R"({"name":")" + space + "." + name + R"(_row","type":"record","fields":[)");
+        std::unordered_set<std::string> names;
+        for (typeCol i = 0; i < static_cast<typeCol>(table->columns.size()); ++i) {
+            const DbColumn* column = table->columns[i];
+            if (table->isColumnSkipped(i) ||
+                    (column->guard && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_GUARD_COLUMNS)) ||
+                    (column->nested && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_NESTED_COLUMNS)) ||
+                    (column->hidden && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_HIDDEN_COLUMNS)) ||
+                    (column->unused && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_UNUSED_COLUMNS)))
+                continue;
+
+            TYPE type;
+            switch (column->type) {
+                case SysCol::COLTYPE::NUMBER:
+                    if (column->scale == 0 && column->precision > 0 && column->precision <= 18)
+                        type = TYPE::LONG;
+                    else if (column->precision > 0 && column->precision <= 38 && column->scale >= 0 && column->scale <= column->precision)
+                        type = TYPE::DECIMAL;
+                    else
+                        // Unconstrained precision or negative scale, kept as text
+                        type = TYPE::STRING;
+                    break;
+
+                case SysCol::COLTYPE::BOOLEAN:
+                    type = TYPE::LONG;
+                    break;
+
+                case SysCol::COLTYPE::FLOAT:
+                    type = TYPE::FLOAT;
+                    break;
+
+                case SysCol::COLTYPE::DOUBLE:
+                    type = TYPE::DOUBLE;
+                    break;
+
+                case SysCol::COLTYPE::DATE:
+                case SysCol::COLTYPE::TIMESTAMP:
+                    type = TYPE::TIMESTAMP_LOCAL;
+                    break;
+
+                case SysCol::COLTYPE::TIMESTAMP_WITH_TZ:
+                case SysCol::COLTYPE::TIMESTAMP_WITH_LOCAL_TZ:
+                    type = TYPE::TIMESTAMP;
+                    break;
+
+                case SysCol::COLTYPE::RAW:
+                case SysCol::COLTYPE::LONG_RAW:
+                case SysCol::COLTYPE::BLOB:
+                    type = TYPE::BYTES;
+                    break;
+
+                default:
+                    type = TYPE::STRING;
+            }
+
+            std::string columnName(fieldName(column->name));
+            if (!names.insert(columnName).second) {
+                columnName.append("_" + std::to_string(i));
+                names.insert(columnName);
+            }
+            appendSchemaField(rowJson, rowCanonical, columnName, type, column->precision, column->scale, true);
+            schema->fields.push_back({columnName, type, column->precision, column->scale, i});
+        }
+        rowJson.append("]}");
+        rowCanonical.append("]}");
+
+        json.append(R"(,{"name":"before","type":["null",)" + rowJson + R"(],"default":null})");
+        canonical.append(R"(,{"name":"before","type":["null",)" + rowCanonical + "]}");
+        json.append(R"(,{"name":"after","type":["null",")" + name + R"(_row"],"default":null}]})");
+        canonical.append(R"(,{"name":"after","type":["null",")" + space + "." + name + R"(_row"]}]})");
+
+        schema->fingerprint = fingerprint(canonical);
+        registerSchema(schema->fingerprint, json);
+        schemas.insert_or_assign(table, schema);
+        return schema;
+    }
+
+    void BuilderAvro::registerSchema(uint64_t schemaFingerprint, const std::string& json) {
+        std::unique_lock<std::mutex> const lck(registry->registryMtx);
+        if (registry->registered.find(schemaFingerprint) != registry->registered.end())
+            return;
+
+        // The schema is written before any message which uses it is sent
+        std::ofstream outputStream;
+        outputStream.open(registryPath.c_str(), std::ios::out | std::ios::app);
+        if (!outputStream.is_open())
+            throw RuntimeException(10006, "file: " + registryPath + " - open for writing returned: " + strerror(errno));
+
+        char hex[16];
+        Data::writeHex(hex, schemaFingerprint, 16);
+        outputStream.write(hex, 16);
+        outputStream << ' ' << json << '\n';
+        outputStream.flush();
+        if (outputStream.bad() || outputStream.fail())
+            throw RuntimeException(10007, "file: " + registryPath + " - 0 bytes written instead of " + std::to_string(json.length() + 18) +
+                                          ", code returned: " + strerror(errno));
+        outputStream.close();
+        registry->registered.insert(schemaFingerprint);
+    }
+
+    void BuilderAvro::appendRow(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                                typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset, char op) {
+        if (newTran)
+            processBeginMessage(scn, sequence, timestamp);
+
+        const AvroSchema* schema = getSchema(table);
+        if (!format.isMessageFormatFull())
+            builderBegin(scn, sequence, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
+
+        appendHeader(schema->fingerprint);
+        appendBytes(&op, 1);
+        appendLong(static_cast<int64_t>(scn.getData()));
+        appendLong(timestamp * 1000000L);
+        appendBytes(xidText);
+        if (format.ridFormat == Format::RID_FORMAT::TEXT) {
+            const RowId rowId(dataObj, bdba, slot);
+            char str[RowId::SIZE + 1];
+            rowId.toString(str);
+            appendBytes(str, RowId::SIZE);
+        }
+
+        if (op == 'c') {
+            appendUnion(UNION_NULL);
+        } else {
+            appendUnion(UNION_VALUE);
+            appendImage(lobCtx, xmlCtx, table, schema, fileOffset, Format::VALUE_TYPE::BEFORE);
+        }
+        if (op == 'd') {
+            appendUnion(UNION_NULL);
+        } else {
+            appendUnion(UNION_VALUE);
+            appendImage(lobCtx, xmlCtx, table, schema, fileOffset, Format::VALUE_TYPE::AFTER);
+        }
+
+        if (!format.isMessageFormatFull())
+            builderCommit();
+        ++num;
+    }
+
+    void BuilderAvro::appendControl(const char* op, Scn scn, time_t timestamp, bool withXid) {
+        appendHeader(controlFingerprint);
+        appendBytes(op, strlen(op));
+        appendLong(static_cast<int64_t>(scn.getData()));
+        appendLong(timestamp * 1000000L);
+        if (withXid) {
+            appendUnion(UNION_VALUE);
+            appendBytes(xidText);
+        } else
+            appendUnion(UNION_NULL);
+    }
+
+    void BuilderAvro::columnFloat(const std::string& columnName __attribute__((unused)), double value) {
+        const AvroField* field = valueTarget();
+        if (field == nullptr)
+            return;
+
+        if (field->type == TYPE::FLOAT) {
+            appendValueBegin();
+            appendFloat(static_cast<float>(value));
+        } else if (field->type == TYPE::DOUBLE) {
+            appendValueBegin();
+            appendDouble(value);
+        }
+    }
+
+    void BuilderAvro::columnDouble(const std::string& columnName, long double value) {
+        columnFloat(columnName, static_cast<double>(value));
+    }
+
+    void BuilderAvro::columnString(const std::string& columnName __attribute__((unused))) {
+        const AvroField* field = valueTarget();
+        if (field == nullptr || (field->type != TYPE::STRING && field->type != TYPE::BYTES))
+            return;
+        appendValueBegin();
+        appendBytes(valueBuffer, valueSize);
+    }
+
+    void BuilderAvro::columnNumber(const std::string& columnName, int precision __attribute__((unused)), int scale __attribute__((unused))) {
+        const AvroField* field = valueTarget();
+        if (field == nullptr)
+            return;
+
+        switch (field->type) {
+            case TYPE::LONG: {
+                const bool minus = valueSize > 0 && valueBuffer[0] == '-';
+                uint64_t value = 0;
+                for (uint64_t i = minus ? 1 : 0; i < valueSize && valueBuffer[i] != '.'; ++i)
+                    value = (value * 10) + static_cast<uint>(valueBuffer[i] - '0');
+                appendValueBegin();
+                appendLong(static_cast<int64_t>(minus ? ~value + 1 : value));
+                break;
+            }
+
+            case TYPE::DECIMAL: {
+                typeUInt128 value;
+                if (!Data::decimalToUnscaled(valueBuffer, valueSize, field->precision, field->scale, value)) {
+                    ctx->warning(60041, "value: " + std::string(valueBuffer, valueSize) + " of column: " + columnName + " doesn't fit in decimal(" +
+                                        std::to_string(field->precision) + ", " + std::to_string(field->scale) + "), sent as null");
+                    break;
+                }
+
+                // Big-endian two's complement, redundant sign bytes are dropped
+                char buffer[sizeof(typeUInt128)];
+                for (uint i = 0; i < sizeof(typeUInt128); ++i)
+                    buffer[i] = static_cast<char>(static_cast<uint8_t>(value >> (8 * (sizeof(typeUInt128) - 1 - i))));
+                uint start = 0;
+                while (start + 1 < sizeof(typeUInt128) &&
+                       ((buffer[start] == '\0' && (buffer[start + 1] & 0x80) == 0) ||
+                        (buffer[start] == '\xFF' && (buffer[start + 1] & 0x80) != 0)))
+                    ++start;
+                appendValueBegin();
+                appendBytes(buffer + start, sizeof(typeUInt128) - start);
+                break;
+            }
+
+            case TYPE::FLOAT:
+            case TYPE::DOUBLE: {
+                valueBuffer[valueSize] = 0;
+                char* retPtr;
+                const double value = strtod(valueBuffer, &retPtr);
+                appendValueBegin();
+                if (field->type == TYPE::FLOAT)
+                    appendFloat(static_cast<float>(value));
+                else
+                    appendDouble(value);
+                break;
+            }
+
+            case TYPE::STRING:
+                appendValueBegin();
+                appendBytes(valueBuffer, valueSize);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void BuilderAvro::columnRaw(const std::string& columnName __attribute__((unused)), const uint8_t* data, uint64_t size) {
+        const AvroField* field = valueTarget();
+        if (field == nullptr || field->type != TYPE::BYTES)
+            return;
+        appendValueBegin();
+        appendBytes(reinterpret_cast<const char*>(data), size);
+    }
+
+    void BuilderAvro::columnRowId(const std::string& columnName __attribute__((unused)), RowId rowId) {
+        const AvroField* field = valueTarget();
+        if (field == nullptr || field->type != TYPE::STRING)
+            return;
+        char str[RowId::SIZE + 1];
+        rowId.toString(str);
+        appendValueBegin();
+        appendBytes(str, RowId::SIZE);
+    }
+
+    void BuilderAvro::columnTimestamp(const std::string& columnName __attribute__((unused)), time_t timestamp, uint64_t fraction) {
+        const AvroField* field = valueTarget();
+        if (field == nullptr || (field->type != TYPE::TIMESTAMP && field->type != TYPE::TIMESTAMP_LOCAL))
+            return;
+        appendValueBegin();
+        appendLong((timestamp * 1000000L) + static_cast<int64_t>(fraction / 1000));
+    }
+
+    void BuilderAvro::columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction,
+                                        const std::string_view& tz __attribute__((unused))) {
+        columnTimestamp(columnName, timestamp, fraction);
+    }
+
+    void BuilderAvro::columnLob(const std::string& columnName __attribute__((unused)), const LobId& lobId __attribute__((unused)),
+                                uint64_t size __attribute__((unused)), uint64_t chunks __attribute__((unused))) {
+        // LOB streaming is not used with this format
+    }
+
+    void BuilderAvro::processBeginMessage(Scn scn, Seq sequence, time_t timestamp) {
+        newTran = false;
+        xidText = lastXid.toString();
+
+        if (format.isMessageFormatFull()) {
+            // Records are self-delimiting, packed transactions follow each other
+            packBegin(scn, sequence);
+            if (!format.isMessageFormatSkipBegin()) {
+                appendControl("begin", scn, timestamp, true);
+                appendNulls(7);
+            }
+        } else if (!format.isMessageFormatSkipBegin()) {
+            builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+            appendControl("begin", scn, timestamp, true);
+            appendNulls(7);
+            builderCommit();
+        }
+    }
+
+    void BuilderAvro::processLobChunk(Scn scn __attribute__((unused)), Seq sequence __attribute__((unused)), time_t timestamp __attribute__((unused)),
+                                      const DbTable* table __attribute__((unused)), typeObj obj __attribute__((unused)),
+                                      typeDataObj dataObj __attribute__((unused)), typeDba bdba __attribute__((unused)),
+                                      typeSlot slot __attribute__((unused)), const LobStream& lobStream __attribute__((unused)),
+                                      uint64_t chunk __attribute__((unused)), uint64_t chunkOffset __attribute__((unused)),
+                                      bool last __attribute__((unused))) {
+        // LOB streaming is not used with this format
+    }
+
+    void BuilderAvro::processInsert(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                                    typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) {
+        appendRow(scn, sequence, timestamp, lobCtx, xmlCtx, table, obj, dataObj, bdba, slot, fileOffset, 'c');
+    }
+
+    void BuilderAvro::processUpdate(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                                    typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) {
+        appendRow(scn, sequence, timestamp, lobCtx, xmlCtx, table, obj, dataObj, bdba, slot, fileOffset, 'u');
+    }
+
+    void BuilderAvro::processDelete(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                                    typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) {
+        appendRow(scn, sequence, timestamp, lobCtx, xmlCtx, table, obj, dataObj, bdba, slot, fileOffset, 'd');
+    }
+
+    void BuilderAvro::processDdl(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj) {
+        if (newTran)
+            processBeginMessage(scn, sequence, timestamp);
+
+        if (!format.isMessageFormatFull())
+            builderBegin(scn, sequence, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
+
+        appendControl("ddl", scn, timestamp, true);
+        appendNulls(3);
+        if (table != nullptr) {
+            appendUnion(UNION_VALUE);
+            appendBytes(table->owner);
+            appendUnion(UNION_VALUE);
+            appendBytes(table->name);
+        } else
+            appendNulls(2);
+        appendUnion(UNION_VALUE);
+        appendLong(obj);
+
+        uint64_t ddlSize = 0;
+        for (uint8_t* chunk = ddlFirst; chunk != nullptr; chunk = *reinterpret_cast<uint8_t**>(chunk))
+            ddlSize += *reinterpret_cast<typeTransactionSize*>(chunk + sizeof(uint8_t*));
+        appendUnion(UNION_VALUE);
+        appendLong(static_cast<int64_t>(ddlSize));
+        for (uint8_t* chunk = ddlFirst; chunk != nullptr; chunk = *reinterpret_cast<uint8_t**>(chunk)) {
+            const typeTransactionSize* chunkSize = reinterpret_cast<typeTransactionSize*>(chunk + sizeof(uint8_t*));
+            appendArr(reinterpret_cast<const char*>(chunk + sizeof(uint8_t*) + sizeof(uint64_t)), *chunkSize);
+        }
+
+        if (!format.isMessageFormatFull())
+            builderCommit();
+        ++num;
+    }
+
+    void BuilderAvro::processCommit(Scn scn, Seq sequence, time_t timestamp) {
+        // Skip empty transaction
+        if (newTran) {
+            newTran = false;
+            return;
+        }
+
+        if (format.isMessageFormatFull()) {
+            if (!format.isMessageFormatSkipCommit()) {
+                appendControl("commit", scn, timestamp, true);
+                appendNulls(7);
+            }
+            packCommit();
+        } else if (!format.isMessageFormatSkipCommit()) {
+            builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+            appendControl("commit", scn, timestamp, true);
+            appendNulls(7);
+            builderCommit();
+        }
+        num = 0;
+    }
+
+    void BuilderAvro::processProvisional(Scn scn, Seq sequence, time_t timestamp) {
+        // Skip empty part
+        if (newTran) {
+            newTran = false;
+            return;
+        }
+
+        if (format.isMessageFormatFull()) {
+            appendControl("provisional", scn, timestamp, true);
+            appendNulls(7);
+            packCommit();
+        } else {
+            builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+            appendControl("provisional", scn, timestamp, true);
+            appendNulls(7);
+            builderCommit();
+        }
+        num = 0;
+    }
+
+    void BuilderAvro::processRollback(Scn scn, Seq sequence, time_t timestamp) {
+        if (format.isMessageFormatFull()) {
+            if (newTran) {
+                newTran = false;
+                xidText = lastXid.toString();
+                packBegin(scn, sequence);
+            }
+            appendControl("rollback", scn, timestamp, true);
+            appendNulls(7);
+            packCommit();
+        } else {
+            newTran = false;
+            xidText = lastXid.toString();
+            builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+            appendControl("rollback", scn, timestamp, true);
+            appendNulls(7);
+            builderCommit();
+        }
+        num = 0;
+    }
+
+    void BuilderAvro::processCheckpoint(Scn scn, Seq sequence, time_t timestamp, FileOffset fileOffset, bool redo) {
+        if (lwnScn != scn) {
+            lwnScn = scn;
+            lwnIdx = 0;
+        }
+
+        if (packCheckpoint(redo))
+            return;
+
+        BuilderMsg::OUTPUT_BUFFER flags = BuilderMsg::OUTPUT_BUFFER::CHECKPOINT;
+        if (redo)
+            flags = static_cast<BuilderMsg::OUTPUT_BUFFER>(static_cast<uint>(flags) | static_cast<uint>(BuilderMsg::OUTPUT_BUFFER::REDO));
+        builderBegin(scn, sequence, 0, flags);
+        appendControl("chkpt", scn, timestamp, false);
+        appendUnion(UNION_VALUE);
+        appendLong(sequence.getData());
+        appendUnion(UNION_VALUE);
+        appendLong(static_cast<int64_t>(fileOffset.getData()));
+        appendUnion(UNION_VALUE);
+        append(redo ? '\1' : '\0');
+        appendNulls(4);
+        builderCommit();
+    }
+
+    void BuilderAvro::flushTables() {
+        for (const auto& [_, schema]: schemas)
+            delete schema;
+        schemas.clear();
+    }
+
+    Builder* BuilderAvro::newWorkerBuilder() {
+        auto* workerBuilder = new BuilderAvro(ctx, locales, metadata, format, flushBuffer, registryPath, registry);
+        workerBuilder->setMaxMessageMb(maxMessageMb);
+        workerBuilder->setStreamTransactionMb(streamTransactionMb);
+        workerBuilder->initialize();
+        return workerBuilder;
+    }
+}
@@ -0,0 +1,217 @@
+/* Header for BuilderAvro class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef BUILDER_AVRO_H_
+#define BUILDER_AVRO_H_
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "../common/DbTable.h"
+#include "../metadata/Metadata.h"
+#include "../metadata/Schema.h"
+#include "Builder.h"
+
+namespace OpenLogReplicator {
+    // Every datum is written in Avro single object encoding: marker, 64-bit Rabin fingerprint of the schema and the binary encoded record.
+    // Schemas are appended to the registry file before the first message which uses them.
+    class BuilderAvro final : public Builder {
+    protected:
+        static constexpr uint8_t MARKER0{0xC3};
+        static constexpr uint8_t MARKER1{0x01};
+        static constexpr uint64_t HEADER_SIZE{10};
+        static constexpr uint64_t FINGERPRINT_EMPTY{0xC15D213AA4D7A795};
+        static constexpr uint64_t UNION_NULL{0};
+        static constexpr uint64_t UNION_VALUE{1};
+
+        enum class TYPE : unsigned char {
+            BOOLEAN, LONG, DECIMAL, FLOAT, DOUBLE, TIMESTAMP, TIMESTAMP_LOCAL, BYTES, STRING
+        };
+
+        struct AvroField {
+            std::string name;
+            TYPE type;
+            int precision;
+            int scale;
+            typeCol col;
+        };
+
+        struct AvroSchema {
+            uint64_t fingerprint;
+            std::vector<AvroField> fields;
+        };
+
+        std::string registryPath;
+        // Worker builders write to the registry of the main builder
+        BuilderAvro* registry;
+        std::mutex registryMtx;
+        std::unordered_set<uint64_t> registered;
+        uint64_t controlFingerprint{0};
+        std::unordered_map<const DbTable*, AvroSchema*> schemas;
+        // Schema version of the cached schemas, worker builders don't get flushTables() and check it on every row
+        Scn schemaScn{Scn::none()};
+        const AvroField* valueField{nullptr};
+        bool valueWritten{false};
+        std::string xidText;
+
+        // Avro int and long are zigzag encoded varints
+        void appendLong(int64_t value) {
+            uint64_t zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+            if (likely(lastBuilderSize + messagePosition + 10 < OUTPUT_BUFFER_DATA_SIZE)) {
+                uint8_t* ptr = lastBuilderQueue->data + lastBuilderSize + messagePosition;
+                while (zigzag >= 0x80) {
+                    *ptr++ = static_cast<uint8_t>(zigzag | 0x80);
+                    zigzag >>= 7;
+                }
+                *ptr++ = static_cast<uint8_t>(zigzag);
+                messagePosition = ptr - (lastBuilderQueue->data + lastBuilderSize);
+            } else {
+                while (zigzag >= 0x80) {
+                    append(static_cast<char>(zigzag | 0x80));
+                    zigzag >>= 7;
+                }
+                append(static_cast<char>(zigzag));
+            }
+        }
+
+        void appendBytes(const char* data, uint64_t size) {
+            appendLong(static_cast<int64_t>(size));
+            appendArr(data, size);
+        }
+
+        void appendBytes(const std::string& str) {
+            appendBytes(str.c_str(), str.length());
+        }
+
+        void appendUnion(uint64_t branch) {
+            append(static_cast<char>(branch << 1));
+        }
+
+        void appendNulls(uint64_t count) {
+            for (uint64_t i = 0; i < count; ++i)
+                appendUnion(UNION_NULL);
+        }
+
+        void appendFloat(float value) {
+            uint32_t bits;
+            memcpy(reinterpret_cast<void*>(&bits), reinterpret_cast<const void*>(&value), sizeof(bits));
+            uint8_t buffer[sizeof(float)];
+            Ctx::write32Little(buffer, bits);
+            appendArr(reinterpret_cast<const char*>(buffer), sizeof(float));
+        }
+
+        void appendDouble(double value) {
+            uint64_t bits;
+            memcpy(reinterpret_cast<void*>(&bits), reinterpret_cast<const void*>(&value), sizeof(bits));
+            uint8_t buffer[sizeof(double)];
+            Ctx::write64Little(buffer, bits);
+            appendArr(reinterpret_cast<const char*>(buffer), sizeof(double));
+        }
+
+        void appendHeader(uint64_t schemaFingerprint) {
+            char buffer[HEADER_SIZE];
+            buffer[0] = static_cast<char>(MARKER0);
+            buffer[1] = static_cast<char>(MARKER1);
+            Ctx::write64Little(reinterpret_cast<uint8_t*>(buffer + 2), schemaFingerprint);
+            appendArr(buffer, HEADER_SIZE);
+        }
+
+        // Field which is being processed by processValue(), nullptr when already written
+        [[nodiscard]] const AvroField* valueTarget() const {
+            if (unlikely(valueWritten))
+                return nullptr;
+            return valueField;
+        }
+
+        // Called when the value matches the field type, right before the value is written
+        void appendValueBegin() {
+            valueWritten = true;
+            appendUnion(UNION_VALUE);
+        }
+
+        void appendImage(LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, const AvroSchema* schema, FileOffset fileOffset,
+                         Format::VALUE_TYPE valueType) {
+            const uint type = static_cast<uint>(valueType);
+            const bool after = valueType == Format::VALUE_TYPE::AFTER;
+            const bool compressed = after ? compressedAfter : compressedBefore;
+            const typeCol baseMax = valuesMax >> 6;
+            for (const AvroField& field: schema->fields) {
+                const typeCol column = field.col;
+                // Missing values and values which were not written by the column callbacks are null
+                if ((column >> 6) <= baseMax && (valuesSet[column >> 6] & (1ULL << (column & 63))) != 0 && values[column][type] != nullptr &&
+                        sizes[column][type] > 0) {
+                    valueField = &field;
+                    valueWritten = false;
+                    processValue(lobCtx, xmlCtx, table, column, values[column][type], sizes[column][type], fileOffset, after, compressed);
+                    valueField = nullptr;
+                    if (valueWritten)
+                        continue;
+                }
+                appendUnion(UNION_NULL);
+            }
+        }
+
+        [[nodiscard]] static uint64_t fingerprint(const std::string& canonical);
+        [[nodiscard]] static std::string fieldName(const std::string& name);
+        static void appendSchemaField(std::string& json, std::string& canonical, const std::string& name, TYPE type, int precision, int scale,
+                                      bool nullable);
+        [[nodiscard]] AvroSchema* getSchema(const DbTable* table);
+        void registerSchema(uint64_t schemaFingerprint, const std::string& json);
+        void appendRow(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                       typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset, char op);
+        void appendControl(const char* op, Scn scn, time_t timestamp, bool withXid);
+
+        void columnFloat(const std::string& columnName, double value) override;
+        void columnDouble(const std::string& columnName, long double value) override;
+        void columnString(const std::string& columnName) override;
+        void columnNumber(const std::string& columnName, int precision, int scale) override;
+        void columnRaw(const std::string& columnName, const uint8_t* data, uint64_t size) override;
+        void columnRowId(const std::string& columnName, RowId rowId) override;
+        void columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) override;
+        void columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction, const std::string_view& tz) override;
+        void columnLob(const std::string& columnName, const LobId& lobId, uint64_t size, uint64_t chunks) override;
+        void processInsert(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                           typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
+        void processUpdate(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                           typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
+        void processDelete(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                           typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
+        void processDdl(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj) override;
+        void processBeginMessage(Scn scn, Seq sequence, time_t timestamp) override;
+        void processLobChunk(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                             typeSlot slot, const LobStream& lobStream, uint64_t chunk, uint64_t chunkOffset, bool last) override;
+
+    public:
+        BuilderAvro(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, Format& newFormat, uint64_t newFlushBuffer, std::string newRegistryPath,
+                    BuilderAvro* newRegistry = nullptr);
+        ~BuilderAvro() override;
+
+        void processCommit(Scn scn, Seq sequence, time_t timestamp) override;
+        void processProvisional(Scn scn, Seq sequence, time_t timestamp) override;
+        void processRollback(Scn scn, Seq sequence, time_t timestamp) override;
+        void processCheckpoint(Scn scn, Seq sequence, time_t timestamp, FileOffset fileOffset, bool redo) override;
+        void flushTables() override;
+        [[nodiscard]] Builder* newWorkerBuilder() override;
+    };
+}
+
+#endif
@@ -36,14 +36,10 @@ namespace OpenLogReplicator {
             hasPreviousColumn = true;
 
         // 构建JSON格式的列名
-        append('"');
-        appendEscape(columnName);
-        append(std::string_view(R"(":)"));
+        appendColumnName(columnName);
 
-        // 将浮点值转换为字符串并添加到输出
-        std::ostringstream ss;
-        ss << value;
-        append(ss.str());
+        // BINARY_FLOAT的值可以精确表示为float
+        appendFloat(static_cast<float>(value));
     }
 
     void BuilderJson::columnDouble(const std::string& columnName, long double value) {
@@ -54,14 +50,10 @@ namespace OpenLogReplicator {
             hasPreviousColumn = true;
 
         // 构建JSON格式的列名
-        append('"');
-        appendEscape(columnName);
-        append(std::string_view(R"(":)"));
+        appendColumnName(columnName);
 
-        // 将双精度浮点值转换为字符串并添加到输出
-        std::ostringstream ss;
-        ss << value;
-        append(ss.str());
+        // BINARY_DOUBLE的值可以精确表示为double
+        appendFloat(static_cast<double>(value));
     }
 
     void BuilderJson::columnString(const std::string& columnName) {
@@ -72,9 +64,8 @@ namespace OpenLogReplicator {
             hasPreviousColumn = true;
 
         // 构建JSON格式的字符串列，包括列名和值
+        appendColumnName(columnName);
         append('"');
-        appendEscape(columnName);
-        append(std::string_view(R"(":")"));
         appendEscape(valueBuffer, valueSize);
         append('"');
     }
@@ -87,9 +78,7 @@ namespace OpenLogReplicator {
             hasPreviousColumn = true;
 
         // 构建JSON格式的数字列
-        append('"');
-        appendEscape(columnName);
-        append(std::string_view(R"(":)"));
+        appendColumnName(columnName);
         appendArr(valueBuffer, valueSize);
     }
 
@@ -101,9 +90,8 @@ namespace OpenLogReplicator {
             hasPreviousColumn = true;
 
         // 构建JSON格式的RowID列
+        appendColumnName(columnName);
         append('"');
-        appendEscape(columnName);
-        append(std::string_view(R"(":")"));
         char str[RowId::SIZE + 1];
         rowId.toHex(str);
         appendArr(str, 18);
@@ -118,9 +106,8 @@ namespace OpenLogReplicator {
             else
                 hasPreviousColumn = true;
 
+            appendColumnName<true>(columnName);
             append<true>('"');
-            appendEscape<true>(columnName);
-            append<true>(std::string_view(R"(":")"));
             for (uint64_t j = 0; j < size; ++j)
                 appendHex2<true>(*(data + j));
             append<true>('"');
@@ -131,24 +118,38 @@ namespace OpenLogReplicator {
             else
                 hasPreviousColumn = true;
 
+            appendColumnName(columnName);
             append('"');
-            appendEscape(columnName);
-            append(std::string_view(R"(":")"));
             for (uint64_t j = 0; j < size; ++j)
                 appendHex2(*(data + j));
             append('"');
         }
     }
 
+    void BuilderJson::columnLob(const std::string& columnName, const LobId& lobId, uint64_t size, uint64_t chunks) {
+        if (hasPreviousColumn)
+            append(',');
+        else
+            hasPreviousColumn = true;
+
+        // 只输出LOB引用，数据在行消息之后以"lob"消息输出
+        appendColumnName(columnName);
+        append(std::string_view(R"({"lob":")"));
+        append(lobId.lower());
+        append(std::string_view(R"(","size":)"));
+        appendDec(size);
+        append(std::string_view(R"(,"chunks":)"));
+        appendDec(chunks);
+        append('}');
+    }
+
     void BuilderJson::columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) {
         if (hasPreviousColumn)
             append(',');
         else
             hasPreviousColumn = true;
 
-        append('"');
-        appendEscape(columnName);
-        append(std::string_view(R"(":)"));
+        appendColumnName(columnName);
         char buffer[22];
 
         switch (format.timestampFormat) {
@@ -327,9 +328,7 @@ namespace OpenLogReplicator {
         else
             hasPreviousColumn = true;
 
-        append('"');
-        appendEscape(columnName);
-        append(std::string_view(R"(":)"));
+        appendColumnName(columnName);
         char buffer[22];
 
         switch (format.timestampTzFormat) {
@@ -502,7 +501,12 @@ namespace OpenLogReplicator {
         if (format.isMessageFormatSkipBegin())
             return;
 
-        builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+        if (format.isMessageFormatFull()) {
+            // Transactions of a packed message are separated by new line
+            if (packBegin(scn, sequence))
+                append('\n');
+        } else
+            builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
         append('{');
         hasPreviousValue = false;
         appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
@@ -532,7 +536,7 @@ namespace OpenLogReplicator {
 
         if (format.isMessageFormatFull()) {
             append(std::string_view("]}"));
-            builderCommit();
+            packCommit();
         } else if (!format.isMessageFormatSkipCommit()) {
             builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
             append('{');
@@ -554,6 +558,115 @@ namespace OpenLogReplicator {
         num = 0;
     }
 
+    void BuilderJson::processProvisional(Scn scn, Seq sequence, time_t timestamp) {
+        // Skip empty part
+        if (newTran) {
+            newTran = false;
+            return;
+        }
+
+        if (format.isMessageFormatFull()) {
+            if (hasPreviousRedo)
+                append(',');
+            append(std::string_view(R"({"op":"provisional"}]})"));
+            packCommit();
+        } else {
+            builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+            append('{');
+
+            hasPreviousValue = false;
+            appendHeader(scn, timestamp, false, format.isDbFormatAddDml(), true);
+
+            if (hasPreviousValue)
+                append(',');
+            else
+                hasPreviousValue = true;
+
+            if (format.isAttributesFormatCommit())
+                appendAttributes();
+
+            append(std::string_view(R"("payload":[{"op":"provisional"}]})"));
+            builderCommit();
+        }
+        num = 0;
+    }
+
+    void BuilderJson::processRollback(Scn scn, Seq sequence, time_t timestamp) {
+        if (format.isMessageFormatFull()) {
+            if (newTran)
+                processBeginMessage(scn, sequence, timestamp);
+            else if (hasPreviousRedo)
+                append(',');
+            append(std::string_view(R"({"op":"rollback"}]})"));
+            packCommit();
+        } else {
+            newTran = false;
+            builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+            append('{');
+
+            hasPreviousValue = false;
+            appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
+
+            if (hasPreviousValue)
+                append(',');
+            else
+                hasPreviousValue = true;
+
+            if (format.isAttributesFormatCommit())
+                appendAttributes();
+
+            append(std::string_view(R"("payload":[{"op":"rollback"}]})"));
+            builderCommit();
+        }
+        num = 0;
+    }
+
+    void BuilderJson::processLobChunk(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                                      typeSlot slot, const LobStream& lobStream, uint64_t chunk, uint64_t chunkOffset, bool last) {
+        builderBegin(scn, sequence, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
+        append('{');
+
+        hasPreviousValue = false;
+        appendHeader(scn, timestamp, false, format.isDbFormatAddDml(), true);
+
+        if (hasPreviousValue)
+            append(',');
+        else
+            hasPreviousValue = true;
+
+        append(std::string_view(R"("payload":[{"op":"lob",)"));
+        appendSchema(table, obj);
+        appendRowid(dataObj, bdba, slot);
+        append(std::string_view(R"(,"lob":{"id":")"));
+        append(lobStream.lobId.lower());
+        append(std::string_view(R"(","column":")"));
+        appendEscape(lobStream.columnName);
+        append(std::string_view(R"(","chunk":)"));
+        appendDec(chunk);
+        append(std::string_view(R"(,"offset":)"));
+        appendDec(chunkOffset);
+        if (last)
+            append(std::string_view(R"(,"last":true,"data":")"));
+        else
+            append(std::string_view(R"(,"last":false,"data":")"));
+
+        if (lobStream.isClob) {
+            // Characters split between pages are joined by the string parser
+            const uint64_t pages = lobChunkPages.size();
+            for (uint64_t i = 0; i < pages; ++i)
+                parseString(lobChunkPages[i].first, lobChunkPages[i].second, lobStream.charsetId, lobStream.fileOffset, i > 0, chunkOffset > 0 || i > 0,
+                            !last || i + 1 < pages, lobStream.isSystem);
+            appendEscape(valueBuffer, valueSize);
+        } else {
+            for (const auto& [data, size]: lobChunkPages)
+                for (uint64_t j = 0; j < size; ++j)
+                    appendHex2(*(data + j));
+        }
+
+        append(std::string_view(R"("}}]})"));
+        builderCommit();
+    }
+
     void BuilderJson::processInsert(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table,
                                     typeObj obj, typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) {
         if (newTran)
@@ -597,6 +710,9 @@ namespace OpenLogReplicator {
         if (!format.isMessageFormatFull()) {
             append(std::string_view("]}"));
             builderCommit();
+
+            if (!lobStreams.empty())
+                processLobStreams(scn, sequence, timestamp, table, obj, dataObj, bdba, slot);
         }
         ++num;
     }
@@ -645,6 +761,9 @@ namespace OpenLogReplicator {
         if (!format.isMessageFormatFull()) {
             append(std::string_view("]}"));
             builderCommit();
+
+            if (!lobStreams.empty())
+                processLobStreams(scn, sequence, timestamp, table, obj, dataObj, bdba, slot);
         }
         ++num;
     }
@@ -750,6 +869,9 @@ namespace OpenLogReplicator {
             lwnIdx = 0;
         }
 
+        if (packCheckpoint(redo))
+            return;
+
         BuilderMsg::OUTPUT_BUFFER flags = BuilderMsg::OUTPUT_BUFFER::CHECKPOINT;
         if (redo)
             flags = static_cast<BuilderMsg::OUTPUT_BUFFER>(static_cast<uint>(flags) | static_cast<uint>(BuilderMsg::OUTPUT_BUFFER::REDO));
@@ -796,4 +918,13 @@ namespace OpenLogReplicator {
         else
             msg->tagSize = messageSize + messagePosition;
     }
+
+    Builder* BuilderJson::newWorkerBuilder() {
+        auto* workerBuilder = new BuilderJson(ctx, locales, metadata, format, flushBuffer);
+        workerBuilder->setMaxMessageMb(maxMessageMb);
+        workerBuilder->setStreamTransactionMb(streamTransactionMb);
+        workerBuilder->setLobStreamMb(lobStreamMb);
+        workerBuilder->initialize();
+        return workerBuilder;
+    }
 }
@@ -20,6 +20,11 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #ifndef BUILDER_JSON_H_
 #define BUILDER_JSON_H_
 
+#include <charconv>
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #include "Builder.h"
 #include "../common/DbColumn.h"
 #include "../common/DbTable.h"
@@ -72,14 +77,26 @@ namespace OpenLogReplicator {
             else
                 hasPreviousColumn = true;
 
-            append('"');
             if (likely(table != nullptr))
-                appendEscape(table->columns[col]->name);
+                append(std::string_view(table->columns[col]->jsonName));
             else {
-                const std::string columnName("COL_" + std::to_string(col));
+                const std::string columnName("\"COL_" + std::to_string(col) + "\":");
                 append(columnName);
             }
-            append(std::string_view(R"(":null)"));
+            append(std::string_view("null"));
+        }
+
+        // 列名片段在加载表结构时已转义，只有无表结构的列名需要逐字符转义
+        template<bool fast = false>
+        void appendColumnName(const std::string& columnName) {
+            if (likely(valueColumn != nullptr && &valueColumn->name == &columnName)) {
+                append<fast>(std::string_view(valueColumn->jsonName));
+                return;
+            }
+
+            append<fast>('"');
+            appendEscape<fast>(columnName);
+            append<fast>(std::string_view(R"(":)"));
         }
 
         void appendRowid(typeDataObj dataObj, typeDba bdba, typeSlot slot) {
@@ -339,11 +356,7 @@ namespace OpenLogReplicator {
                 return;
             }
 
-            append(std::string_view(R"("schema":{"owner":")"));
-            appendEscape(table->owner);
-            append(std::string_view(R"(","table":")"));
-            appendEscape(table->name);
-            append('"');
+            append(std::string_view(table->jsonSchema));
 
             if (format.isSchemaFormatObj()) {
                 append(std::string_view(R"(,"obj":)"));
@@ -359,300 +372,117 @@ namespace OpenLogReplicator {
                     tables.insert(table);
                 }
 
-                append(std::string_view(R"(,"columns":[)"));
-
-                bool hasPrev = false;
-                for (typeCol column = 0; column < static_cast<typeCol>(table->columns.size()); ++column) {
-                    if (table->columns[column] == nullptr)
-                        continue;
-
-                    if (hasPrev)
-                        append(',');
-                    else
-                        hasPrev = true;
-
-                    append(std::string_view(R"({"name":")"));
-                    appendEscape(table->columns[column]->name);
-
-                    append(std::string_view(R"(","type":)"));
-                    switch (table->columns[column]->type) {
-                        case SysCol::COLTYPE::VARCHAR:
-                            append(std::string_view(R"("varchar2","length":)"));
-                            appendDec(table->columns[column]->length);
-                            break;
-
-                        case SysCol::COLTYPE::NUMBER:
-                            append(std::string_view(R"("number","precision":)"));
-                            appendSDec(table->columns[column]->precision);
-                            append(std::string_view(R"(,"scale":)"));
-                            appendSDec(table->columns[column]->scale);
-                            break;
-
-                        case SysCol::COLTYPE::LONG:
-                            // Long, not supported
-                            append(std::string_view(R"("long")"));
-                            break;
-
-                        case SysCol::COLTYPE::DATE:
-                            append(std::string_view(R"("date")"));
-                            break;
-
-                        case SysCol::COLTYPE::RAW:
-                            append(std::string_view(R"("raw","length":)"));
-                            appendDec(table->columns[column]->length);
-                            break;
-
-                        case SysCol::COLTYPE::LONG_RAW: // Not supported
-                            append(std::string_view(R"("long raw")"));
-                            break;
-
-                        case SysCol::COLTYPE::CHAR:
-                            append(std::string_view(R"("char","length":)"));
-                            appendDec(table->columns[column]->length);
-                            break;
-
-                        case SysCol::COLTYPE::FLOAT:
-                            append(std::string_view(R"("binary_float")"));
-                            break;
-
-                        case SysCol::COLTYPE::DOUBLE:
-                            append(std::string_view(R"("binary_double")"));
-                            break;
-
-                        case SysCol::COLTYPE::CLOB:
-                            append(std::string_view(R"("clob")"));
-                            break;
-
-                        case SysCol::COLTYPE::BLOB:
-                            append(std::string_view(R"("blob")"));
-                            break;
-
-                        case SysCol::COLTYPE::TIMESTAMP:
-                            append(std::string_view(R"("timestamp","length":)"));
-                            appendDec(table->columns[column]->length);
-                            break;
-
-                        case SysCol::COLTYPE::TIMESTAMP_WITH_TZ:
-                            append(std::string_view(R"("timestamp with time zone","length":)"));
-                            appendDec(table->columns[column]->length);
-                            break;
-
-                        case SysCol::COLTYPE::INTERVAL_YEAR_TO_MONTH:
-                            append(std::string_view(R"("interval year to month","length":)"));
-                            appendDec(table->columns[column]->length);
-                            break;
-
-                        case SysCol::COLTYPE::INTERVAL_DAY_TO_SECOND:
-                            append(std::string_view(R"("interval day to second","length":)"));
-                            appendDec(table->columns[column]->length);
-                            break;
-
-                        case SysCol::COLTYPE::UROWID:
-                            append(std::string_view(R"("urowid","length":)"));
-                            appendDec(table->columns[column]->length);
-                            break;
-
-                        case SysCol::COLTYPE::TIMESTAMP_WITH_LOCAL_TZ:
-                            append(std::string_view(R"("timestamp with local time zone","length":)"));
-                            appendDec(table->columns[column]->length);
-                            break;
-
-                        default:
-                            append(std::string_view(R"("unknown")"));
-                            break;
-                    }
-
-                    append(std::string_view(R"(,"nullable":)"));
-                    if (table->columns[column]->nullable)
-                        append(std::string_view("true"));
-                    else
-                        append(std::string_view("false"));
-
-                    append('}');
-                }
-                append(']');
+                append(std::string_view(table->jsonColumns));
             }
 
             append('}');
         }
 
-        template<bool fast = false>
-        void appendHex2(uint8_t value) {
-            if (likely(fast || lastBuilderSize + messagePosition + 2 < OUTPUT_BUFFER_DATA_SIZE)) {
-                append<true>(Data::map16((value >> 4) & 0xF));
-                append<true>(Data::map16(value & 0xF));
+        template<uint size, bool fast = false>
+        void appendHexN(uint64_t value) {
+            if (likely(fast || lastBuilderSize + messagePosition + size < OUTPUT_BUFFER_DATA_SIZE)) {
+                Data::writeHex(reinterpret_cast<char*>(lastBuilderQueue->data + lastBuilderSize + messagePosition), value, size);
+                messagePosition += size;
+                ctx->assertDebug(lastBuilderSize + messagePosition < OUTPUT_BUFFER_DATA_SIZE);
             } else {
-                append(Data::map16((value >> 4) & 0xF));
-                append(Data::map16(value & 0xF));
+                char buffer[16];
+                Data::writeHex(buffer, value, size);
+                for (uint i = 0; i < size; ++i)
+                    append(buffer[i]);
             }
         }
 
+        template<bool fast = false>
+        void appendHex2(uint8_t value) {
+            appendHexN<2, fast>(value);
+        }
+
         void appendHex3(uint16_t value) {
-            if (likely(lastBuilderSize + messagePosition + 3 < OUTPUT_BUFFER_DATA_SIZE)) {
-                append<true>(Data::map16((value >> 8) & 0xF));
-                append<true>(Data::map16((value >> 4) & 0xF));
-                append<true>(Data::map16(value & 0xF));
-            } else {
-                append(Data::map16((value >> 8) & 0xF));
-                append(Data::map16((value >> 4) & 0xF));
-                append(Data::map16(value & 0xF));
-            }
+            appendHexN<3>(value);
         }
 
         void appendHex4(uint16_t value) {
-            if (likely(lastBuilderSize + messagePosition + 4 < OUTPUT_BUFFER_DATA_SIZE)) {
-                append<true>(Data::map16((value >> 12) & 0xF));
-                append<true>(Data::map16((value >> 8) & 0xF));
-                append<true>(Data::map16((value >> 4) & 0xF));
-                append<true>(Data::map16(value & 0xF));
-            } else {
-                append(Data::map16((value >> 12) & 0xF));
-                append(Data::map16((value >> 8) & 0xF));
-                append(Data::map16((value >> 4) & 0xF));
-                append(Data::map16(value & 0xF));
-            };
+            appendHexN<4>(value);
         }
 
         void appendHex8(uint32_t value) {
-            if (likely(lastBuilderSize + messagePosition + 8 < OUTPUT_BUFFER_DATA_SIZE)) {
-                append<true>(Data::map16((value >> 28) & 0xF));
-                append<true>(Data::map16((value >> 24) & 0xF));
-                append<true>(Data::map16((value >> 20) & 0xF));
-                append<true>(Data::map16((value >> 16) & 0xF));
-                append<true>(Data::map16((value >> 12) & 0xF));
-                append<true>(Data::map16((value >> 8) & 0xF));
-                append<true>(Data::map16((value >> 4) & 0xF));
-                append<true>(Data::map16(value & 0xF));
-            } else {
-                append(Data::map16((value >> 28) & 0xF));
-                append(Data::map16((value >> 24) & 0xF));
-                append(Data::map16((value >> 20) & 0xF));
-                append(Data::map16((value >> 16) & 0xF));
-                append(Data::map16((value >> 12) & 0xF));
-                append(Data::map16((value >> 8) & 0xF));
-                append(Data::map16((value >> 4) & 0xF));
-                append(Data::map16(value & 0xF));
-            }
+            appendHexN<8>(value);
         }
 
         void appendHex16(uint64_t value) {
-            if (likely(lastBuilderSize + messagePosition + 16 < OUTPUT_BUFFER_DATA_SIZE)) {
-                append<true>(Data::map16((value >> 60) & 0xF));
-                append<true>(Data::map16((value >> 56) & 0xF));
-                append<true>(Data::map16((value >> 52) & 0xF));
-                append<true>(Data::map16((value >> 48) & 0xF));
-                append<true>(Data::map16((value >> 44) & 0xF));
-                append<true>(Data::map16((value >> 40) & 0xF));
-                append<true>(Data::map16((value >> 36) & 0xF));
-                append<true>(Data::map16((value >> 32) & 0xF));
-                append<true>(Data::map16((value >> 28) & 0xF));
-                append<true>(Data::map16((value >> 24) & 0xF));
-                append<true>(Data::map16((value >> 20) & 0xF));
-                append<true>(Data::map16((value >> 16) & 0xF));
-                append<true>(Data::map16((value >> 12) & 0xF));
-                append<true>(Data::map16((value >> 8) & 0xF));
-                append<true>(Data::map16((value >> 4) & 0xF));
-                append<true>(Data::map16(value & 0xF));
+            appendHexN<16>(value);
+        }
+
+        // 最短的可精确往返的浮点数表示，直接写入输出缓冲区
+        template<typename T>
+        void appendFloat(T value) {
+            static constexpr uint FLOAT_LENGTH{32};
+
+            if (likely(lastBuilderSize + messagePosition + FLOAT_LENGTH < OUTPUT_BUFFER_DATA_SIZE)) {
+                char* ptr = reinterpret_cast<char*>(lastBuilderQueue->data + lastBuilderSize + messagePosition);
+                const std::to_chars_result result = std::to_chars(ptr, ptr + FLOAT_LENGTH, value);
+                messagePosition += static_cast<uint64_t>(result.ptr - ptr);
+                ctx->assertDebug(lastBuilderSize + messagePosition < OUTPUT_BUFFER_DATA_SIZE);
             } else {
-                append(Data::map16((value >> 60) & 0xF));
-                append(Data::map16((value >> 56) & 0xF));
-                append(Data::map16((value >> 52) & 0xF));
-                append(Data::map16((value >> 48) & 0xF));
-                append(Data::map16((value >> 44) & 0xF));
-                append(Data::map16((value >> 40) & 0xF));
-                append(Data::map16((value >> 36) & 0xF));
-                append(Data::map16((value >> 32) & 0xF));
-                append(Data::map16((value >> 28) & 0xF));
-                append(Data::map16((value >> 24) & 0xF));
-                append(Data::map16((value >> 20) & 0xF));
-                append(Data::map16((value >> 16) & 0xF));
-                append(Data::map16((value >> 12) & 0xF));
-                append(Data::map16((value >> 8) & 0xF));
-                append(Data::map16((value >> 4) & 0xF));
-                append(Data::map16(value & 0xF));
+                char buffer[FLOAT_LENGTH];
+                const std::to_chars_result result = std::to_chars(buffer, buffer + FLOAT_LENGTH, value);
+                for (const char* ptr = buffer; ptr < result.ptr; ++ptr)
+                    append(*ptr);
             }
         }
 
         template<uint size, bool fast = false>
         void appendDecN(uint64_t value) {
-            char buffer[21];
-
-            for (uint i = 0; i < size; ++i) {
-                buffer[i] = Data::map10(value % 10);
-                value /= 10;
-            }
-
             if (likely(fast || lastBuilderSize + messagePosition + size < OUTPUT_BUFFER_DATA_SIZE)) {
-                uint8_t* ptr = lastBuilderQueue->data + lastBuilderSize + messagePosition;
-                for (uint i = 0; i < size; ++i)
-                    *ptr++ = buffer[size - i - 1];
+                Data::writeDec(reinterpret_cast<char*>(lastBuilderQueue->data + lastBuilderSize + messagePosition), value, size);
                 messagePosition += size;
                 ctx->assertDebug(lastBuilderSize + messagePosition < OUTPUT_BUFFER_DATA_SIZE);
             } else {
+                char buffer[20];
+                Data::writeDec(buffer, value, size);
                 for (uint i = 0; i < size; ++i)
-                    append(buffer[size - i - 1]);
+                    append(buffer[i]);
             }
         }
 
         template<bool fast = false>
         void appendDec(uint64_t value) {
-            char buffer[21];
-            uint size = 0;
-
-            if (value == 0) {
-                buffer[0] = '0';
-                size = 1;
-            } else {
-                while (value > 0) {
-                    buffer[size++] = Data::map10(value % 10);
-                    value /= 10;
-                }
-            }
+            const uint size = Data::decLength(value);
 
             if (likely(fast || lastBuilderSize + messagePosition + size < OUTPUT_BUFFER_DATA_SIZE)) {
-                uint8_t* ptr = lastBuilderQueue->data + lastBuilderSize + messagePosition;
-                for (uint i = 0; i < size; ++i)
-                    *ptr++ = buffer[size - i - 1];
+                Data::writeDec(reinterpret_cast<char*>(lastBuilderQueue->data + lastBuilderSize + messagePosition), value, size);
                 messagePosition += size;
                 ctx->assertDebug(lastBuilderSize + messagePosition < OUTPUT_BUFFER_DATA_SIZE);
             } else {
+                char buffer[20];
+                Data::writeDec(buffer, value, size);
                 for (uint i = 0; i < size; ++i)
-                    append(buffer[size - i - 1]);
+                    append(buffer[i]);
             }
         }
 
         void appendSDec(int64_t value) {
-            char buffer[22];
-            uint size = 0;
-
-            if (value == 0) {
-                buffer[0] = '0';
-                size = 1;
-            } else {
-                if (value < 0) {
-                    value = -value;
-                    while (value > 0) {
-                        buffer[size++] = Data::map10(value % 10);
-                        value /= 10;
-                    }
-                    buffer[size++] = '-';
-                } else {
-                    while (value > 0) {
-                        buffer[size++] = Data::map10(value % 10);
-                        value /= 10;
-                    }
-                }
+            if (value >= 0) {
+                appendDec(static_cast<uint64_t>(value));
+                return;
             }
 
+            // Negation in unsigned arithmetic is also valid for the minimal value
+            const uint64_t absolute = 0 - static_cast<uint64_t>(value);
+            const uint size = Data::decLength(absolute) + 1;
+
             if (likely(lastBuilderSize + messagePosition + size < OUTPUT_BUFFER_DATA_SIZE)) {
-                uint8_t* ptr = lastBuilderQueue->data + lastBuilderSize + messagePosition;
-                for (uint i = 0; i < size; ++i)
-                    *ptr++ = buffer[size - i - 1];
+                char* ptr = reinterpret_cast<char*>(lastBuilderQueue->data + lastBuilderSize + messagePosition);
+                *ptr = '-';
+                Data::writeDec(ptr + 1, absolute, size - 1);
                 messagePosition += size;
                 ctx->assertDebug(lastBuilderSize + messagePosition < OUTPUT_BUFFER_DATA_SIZE);
             } else {
+                char buffer[21];
+                buffer[0] = '-';
+                Data::writeDec(buffer + 1, absolute, size - 1);
                 for (uint i = 0; i < size; ++i)
-                    append(buffer[size - i - 1]);
+                    append(buffer[i]);
             }
         }
 
@@ -670,9 +500,69 @@ namespace OpenLogReplicator {
             }
         }
 
+        static bool isEscaped(uint8_t character) {
+            return character < 0x20 || character == '"' || character == '\\' || character == '/';
+        }
+
+        // 返回第一个需要转义的字符位置，向量指令集在编译时由CPU_ARCH选择
+        static uint64_t findEscape(const char* str, uint64_t size) {
+            uint64_t pos = 0;
+
+#ifdef __AVX2__
+            const __m256i control32 = _mm256_set1_epi8(0x1F);
+            const __m256i quote32 = _mm256_set1_epi8('"');
+            const __m256i backslash32 = _mm256_set1_epi8('\\');
+            const __m256i slash32 = _mm256_set1_epi8('/');
+            while (pos + 32 <= size) {
+                const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + pos));
+                // Unsigned comparison: min(x, 0x1F) == x for x <= 0x1F
+                __m256i mask = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, control32), chunk);
+                mask = _mm256_or_si256(mask, _mm256_cmpeq_epi8(chunk, quote32));
+                mask = _mm256_or_si256(mask, _mm256_cmpeq_epi8(chunk, backslash32));
+                mask = _mm256_or_si256(mask, _mm256_cmpeq_epi8(chunk, slash32));
+                const auto bits = static_cast<uint32_t>(_mm256_movemask_epi8(mask));
+                if (bits != 0)
+                    return pos + __builtin_ctz(bits);
+                pos += 32;
+            }
+#endif
+
+#ifdef __SSE2__
+            const __m128i control16 = _mm_set1_epi8(0x1F);
+            const __m128i quote16 = _mm_set1_epi8('"');
+            const __m128i backslash16 = _mm_set1_epi8('\\');
+            const __m128i slash16 = _mm_set1_epi8('/');
+            while (pos + 16 <= size) {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+                __m128i mask = _mm_cmpeq_epi8(_mm_min_epu8(chunk, control16), chunk);
+                mask = _mm_or_si128(mask, _mm_cmpeq_epi8(chunk, quote16));
+                mask = _mm_or_si128(mask, _mm_cmpeq_epi8(chunk, backslash16));
+                mask = _mm_or_si128(mask, _mm_cmpeq_epi8(chunk, slash16));
+                const auto bits = static_cast<uint32_t>(_mm_movemask_epi8(mask));
+                if (bits != 0)
+                    return pos + __builtin_ctz(bits);
+                pos += 16;
+            }
+#endif
+
+            while (pos < size && !isEscaped(static_cast<uint8_t>(str[pos])))
+                ++pos;
+            return pos;
+        }
+
         template<bool fast = false>
         void appendEscapeInternal(const char* str, uint64_t size) {
             while (size > 0) {
+                // Copy the run of characters which don't need escaping at once
+                const uint64_t clean = findEscape(str, size);
+                if (clean > 0) {
+                    append<fast>(std::string_view(str, clean));
+                    str += clean;
+                    size -= clean;
+                    if (size == 0)
+                        break;
+                }
+
                 switch (*str) {
                     case '\t':
                         append<fast>(std::string_view("\\t"));
@@ -689,40 +579,6 @@ namespace OpenLogReplicator {
                     case '\b':
                         append<fast>(std::string_view("\\b"));
                         break;
-                    case 0:
-                    case 1:
-                    case 2:
-                    case 3:
-                    case 4:
-                    case 5:
-                    case 6:
-                    case 7:
-                    //case 8:  // \b
-                    //case 9:  // \t
-                    //case 10: // \n
-                    case 11:
-                    //case 12: // \f
-                    //case 13: // \r
-                    case 14:
-                    case 15:
-                    case 16:
-                    case 17:
-                    case 18:
-                    case 19:
-                    case 20:
-                    case 21:
-                    case 22:
-                    case 23:
-                    case 24:
-                    case 25:
-                    case 26:
-                    case 27:
-                    case 28:
-                    case 29:
-                    case 30:
-                        append<fast>(std::string_view("\\u00"));
-                        appendDecN<2, fast>(*str);
-                        break;
                     case '"':
                     case '\\':
                     case '/':
@@ -730,7 +586,9 @@ namespace OpenLogReplicator {
                         append<fast>(*str);
                         break;
                     default:
-                        append<fast>(*str);
+                        // Other control characters
+                        append<fast>(std::string_view("\\u00"));
+                        appendHex2<fast>(static_cast<uint8_t>(*str));
                 }
                 ++str;
                 --size;
@@ -822,6 +680,7 @@ namespace OpenLogReplicator {
         void columnRowId(const std::string& columnName, RowId rowId) override;
         void columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) override;
         void columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction, const std::string_view& tz) override;
+        void columnLob(const std::string& columnName, const LobId& lobId, uint64_t size, uint64_t chunks) override;
         void processInsert(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
                            typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
         void processUpdate(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
@@ -830,13 +689,18 @@ namespace OpenLogReplicator {
                            typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
         void processDdl(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj) override;
         void processBeginMessage(Scn scn, Seq sequence, time_t timestamp) override;
+        void processLobChunk(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                             typeSlot slot, const LobStream& lobStream, uint64_t chunk, uint64_t chunkOffset, bool last) override;
         void addTagData(LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, Format::VALUE_TYPE valueType, FileOffset fileOffset);
 
     public:
         BuilderJson(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, Format& newFormat, uint64_t newFlushBuffer);
 
         void processCommit(Scn scn, Seq sequence, time_t timestamp) override;
+        void processProvisional(Scn scn, Seq sequence, time_t timestamp) override;
+        void processRollback(Scn scn, Seq sequence, time_t timestamp) override;
         void processCheckpoint(Scn scn, Seq sequence, time_t timestamp, FileOffset fileOffset, bool redo) override;
+        [[nodiscard]] Builder* newWorkerBuilder() override;
     };
 }
 
@@ -31,73 +31,79 @@ namespace OpenLogReplicator {
             Builder(newCtx, newLocales, newMetadata, newFormat, newFlushBuffer) {
     }
 
-    BuilderProtobuf::~BuilderProtobuf() {
-        if (redoResponsePB != nullptr) {
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-        }
-        google::protobuf::ShutdownProtobufLibrary();
-    }
-
     void BuilderProtobuf::columnFloat(const std::string& columnName, double value) {
-        valuePB->set_name(columnName);
-        valuePB->set_value_double(value);
+        appendValueBegin(columnName, 1 + sizeof(double));
+        appendFieldDouble(VALUE_DOUBLE, value);
     }
 
     // TODO: possible precision loss
     void BuilderProtobuf::columnDouble(const std::string& columnName, long double value) {
-        valuePB->set_name(columnName);
-        valuePB->set_value_double(value);
+        appendValueBegin(columnName, 1 + sizeof(double));
+        appendFieldDouble(VALUE_DOUBLE, static_cast<double>(value));
     }
 
     void BuilderProtobuf::columnString(const std::string& columnName) {
-        valuePB->set_name(columnName);
-        valuePB->set_value_string(valueBuffer, valueSize);
+        appendValueBegin(columnName, fieldSize(VALUE_STRING, valueSize));
+        appendFieldString(VALUE_STRING, valueBuffer, valueSize);
     }
 
     void BuilderProtobuf::columnNumber(const std::string& columnName, int precision, int scale) {
-        valuePB->set_name(columnName);
         valueBuffer[valueSize] = 0;
         char* retPtr;
 
         if (scale == 0 && precision <= 17) {
             const int64_t value = strtol(valueBuffer, &retPtr, 10);
-            valuePB->set_value_int(value);
+            appendValueBegin(columnName, 1 + varintSize(static_cast<uint64_t>(value)));
+            appendFieldSInt(VALUE_INT, value);
         } else if (precision <= 6 && scale < 38) {
             const float value = strtof(valueBuffer, &retPtr);
-            valuePB->set_value_float(value);
+            appendValueBegin(columnName, 1 + sizeof(float));
+            appendFieldFloat(VALUE_FLOAT, value);
         } else if (precision <= 15 && scale <= 307) {
             const double value = strtod(valueBuffer, &retPtr);
-            valuePB->set_value_double(value);
+            appendValueBegin(columnName, 1 + sizeof(double));
+            appendFieldDouble(VALUE_DOUBLE, value);
         } else {
-            valuePB->set_value_string(valueBuffer, valueSize);
+            appendValueBegin(columnName, fieldSize(VALUE_STRING, valueSize));
+            appendFieldString(VALUE_STRING, valueBuffer, valueSize);
         }
     }
 
     void BuilderProtobuf::columnRowId(const std::string& columnName, RowId rowId) {
         char str[RowId::SIZE + 1];
         rowId.toHex(str);
-        valuePB->set_name(columnName);
-        valuePB->set_value_string(str, 18);
+        appendValueBegin(columnName, fieldSize(VALUE_STRING, 18));
+        appendFieldString(VALUE_STRING, str, 18);
     }
 
     void BuilderProtobuf::columnRaw(const std::string& columnName, const uint8_t* data __attribute__((unused)), uint64_t size __attribute__((unused))) {
         // 设置列名称
-        valuePB->set_name(columnName);
+        appendValueBegin(columnName, 0);
         // TODO: 需要实现这里的二进制数据处理代码
     }
 
+    void BuilderProtobuf::columnLob(const std::string& columnName, const LobId& lobId, uint64_t size, uint64_t chunks) {
+        const std::string id(lobId.lower());
+        const uint64_t lobSize = fieldSize(LOB_ID, id.length()) + 1 + varintSize(size) + 1 + varintSize(chunks);
+        appendValueBegin(columnName, fieldSize(VALUE_LOB, lobSize));
+        appendTag(VALUE_LOB, WIRE_LENGTH);
+        appendVarint(lobSize);
+        appendFieldString(LOB_ID, id);
+        appendFieldUInt(LOB_SIZE, size);
+        appendFieldUInt(LOB_CHUNKS, chunks);
+    }
+
     void BuilderProtobuf::columnTimestamp(const std::string& columnName, time_t timestamp __attribute__((unused)),
                                           uint64_t fraction __attribute__((unused))) {
         // 设置列名称
-        valuePB->set_name(columnName);
+        appendValueBegin(columnName, 0);
         // TODO: 需要实现时间戳格式转换
     }
 
     void BuilderProtobuf::columnTimestampTz(const std::string& columnName, time_t timestamp __attribute__((unused)),
                                             uint64_t fraction __attribute__((unused)), const std::string_view& tz __attribute__((unused))) {
         // 设置列名称
-        valuePB->set_name(columnName);
+        appendValueBegin(columnName, 0);
         // TODO: 需要实现带时区的时间戳格式转换
     }
 
@@ -106,43 +112,66 @@ namespace OpenLogReplicator {
         newTran = false;
         // 开始构建一个消息，设置SCN、序列号和没有额外标志
         builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
-        // 创建一个新的Protobuf响应对象
+        // 开始一个新的Protobuf响应消息
         createResponse();
         // 添加消息头部，包含SCN、时间戳等信息
         appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
 
         // 如果不是完整消息格式，则立即发送BEGIN操作
         if (!format.isMessageFormatFull()) {
-            // 添加一个载荷项
-            redoResponsePB->add_payload();
-            // 获取最后添加的载荷引用
-            payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
-            // 设置操作类型为BEGIN
-            payloadPB->set_op(pb::BEGIN);
-
-            // 将Protobuf消息序列化为字符串
-            std::string output;
-            const bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            // 如果序列化失败，抛出异常
-            if (unlikely(!ret))
-                throw RuntimeException(50017, "PB begin processing failed, error serializing to string");
-            // 将序列化后的消息添加到输出缓冲区
-            append(output);
+            // 添加操作类型为BEGIN的载荷
+            appendPayloadBegin(pb::BEGIN);
+            appendPayloadEnd();
             // 提交构建的消息
-            builderCommit();
+            commitResponse();
         }
     }
 
+    void BuilderProtobuf::processLobChunk(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj, typeDataObj dataObj,
+                                          typeDba bdba, typeSlot slot, const LobStream& lobStream, uint64_t chunk, uint64_t chunkOffset, bool last) {
+        builderBegin(scn, sequence, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
+        createResponse();
+        appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
+
+        appendPayloadBegin(pb::LOB);
+        appendSchema(table, obj);
+        appendRowid(dataObj, bdba, slot);
+
+        const uint64_t lobStart = appendNestedBegin(PAYLOAD_LOB);
+        appendFieldString(LOB_ID, lobStream.lobId.lower());
+        appendFieldString(LOB_COLUMN, lobStream.columnName);
+        appendFieldUInt(LOB_CHUNK, chunk);
+        appendFieldUInt(LOB_OFFSET, chunkOffset);
+        appendFieldBool(LOB_LAST, last);
+
+        if (lobStream.isClob) {
+            const uint64_t pages = lobChunkPages.size();
+            for (uint64_t i = 0; i < pages; ++i)
+                parseString(lobChunkPages[i].first, lobChunkPages[i].second, lobStream.charsetId, lobStream.fileOffset, i > 0, chunkOffset > 0 || i > 0,
+                            !last || i + 1 < pages, lobStream.isSystem);
+            appendFieldString(LOB_VALUE_STRING, valueBuffer, valueSize);
+        } else {
+            uint64_t bytesSize = 0;
+            for (const auto& [data, size]: lobChunkPages)
+                bytesSize += size;
+            appendTag(LOB_VALUE_BYTES, WIRE_LENGTH);
+            appendVarint(bytesSize);
+            for (const auto& [data, size]: lobChunkPages)
+                appendArr(reinterpret_cast<const char*>(data), size);
+        }
+        appendNestedEnd(lobStart);
+        appendPayloadEnd();
+
+        commitResponse();
+    }
+
     void BuilderProtobuf::processInsert(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table,
                                         typeObj obj, typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) {
         if (newTran)
             processBeginMessage(scn, sequence, timestamp);
 
         if (format.isMessageFormatFull()) {
-            if (unlikely(redoResponsePB == nullptr))
+            if (unlikely(!hasMessage))
                 throw RuntimeException(50018, "PB insert processing failed, a message is missing");
         } else {
             builderBegin(scn, sequence, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
@@ -150,25 +179,17 @@ namespace OpenLogReplicator {
             appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
         }
 
-        redoResponsePB->add_payload();
-        payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
-        payloadPB->set_op(pb::INSERT);
-
-        schemaPB = payloadPB->mutable_schema();
+        appendPayloadBegin(pb::INSERT);
         appendSchema(table, obj);
         appendRowid(dataObj, bdba, slot);
         appendAfter(lobCtx, xmlCtx, table, fileOffset);
+        appendPayloadEnd();
 
         if (!format.isMessageFormatFull()) {
-            std::string output;
-            const bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            if (unlikely(!ret))
-                throw RuntimeException(50017, "PB insert processing failed, error serializing to string");
-            append(output);
-            builderCommit();
+            commitResponse();
+
+            if (!lobStreams.empty())
+                processLobStreams(scn, sequence, timestamp, table, obj, dataObj, bdba, slot);
         }
         ++num;
     }
@@ -179,7 +200,7 @@ namespace OpenLogReplicator {
             processBeginMessage(scn, sequence, timestamp);
 
         if (format.isMessageFormatFull()) {
-            if (unlikely(redoResponsePB == nullptr))
+            if (unlikely(!hasMessage))
                 throw RuntimeException(50018, "PB update processing failed, a message is missing");
         } else {
             builderBegin(scn, sequence, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
@@ -187,26 +208,18 @@ namespace OpenLogReplicator {
             appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
         }
 
-        redoResponsePB->add_payload();
-        payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
-        payloadPB->set_op(pb::UPDATE);
-
-        schemaPB = payloadPB->mutable_schema();
+        appendPayloadBegin(pb::UPDATE);
         appendSchema(table, obj);
         appendRowid(dataObj, bdba, slot);
         appendBefore(lobCtx, xmlCtx, table, fileOffset);
         appendAfter(lobCtx, xmlCtx, table, fileOffset);
+        appendPayloadEnd();
 
         if (!format.isMessageFormatFull()) {
-            std::string output;
-            const bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            if (unlikely(!ret))
-                throw RuntimeException(50017, "PB update processing failed, error serializing to string");
-            append(output);
-            builderCommit();
+            commitResponse();
+
+            if (!lobStreams.empty())
+                processLobStreams(scn, sequence, timestamp, table, obj, dataObj, bdba, slot);
         }
         ++num;
     }
@@ -217,7 +230,7 @@ namespace OpenLogReplicator {
             processBeginMessage(scn, sequence, timestamp);
 
         if (format.isMessageFormatFull()) {
-            if (unlikely(redoResponsePB == nullptr))
+            if (unlikely(!hasMessage))
                 throw RuntimeException(50018, "PB delete processing failed, a message is missing");
         } else {
             builderBegin(scn, sequence, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
@@ -225,26 +238,14 @@ namespace OpenLogReplicator {
             appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
         }
 
-        redoResponsePB->add_payload();
-        payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
-        payloadPB->set_op(pb::DELETE);
-
-        schemaPB = payloadPB->mutable_schema();
+        appendPayloadBegin(pb::DELETE);
         appendSchema(table, obj);
         appendRowid(dataObj, bdba, slot);
         appendBefore(lobCtx, xmlCtx, table, fileOffset);
+        appendPayloadEnd();
 
-        if (!format.isMessageFormatFull()) {
-            std::string output;
-            const bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            if (unlikely(!ret))
-                throw RuntimeException(50017, "PB delete processing failed, error serializing to string");
-            append(output);
-            builderCommit();
-        }
+        if (!format.isMessageFormatFull())
+            commitResponse();
         ++num;
     }
 
@@ -253,45 +254,27 @@ namespace OpenLogReplicator {
             processBeginMessage(scn, sequence, timestamp);
 
         if (format.isMessageFormatFull()) {
-            if (unlikely(redoResponsePB == nullptr))
+            if (unlikely(!hasMessage))
                 throw RuntimeException(50018, "PB commit processing failed, a message is missing");
         } else {
             builderBegin(scn, sequence, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
             createResponse();
             appendHeader(scn, timestamp, true, format.isDbFormatAddDdl(), true);
 
-            redoResponsePB->add_payload();
-            payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
-            payloadPB->set_op(pb::DDL);
+            appendPayloadBegin(pb::DDL);
             appendSchema(table, obj);
             // truncated to 1M
             if (ddlFirst != nullptr) {
                 const typeTransactionSize* chunkSize = reinterpret_cast<uint64_t*>(ddlFirst) + sizeof(uint8_t*);
                 const char* chunkData = reinterpret_cast<const char*>(ddlFirst) + sizeof(uint8_t*) + sizeof(uint64_t);
-                payloadPB->set_ddl(chunkData, *chunkSize);
+                appendFieldString(PAYLOAD_DDL, chunkData, *chunkSize);
             }
-        }
-
-        if (!format.isMessageFormatFull()) {
-            std::string output;
-            const bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            if (unlikely(!ret))
-                throw RuntimeException(50017, "PB commit processing failed, error serializing to string");
-            append(output);
-            builderCommit();
+            appendPayloadEnd();
+            commitResponse();
         }
         ++num;
     }
 
-    void BuilderProtobuf::initialize() {
-        Builder::initialize();
-
-        GOOGLE_PROTOBUF_VERIFY_VERSION;
-    }
-
     void BuilderProtobuf::processCommit(Scn scn, Seq sequence, time_t timestamp) {
         // Skip empty transaction
         if (newTran) {
@@ -300,28 +283,59 @@ namespace OpenLogReplicator {
         }
 
         if (format.isMessageFormatFull()) {
-            if (unlikely(redoResponsePB == nullptr))
+            if (unlikely(!hasMessage))
                 throw RuntimeException(50018, "PB commit processing failed, a message is missing");
         } else {
             builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
             createResponse();
             appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
 
-            redoResponsePB->add_payload();
-            payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
-            payloadPB->set_op(pb::COMMIT);
+            appendPayloadBegin(pb::COMMIT);
+            appendPayloadEnd();
         }
 
-        std::string output;
-        const bool ret = redoResponsePB->SerializeToString(&output);
-        delete redoResponsePB;
-        redoResponsePB = nullptr;
+        commitResponse();
+        num = 0;
+    }
+
+    void BuilderProtobuf::processProvisional(Scn scn, Seq sequence, time_t timestamp) {
+        // Skip empty part
+        if (newTran) {
+            newTran = false;
+            return;
+        }
+
+        if (format.isMessageFormatFull()) {
+            if (unlikely(!hasMessage))
+                throw RuntimeException(50018, "PB provisional processing failed, a message is missing");
+        } else {
+            builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+            createResponse();
+            appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
+        }
 
-        if (unlikely(!ret))
-            throw RuntimeException(50017, "PB commit processing failed, error serializing to string");
-        append(output);
-        builderCommit();
+        appendPayloadBegin(pb::PROVISIONAL);
+        appendPayloadEnd();
 
+        commitResponse();
+        num = 0;
+    }
+
+    void BuilderProtobuf::processRollback(Scn scn, Seq sequence, time_t timestamp) {
+        if (format.isMessageFormatFull() && !newTran) {
+            if (unlikely(!hasMessage))
+                throw RuntimeException(50018, "PB rollback processing failed, a message is missing");
+        } else {
+            newTran = false;
+            builderBegin(scn, sequence, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
+            createResponse();
+            appendHeader(scn, timestamp, true, format.isDbFormatAddDml(), true);
+        }
+
+        appendPayloadBegin(pb::ROLLBACK);
+        appendPayloadEnd();
+
+        commitResponse();
         num = 0;
     }
 
@@ -338,21 +352,21 @@ namespace OpenLogReplicator {
         createResponse();
         appendHeader(scn, timestamp, true, false, false);
 
-        redoResponsePB->add_payload();
-        payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
-        payloadPB->set_op(pb::CHKPT);
-        payloadPB->set_seq(sequence.getData());
-        payloadPB->set_offset(fileOffset.getData());
-        payloadPB->set_redo(redo);
-
-        std::string output;
-        const bool ret = redoResponsePB->SerializeToString(&output);
-        delete redoResponsePB;
-        redoResponsePB = nullptr;
-
-        if (unlikely(!ret))
-            throw RuntimeException(50017, "PB commit processing failed, error serializing to string");
-        append(output);
-        builderCommit();
+        appendPayloadBegin(pb::CHKPT);
+        appendFieldUInt(PAYLOAD_SEQ, sequence.getData());
+        appendFieldUInt(PAYLOAD_OFFSET, fileOffset.getData());
+        appendFieldBool(PAYLOAD_REDO, redo);
+        appendPayloadEnd();
+
+        commitResponse();
+    }
+
+    Builder* BuilderProtobuf::newWorkerBuilder() {
+        auto* workerBuilder = new BuilderProtobuf(ctx, locales, metadata, format, flushBuffer);
+        workerBuilder->setMaxMessageMb(maxMessageMb);
+        workerBuilder->setStreamTransactionMb(streamTransactionMb);
+        workerBuilder->setLobStreamMb(lobStreamMb);
+        workerBuilder->initialize();
+        return workerBuilder;
     }
 }
@@ -27,12 +27,206 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "Builder.h"
 
 namespace OpenLogReplicator {
+    // Messages are encoded in protobuf wire format directly into the output buffer, compatible with proto/OraProtoBuf.proto
     class BuilderProtobuf final : public Builder {
     protected:
-        pb::RedoResponse* redoResponsePB{nullptr};
-        pb::Value* valuePB{nullptr};
-        pb::Payload* payloadPB{nullptr};
-        pb::Schema* schemaPB{nullptr};
+        static constexpr uint WIRE_VARINT{0};
+        static constexpr uint WIRE_FIXED64{1};
+        static constexpr uint WIRE_LENGTH{2};
+        static constexpr uint WIRE_FIXED32{5};
+        // Length of a nested message is written after its content, the space is reserved as a padded varint
+        static constexpr uint64_t LENGTH_RESERVED{5};
+
+        // RedoResponse fields
+        static constexpr uint RESPONSE_CODE{1};
+        static constexpr uint RESPONSE_SCN{2};
+        static constexpr uint RESPONSE_SCNS{3};
+        static constexpr uint RESPONSE_TM{4};
+        static constexpr uint RESPONSE_TMS{5};
+        static constexpr uint RESPONSE_XID{6};
+        static constexpr uint RESPONSE_XIDN{7};
+        static constexpr uint RESPONSE_DB{8};
+        static constexpr uint RESPONSE_PAYLOAD{9};
+        static constexpr uint RESPONSE_C_SCN{10};
+        static constexpr uint RESPONSE_C_IDX{11};
+
+        // Payload fields
+        static constexpr uint PAYLOAD_OP{1};
+        static constexpr uint PAYLOAD_SCHEMA{2};
+        static constexpr uint PAYLOAD_RID{3};
+        static constexpr uint PAYLOAD_BEFORE{4};
+        static constexpr uint PAYLOAD_AFTER{5};
+        static constexpr uint PAYLOAD_DDL{6};
+        static constexpr uint PAYLOAD_SEQ{7};
+        static constexpr uint PAYLOAD_OFFSET{8};
+        static constexpr uint PAYLOAD_REDO{9};
+        static constexpr uint PAYLOAD_NUM{10};
+        static constexpr uint PAYLOAD_LOB{11};
+
+        // Schema and Column fields
+        static constexpr uint SCHEMA_OWNER{1};
+        static constexpr uint SCHEMA_NAME{2};
+        static constexpr uint SCHEMA_OBJ{3};
+        static constexpr uint SCHEMA_COLUMN{6};
+        static constexpr uint COLUMN_NAME{1};
+        static constexpr uint COLUMN_TYPE{2};
+        static constexpr uint COLUMN_LENGTH{3};
+        static constexpr uint COLUMN_PRECISION{4};
+        static constexpr uint COLUMN_SCALE{5};
+        static constexpr uint COLUMN_NULLABLE{6};
+
+        // Value fields
+        static constexpr uint VALUE_NAME{1};
+        static constexpr uint VALUE_INT{2};
+        static constexpr uint VALUE_FLOAT{3};
+        static constexpr uint VALUE_DOUBLE{4};
+        static constexpr uint VALUE_STRING{5};
+        static constexpr uint VALUE_BYTES{6};
+        static constexpr uint VALUE_LOB{7};
+
+        // Lob fields
+        static constexpr uint LOB_ID{1};
+        static constexpr uint LOB_COLUMN{2};
+        static constexpr uint LOB_SIZE{3};
+        static constexpr uint LOB_CHUNKS{4};
+        static constexpr uint LOB_CHUNK{5};
+        static constexpr uint LOB_OFFSET{6};
+        static constexpr uint LOB_LAST{7};
+        static constexpr uint LOB_VALUE_STRING{8};
+        static constexpr uint LOB_VALUE_BYTES{9};
+
+        bool hasMessage{false};
+        uint64_t payloadStart{0};
+        // PAYLOAD_BEFORE or PAYLOAD_AFTER for values written by processValue
+        uint valueField{PAYLOAD_AFTER};
+
+        static uint varintSize(uint64_t value) {
+            return ((64 - __builtin_clzll(value | 1)) + 6) / 7;
+        }
+
+        static uint64_t fieldSize(uint field, uint64_t size) {
+            return varintSize(field << 3) + varintSize(size) + size;
+        }
+
+        [[nodiscard]] uint64_t messageOffset() const {
+            return messageSize + messagePosition;
+        }
+
+        void appendVarint(uint64_t value) {
+            if (likely(lastBuilderSize + messagePosition + 10 < OUTPUT_BUFFER_DATA_SIZE)) {
+                uint8_t* ptr = lastBuilderQueue->data + lastBuilderSize + messagePosition;
+                while (value >= 0x80) {
+                    *ptr++ = static_cast<uint8_t>(value | 0x80);
+                    value >>= 7;
+                }
+                *ptr++ = static_cast<uint8_t>(value);
+                messagePosition = ptr - (lastBuilderQueue->data + lastBuilderSize);
+            } else {
+                while (value >= 0x80) {
+                    append(static_cast<char>(value | 0x80));
+                    value >>= 7;
+                }
+                append(static_cast<char>(value));
+            }
+        }
+
+        void appendTag(uint field, uint wireType) {
+            appendVarint((field << 3) | wireType);
+        }
+
+        void appendFieldUInt(uint field, uint64_t value) {
+            appendTag(field, WIRE_VARINT);
+            appendVarint(value);
+        }
+
+        // int32 and int64 negative values are sign extended to 10 bytes
+        void appendFieldSInt(uint field, int64_t value) {
+            appendTag(field, WIRE_VARINT);
+            appendVarint(static_cast<uint64_t>(value));
+        }
+
+        void appendFieldBool(uint field, bool value) {
+            appendTag(field, WIRE_VARINT);
+            append(value ? '\1' : '\0');
+        }
+
+        void appendFieldFloat(uint field, float value) {
+            char buffer[sizeof(float)];
+            memcpy(reinterpret_cast<void*>(buffer), reinterpret_cast<const void*>(&value), sizeof(float));
+            appendTag(field, WIRE_FIXED32);
+            appendArr(buffer, sizeof(float));
+        }
+
+        void appendFieldDouble(uint field, double value) {
+            char buffer[sizeof(double)];
+            memcpy(reinterpret_cast<void*>(buffer), reinterpret_cast<const void*>(&value), sizeof(double));
+            appendTag(field, WIRE_FIXED64);
+            appendArr(buffer, sizeof(double));
+        }
+
+        void appendFieldString(uint field, const char* str, uint64_t size) {
+            appendTag(field, WIRE_LENGTH);
+            appendVarint(size);
+            appendArr(str, size);
+        }
+
+        void appendFieldString(uint field, const std::string& str) {
+            appendFieldString(field, str.c_str(), str.length());
+        }
+
+        // Returns the position of the reserved length, to be passed to appendNestedEnd()
+        uint64_t appendNestedBegin(uint field) {
+            appendTag(field, WIRE_LENGTH);
+            const uint64_t offset = messageOffset();
+            appendArr("\x80\x80\x80\x80\x00", LENGTH_RESERVED);
+            return offset;
+        }
+
+        void appendNestedEnd(uint64_t offset) {
+            const uint64_t length = messageOffset() - offset - LENGTH_RESERVED;
+            if (unlikely(length >= (1ULL << (7 * LENGTH_RESERVED))))
+                throw RuntimeException(50076, "PB nested message processing failed, size: " + std::to_string(length) + " exceeds maximum");
+
+            uint8_t buffer[LENGTH_RESERVED];
+            for (uint i = 0; i < LENGTH_RESERVED; ++i)
+                buffer[i] = static_cast<uint8_t>(((length >> (7 * i)) & 0x7F) | (i + 1 < LENGTH_RESERVED ? 0x80 : 0));
+
+            if (likely(offset >= messageSize)) {
+                memcpy(reinterpret_cast<void*>(lastBuilderQueue->data + lastBuilderSize + (offset - messageSize)),
+                       reinterpret_cast<const void*>(buffer), LENGTH_RESERVED);
+                return;
+            }
+
+            // The message continues in the following buffers and the length stayed in an earlier one
+            BuilderQueue* builderQueue = firstBuilderQueue;
+            const auto* msgData = reinterpret_cast<const uint8_t*>(msg);
+            while (msgData < builderQueue->data || msgData >= builderQueue->data + OUTPUT_BUFFER_DATA_SIZE)
+                builderQueue = builderQueue->next;
+            uint64_t pos = (msgData - builderQueue->data) + offset;
+            for (uint i = 0; i < LENGTH_RESERVED; ++i, ++pos) {
+                while (pos >= OUTPUT_BUFFER_DATA_SIZE) {
+                    pos -= OUTPUT_BUFFER_DATA_SIZE;
+                    builderQueue = builderQueue->next;
+                }
+                builderQueue->data[pos] = buffer[i];
+            }
+        }
+
+        // Value fields have known sizes, so the length is written upfront
+        void appendValueBegin(const std::string& columnName, uint64_t datumSize) {
+            appendTag(valueField, WIRE_LENGTH);
+            appendVarint(fieldSize(VALUE_NAME, columnName.length()) + datumSize);
+            appendFieldString(VALUE_NAME, columnName);
+        }
+
+        void appendPayloadBegin(pb::Op op) {
+            payloadStart = appendNestedBegin(RESPONSE_PAYLOAD);
+            appendFieldUInt(PAYLOAD_OP, static_cast<uint64_t>(op));
+        }
+
+        void appendPayloadEnd() {
+            appendNestedEnd(payloadStart);
+        }
 
         void columnNull(const DbTable* table, typeCol col, bool after) {
             if (table != nullptr && format.unknownType == Format::UNKNOWN_TYPE::HIDE) {
@@ -69,17 +263,17 @@ namespace OpenLogReplicator {
             }
 
             if (table == nullptr || ctx->isFlagSet(Ctx::REDO_FLAGS::RAW_COLUMN_DATA)) {
-                std::string columnName("COL_" + std::to_string(col));
-                valuePB->set_name(columnName);
+                const std::string columnName("COL_" + std::to_string(col));
+                appendValueBegin(columnName, 0);
                 return;
             }
 
-            valuePB->set_name(table->columns[col]->name);
+            appendValueBegin(table->columns[col]->name, 0);
         }
 
         void appendRowid(typeDataObj dataObj, typeDba bdba, typeSlot slot) {
             if (format.isMessageFormatAddSequences())
-                payloadPB->set_num(num);
+                appendFieldUInt(PAYLOAD_NUM, num);
 
             if (format.ridFormat == Format::RID_FORMAT::SKIP)
                 return;
@@ -87,19 +281,19 @@ namespace OpenLogReplicator {
                 const RowId rowId(dataObj, bdba, slot);
                 char str[RowId::SIZE + 1];
                 rowId.toString(str);
-                payloadPB->set_rid(str, 18);
+                appendFieldString(PAYLOAD_RID, str, 18);
             }
         }
 
         void appendHeader(Scn scn, time_t timestamp, bool first, bool showDb, bool showXid) {
-            redoResponsePB->set_code(pb::ResponseCode::PAYLOAD);
+            appendFieldUInt(RESPONSE_CODE, pb::ResponseCode::PAYLOAD);
             if (first || format.isScnTypeAllPayloads()) {
                 if (format.scnFormat == Format::SCN_FORMAT::TEXT_HEX) {
                     char buf[17];
                     numToString(scn.getData(), buf, 16);
-                    redoResponsePB->set_scns(buf);
+                    appendFieldString(RESPONSE_SCNS, buf, 16);
                 } else {
-                    redoResponsePB->set_scn(scn.getData());
+                    appendFieldUInt(RESPONSE_SCN, scn.getData());
                 }
             }
 
@@ -107,45 +301,44 @@ namespace OpenLogReplicator {
                 std::string str;
                 switch (format.timestampFormat) {
                     case Format::TIMESTAMP_FORMAT::UNIX_NANO:
-                        redoResponsePB->set_tm(timestamp * 1000000000L);
+                        appendFieldUInt(RESPONSE_TM, timestamp * 1000000000L);
                         break;
 
                     case Format::TIMESTAMP_FORMAT::UNIX_MICRO:
-                        redoResponsePB->set_tm(timestamp * 1000000L);
+                        appendFieldUInt(RESPONSE_TM, timestamp * 1000000L);
                         break;
 
                     case Format::TIMESTAMP_FORMAT::UNIX_MILLI:
-                        redoResponsePB->set_tm(timestamp * 1000L);
+                        appendFieldUInt(RESPONSE_TM, timestamp * 1000L);
                         break;
 
                     case Format::TIMESTAMP_FORMAT::UNIX:
-                        redoResponsePB->set_tm(timestamp);
+                        appendFieldUInt(RESPONSE_TM, timestamp);
                         break;
 
                     case Format::TIMESTAMP_FORMAT::UNIX_NANO_STRING:
                         str = std::to_string(timestamp * 1000000000L);
-                        redoResponsePB->set_tms(str);
+                        appendFieldString(RESPONSE_TMS, str);
                         break;
 
                     case Format::TIMESTAMP_FORMAT::UNIX_MICRO_STRING:
                         str = std::to_string(timestamp * 1000000L);
-                        redoResponsePB->set_tms(str);
+                        appendFieldString(RESPONSE_TMS, str);
                         break;
 
                     case Format::TIMESTAMP_FORMAT::UNIX_MILLI_STRING:
                         str = std::to_string(timestamp * 1000L);
-                        redoResponsePB->set_tms(str);
+                        appendFieldString(RESPONSE_TMS, str);
                         break;
 
                     case Format::TIMESTAMP_FORMAT::UNIX_STRING:
                         str = std::to_string(timestamp);
-                        redoResponsePB->set_tms(str);
+                        appendFieldString(RESPONSE_TMS, str);
                         break;
 
                     case Format::TIMESTAMP_FORMAT::ISO8601:
                         char buffer[22];
-                        str.assign(buffer, Data::epochToIso8601(timestamp, buffer, true, true));
-                        redoResponsePB->set_tms(str);
+                        appendFieldString(RESPONSE_TMS, buffer, Data::epochToIso8601(timestamp, buffer, true, true));
                         break;
 
                     default:
@@ -153,8 +346,8 @@ namespace OpenLogReplicator {
                 }
             }
 
-            redoResponsePB->set_c_scn(lwnScn.getData());
-            redoResponsePB->set_c_idx(lwnIdx);
+            appendFieldUInt(RESPONSE_C_SCN, lwnScn.getData());
+            appendFieldUInt(RESPONSE_C_IDX, lwnIdx);
 
             if (showXid) {
                 if (format.xidFormat == Format::XID_FORMAT::TEXT_HEX) {
@@ -165,7 +358,7 @@ namespace OpenLogReplicator {
                     ss << std::setfill('0') << std::setw(3) << std::hex << static_cast<uint>(lastXid.slt());
                     ss << '.';
                     ss << std::setfill('0') << std::setw(8) << std::hex << static_cast<uint>(lastXid.sqn());
-                    redoResponsePB->set_xid(ss.str());
+                    appendFieldString(RESPONSE_XID, ss.str());
                 } else if (format.xidFormat == Format::XID_FORMAT::TEXT_DEC) {
                     std::ostringstream ss;
                     ss << static_cast<uint>(lastXid.usn());
@@ -173,160 +366,161 @@ namespace OpenLogReplicator {
                     ss << static_cast<uint>(lastXid.slt());
                     ss << '.';
                     ss << static_cast<uint>(lastXid.sqn());
-                    redoResponsePB->set_xid(ss.str());
+                    appendFieldString(RESPONSE_XID, ss.str());
                 } else if (format.xidFormat == Format::XID_FORMAT::NUMERIC) {
-                    redoResponsePB->set_xidn(lastXid.getData());
+                    appendFieldUInt(RESPONSE_XIDN, lastXid.getData());
                 }
             }
 
             if (showDb)
-                redoResponsePB->set_db(metadata->conName);
+                appendFieldString(RESPONSE_DB, metadata->conName);
         }
 
         void appendSchema(const DbTable* table, typeObj obj) {
+            const uint64_t schemaStart = appendNestedBegin(PAYLOAD_SCHEMA);
             if (unlikely(table == nullptr)) {
                 std::string ownerName;
                 std::string tableName;
                 // try to read object name from ongoing uncommitted transaction data
                 if (metadata->schema->checkTableDictUncommitted(obj, ownerName, tableName)) {
-                    schemaPB->set_owner(ownerName);
-                    schemaPB->set_name(tableName);
+                    appendFieldString(SCHEMA_OWNER, ownerName);
+                    appendFieldString(SCHEMA_NAME, tableName);
                 } else {
                     tableName = "OBJ_" + std::to_string(obj);
-                    schemaPB->set_name(tableName);
+                    appendFieldString(SCHEMA_NAME, tableName);
                 }
 
                 if (format.isSchemaFormatObj())
-                    schemaPB->set_obj(obj);
+                    appendFieldUInt(SCHEMA_OBJ, obj);
 
+                appendNestedEnd(schemaStart);
                 return;
             }
 
-            schemaPB->set_owner(table->owner);
-            schemaPB->set_name(table->name);
+            appendFieldString(SCHEMA_OWNER, table->owner);
+            appendFieldString(SCHEMA_NAME, table->name);
 
             if (format.isSchemaFormatObj())
-                schemaPB->set_obj(obj);
+                appendFieldUInt(SCHEMA_OBJ, obj);
 
             if (format.isSchemaFormatFull()) {
                 if (!format.isSchemaFormatRepeated()) {
-                    if (tables.count(table) > 0)
+                    if (tables.count(table) > 0) {
+                        appendNestedEnd(schemaStart);
                         return;
+                    }
                     tables.insert(table);
                 }
 
-                schemaPB->add_column();
-                pb::Column* columnPB = schemaPB->mutable_column(schemaPB->column_size() - 1);
-
                 for (typeCol column = 0; column < static_cast<typeCol>(table->columns.size()); ++column) {
                     if (table->columns[column] == nullptr)
                         continue;
 
-                    columnPB->set_name(table->columns[column]->name);
+                    const uint64_t columnStart = appendNestedBegin(SCHEMA_COLUMN);
+                    appendFieldString(COLUMN_NAME, table->columns[column]->name);
 
                     switch (table->columns[column]->type) {
                         case SysCol::COLTYPE::VARCHAR:
-                            columnPB->set_type(pb::VARCHAR2);
-                            columnPB->set_length(static_cast<int32_t>(table->columns[column]->length));
+                            appendFieldUInt(COLUMN_TYPE, pb::VARCHAR2);
+                            appendFieldSInt(COLUMN_LENGTH, static_cast<int32_t>(table->columns[column]->length));
                             break;
 
                         case SysCol::COLTYPE::NUMBER:
-                            columnPB->set_type(pb::NUMBER);
-                            columnPB->set_precision(static_cast<int32_t>(table->columns[column]->precision));
-                            columnPB->set_scale(static_cast<int32_t>(table->columns[column]->scale));
+                            appendFieldUInt(COLUMN_TYPE, pb::NUMBER);
+                            appendFieldSInt(COLUMN_PRECISION, static_cast<int32_t>(table->columns[column]->precision));
+                            appendFieldSInt(COLUMN_SCALE, static_cast<int32_t>(table->columns[column]->scale));
                             break;
 
                         case SysCol::COLTYPE::LONG:
                             // Long, not supported
-                            columnPB->set_type(pb::LONG);
+                            appendFieldUInt(COLUMN_TYPE, pb::LONG);
                             break;
 
                         case SysCol::COLTYPE::DATE:
-                            columnPB->set_type(pb::DATE);
+                            appendFieldUInt(COLUMN_TYPE, pb::DATE);
                             break;
 
                         case SysCol::COLTYPE::RAW:
-                            columnPB->set_type(pb::RAW);
-                            columnPB->set_length(static_cast<int32_t>(table->columns[column]->length));
+                            appendFieldUInt(COLUMN_TYPE, pb::RAW);
+                            appendFieldSInt(COLUMN_LENGTH, static_cast<int32_t>(table->columns[column]->length));
                             break;
 
                         case SysCol::COLTYPE::LONG_RAW: // Not supported
-                            columnPB->set_type(pb::LONG_RAW);
+                            appendFieldUInt(COLUMN_TYPE, pb::LONG_RAW);
                             break;
 
                         case SysCol::COLTYPE::CHAR:
-                            columnPB->set_type(pb::CHAR);
-                            columnPB->set_length(static_cast<int32_t>(table->columns[column]->length));
+                            appendFieldUInt(COLUMN_TYPE, pb::CHAR);
+                            appendFieldSInt(COLUMN_LENGTH, static_cast<int32_t>(table->columns[column]->length));
                             break;
 
                         case SysCol::COLTYPE::FLOAT:
-                            columnPB->set_type(pb::BINARY_FLOAT);
+                            appendFieldUInt(COLUMN_TYPE, pb::BINARY_FLOAT);
                             break;
 
                         case SysCol::COLTYPE::DOUBLE:
-                            columnPB->set_type(pb::BINARY_DOUBLE);
+                            appendFieldUInt(COLUMN_TYPE, pb::BINARY_DOUBLE);
                             break;
 
                         case SysCol::COLTYPE::CLOB:
-                            columnPB->set_type(pb::CLOB);
+                            appendFieldUInt(COLUMN_TYPE, pb::CLOB);
                             break;
 
                         case SysCol::COLTYPE::BLOB:
-                            columnPB->set_type(pb::BLOB);
+                            appendFieldUInt(COLUMN_TYPE, pb::BLOB);
                             break;
 
                         case SysCol::COLTYPE::TIMESTAMP:
-                            columnPB->set_type(pb::TIMESTAMP);
-                            columnPB->set_length(static_cast<int32_t>(table->columns[column]->length));
+                            appendFieldUInt(COLUMN_TYPE, pb::TIMESTAMP);
+                            appendFieldSInt(COLUMN_LENGTH, static_cast<int32_t>(table->columns[column]->length));
                             break;
 
                         case SysCol::COLTYPE::TIMESTAMP_WITH_TZ:
-                            columnPB->set_type(pb::TIMESTAMP_WITH_TZ);
-                            columnPB->set_length(static_cast<int32_t>(table->columns[column]->length));
+                            appendFieldUInt(COLUMN_TYPE, pb::TIMESTAMP_WITH_TZ);
+                            appendFieldSInt(COLUMN_LENGTH, static_cast<int32_t>(table->columns[column]->length));
                             break;
 
                         case SysCol::COLTYPE::INTERVAL_YEAR_TO_MONTH:
-                            columnPB->set_type(pb::INTERVAL_YEAR_TO_MONTH);
-                            columnPB->set_length(static_cast<int32_t>(table->columns[column]->length));
+                            appendFieldUInt(COLUMN_TYPE, pb::INTERVAL_YEAR_TO_MONTH);
+                            appendFieldSInt(COLUMN_LENGTH, static_cast<int32_t>(table->columns[column]->length));
                             break;
 
                         case SysCol::COLTYPE::INTERVAL_DAY_TO_SECOND:
-                            columnPB->set_type(pb::INTERVAL_DAY_TO_SECOND);
-                            columnPB->set_length(static_cast<int32_t>(table->columns[column]->length));
+                            appendFieldUInt(COLUMN_TYPE, pb::INTERVAL_DAY_TO_SECOND);
+                            appendFieldSInt(COLUMN_LENGTH, static_cast<int32_t>(table->columns[column]->length));
                             break;
 
                         case SysCol::COLTYPE::UROWID:
-                            columnPB->set_type(pb::UROWID);
-                            columnPB->set_length(static_cast<int32_t>(table->columns[column]->length));
+                            appendFieldUInt(COLUMN_TYPE, pb::UROWID);
+                            appendFieldSInt(COLUMN_LENGTH, static_cast<int32_t>(table->columns[column]->length));
                             break;
 
                         case SysCol::COLTYPE::TIMESTAMP_WITH_LOCAL_TZ:
-                            columnPB->set_type(pb::TIMESTAMP_WITH_LOCAL_TZ);
-                            columnPB->set_length(static_cast<int32_t>(table->columns[column]->length));
+                            appendFieldUInt(COLUMN_TYPE, pb::TIMESTAMP_WITH_LOCAL_TZ);
+                            appendFieldSInt(COLUMN_LENGTH, static_cast<int32_t>(table->columns[column]->length));
                             break;
 
                         default:
-                            columnPB->set_type(pb::UNKNOWN);
+                            appendFieldUInt(COLUMN_TYPE, pb::UNKNOWN);
                             break;
                     }
 
-                    columnPB->set_nullable(table->columns[column]->nullable);
+                    appendFieldBool(COLUMN_NULLABLE, table->columns[column]->nullable);
+                    appendNestedEnd(columnStart);
                 }
             }
+            appendNestedEnd(schemaStart);
         }
 
         void appendAfter(LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, FileOffset fileOffset) {
+            valueField = PAYLOAD_AFTER;
             if (format.columnFormat > Format::COLUMN_FORMAT::CHANGED && table != nullptr) {
                 for (typeCol column = 0; column < table->maxSegCol; ++column) {
                     if (values[column][static_cast<uint>(Format::VALUE_TYPE::AFTER)] != nullptr) {
                         if (sizes[column][static_cast<uint>(Format::VALUE_TYPE::AFTER)] > 0) {
-                            payloadPB->add_after();
-                            valuePB = payloadPB->mutable_after(payloadPB->after_size() - 1);
                             processValue(lobCtx, xmlCtx, table, column, values[column][static_cast<uint>(Format::VALUE_TYPE::AFTER)],
                                          sizes[column][static_cast<uint>(Format::VALUE_TYPE::AFTER)], fileOffset, true, compressedAfter);
                         } else {
-                            payloadPB->add_after();
-                            valuePB = payloadPB->mutable_after(payloadPB->after_size() - 1);
                             columnNull(table, column, true);
                         }
                     }
@@ -343,13 +537,9 @@ namespace OpenLogReplicator {
 
                         if (values[column][static_cast<uint>(Format::VALUE_TYPE::AFTER)] != nullptr) {
                             if (sizes[column][static_cast<uint>(Format::VALUE_TYPE::AFTER)] > 0) {
-                                payloadPB->add_after();
-                                valuePB = payloadPB->mutable_after(payloadPB->after_size() - 1);
                                 processValue(lobCtx, xmlCtx, table, column, values[column][static_cast<uint>(Format::VALUE_TYPE::AFTER)],
                                              sizes[column][static_cast<uint>(Format::VALUE_TYPE::AFTER)], fileOffset, true, compressedAfter);
                             } else {
-                                payloadPB->add_after();
-                                valuePB = payloadPB->mutable_after(payloadPB->after_size() - 1);
                                 columnNull(table, column, true);
                             }
                         }
@@ -359,17 +549,14 @@ namespace OpenLogReplicator {
         }
 
         void appendBefore(LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, FileOffset fileOffset) {
+            valueField = PAYLOAD_BEFORE;
             if (format.columnFormat > Format::COLUMN_FORMAT::CHANGED && table != nullptr) {
                 for (typeCol column = 0; column < table->maxSegCol; ++column) {
                     if (values[column][static_cast<uint>(Format::VALUE_TYPE::BEFORE)] != nullptr) {
                         if (sizes[column][static_cast<uint>(Format::VALUE_TYPE::BEFORE)] > 0) {
-                            payloadPB->add_before();
-                            valuePB = payloadPB->mutable_before(payloadPB->before_size() - 1);
                             processValue(lobCtx, xmlCtx, table, column, values[column][static_cast<uint>(Format::VALUE_TYPE::BEFORE)],
                                          sizes[column][static_cast<uint>(Format::VALUE_TYPE::BEFORE)], fileOffset, false, compressedBefore);
                         } else {
-                            payloadPB->add_before();
-                            valuePB = payloadPB->mutable_before(payloadPB->before_size() - 1);
                             columnNull(table, column, false);
                         }
                     }
@@ -386,13 +573,9 @@ namespace OpenLogReplicator {
 
                         if (values[column][static_cast<uint>(Format::VALUE_TYPE::BEFORE)] != nullptr) {
                             if (sizes[column][static_cast<uint>(Format::VALUE_TYPE::BEFORE)] > 0) {
-                                payloadPB->add_before();
-                                valuePB = payloadPB->mutable_before(payloadPB->before_size() - 1);
                                 processValue(lobCtx, xmlCtx, table, column, values[column][static_cast<uint>(Format::VALUE_TYPE::BEFORE)],
                                              sizes[column][static_cast<uint>(Format::VALUE_TYPE::BEFORE)], fileOffset, false, compressedBefore);
                             } else {
-                                payloadPB->add_before();
-                                valuePB = payloadPB->mutable_before(payloadPB->before_size() - 1);
                                 columnNull(table, column, false);
                             }
                         }
@@ -402,9 +585,14 @@ namespace OpenLogReplicator {
         }
 
         void createResponse() {
-            if (unlikely(redoResponsePB != nullptr))
+            if (unlikely(hasMessage))
                 throw RuntimeException(50016, "PB commit processing failed, message already exists");
-            redoResponsePB = new pb::RedoResponse;
+            hasMessage = true;
+        }
+
+        void commitResponse() {
+            hasMessage = false;
+            builderCommit();
         }
 
         static void numToString(uint64_t value, char* buf, uint64_t size) {
@@ -424,6 +612,7 @@ namespace OpenLogReplicator {
         void columnRowId(const std::string& columnName, RowId rowId) override;
         void columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) override;
         void columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction, const std::string_view& tz) override;
+        void columnLob(const std::string& columnName, const LobId& lobId, uint64_t size, uint64_t chunks) override;
         void processInsert(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
                            typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
         void processUpdate(Scn scn, Seq sequence, time_t timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
@@ -432,14 +621,17 @@ namespace OpenLogReplicator {
                            typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
         void processDdl(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj) override;
         void processBeginMessage(Scn scn, Seq sequence, time_t timestamp) override;
+        void processLobChunk(Scn scn, Seq sequence, time_t timestamp, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                             typeSlot slot, const LobStream& lobStream, uint64_t chunk, uint64_t chunkOffset, bool last) override;
 
     public:
         BuilderProtobuf(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, Format& newFormat, uint64_t newFlushBuffer);
-        ~BuilderProtobuf() override;
 
-        void initialize() override;
         void processCommit(Scn scn, Seq sequence, time_t timestamp) override;
+        void processProvisional(Scn scn, Seq sequence, time_t timestamp) override;
+        void processRollback(Scn scn, Seq sequence, time_t timestamp) override;
         void processCheckpoint(Scn scn, Seq sequence, time_t timestamp, FileOffset fileOffset, bool redo) override;
+        [[nodiscard]] Builder* newWorkerBuilder() override;
     };
 }
 
@@ -420,6 +420,8 @@ namespace OpenLogReplicator {
         const auto& it = metadata->schema->schemaXmlMap.find(table->tokSuf);
         if (unlikely(it == metadata->schema->schemaXmlMap.end()))
             throw DataException(50068, "missing " + XdbXNm::tableName() + table->tokSuf + " table, find failed");
+        // Only the contexts with changed dictionaries rebuild the token cache on commit
+        it->second->tokensChanged = true;
         return it->second;
     }
 
@@ -732,13 +734,14 @@ namespace OpenLogReplicator {
         if (!metadata->schema->touched)
             return;
 
+        builder->flushTables();
         std::vector<std::string> msgs;
         std::unordered_map<typeObj, std::string> tablesDropped;
         std::unordered_map<typeObj, std::string> tablesUpdated;
         metadata->schema->scn = scn;
         metadata->schema->dropUnusedMetadata(metadata->users, metadata->schemaElements, tablesDropped);
 
-        metadata->buildMaps(msgs, tablesUpdated);
+        metadata->buildMaps(msgs, tablesUpdated, true);
         metadata->schema->resetTouched();
 
         for (const auto& msg: msgs)
@@ -0,0 +1,408 @@
+/* Compression of output messages
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef LINK_LIBRARY_ZSTD
+#include <zdict.h>
+#include <zstd.h>
+#endif /* LINK_LIBRARY_ZSTD */
+
+#ifdef LINK_LIBRARY_LZ4
+#include <lz4.h>
+#endif /* LINK_LIBRARY_LZ4 */
+
+#include "Compressor.h"
+#include "Ctx.h"
+#include "exception/RuntimeException.h"
+
+namespace OpenLogReplicator {
+    Compressor::Compressor(CODEC newCodec, int newLevel, uint64_t newDictionarySize) :
+            codec(newCodec),
+            level(newLevel),
+            dictionarySize(newDictionarySize) {
+#ifdef LINK_LIBRARY_ZSTD
+        compressCtx = ZSTD_createCCtx();
+        decompressCtx = ZSTD_createDCtx();
+#endif /* LINK_LIBRARY_ZSTD */
+#ifdef LINK_LIBRARY_LZ4
+        if (codec == CODEC::LZ4) {
+            if (dictionarySize > LZ4_DICTIONARY_MAX)
+                dictionarySize = LZ4_DICTIONARY_MAX;
+            lz4Stream = LZ4_createStream();
+        }
+#endif /* LINK_LIBRARY_LZ4 */
+    }
+
+    Compressor::~Compressor() {
+        for (auto& [_, dictionary]: tables)
+            releaseDictionary(dictionary);
+        tables.clear();
+        for (auto& [_, dictionary]: received)
+            releaseDictionary(dictionary);
+        received.clear();
+
+#ifdef LINK_LIBRARY_ZSTD
+        ZSTD_freeCCtx(reinterpret_cast<ZSTD_CCtx*>(compressCtx));
+        ZSTD_freeDCtx(reinterpret_cast<ZSTD_DCtx*>(decompressCtx));
+#endif /* LINK_LIBRARY_ZSTD */
+#ifdef LINK_LIBRARY_LZ4
+        if (lz4Stream != nullptr)
+            LZ4_freeStream(reinterpret_cast<LZ4_stream_t*>(lz4Stream));
+#endif /* LINK_LIBRARY_LZ4 */
+    }
+
+    bool Compressor::isCompiled(CODEC codec) {
+        switch (codec) {
+            case CODEC::STORED:
+                return true;
+
+            case CODEC::ZSTD:
+#ifdef LINK_LIBRARY_ZSTD
+                return true;
+#else
+                return false;
+#endif /* LINK_LIBRARY_ZSTD */
+
+            case CODEC::LZ4:
+#ifdef LINK_LIBRARY_LZ4
+                return true;
+#else
+                return false;
+#endif /* LINK_LIBRARY_LZ4 */
+        }
+        return false;
+    }
+
+    const char* Compressor::codecName(CODEC codec) {
+        switch (codec) {
+            case CODEC::STORED:
+                return "stored";
+            case CODEC::ZSTD:
+                return "zstd";
+            case CODEC::LZ4:
+                return "lz4";
+        }
+        return "unknown";
+    }
+
+    uint32_t Compressor::dictionaryId(const std::string& data) {
+        // FNV-1a, the same dictionary gets the same id after restart
+        uint32_t hash = 2166136261U;
+        for (const char c: data) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619U;
+        }
+        if (hash == 0)
+            hash = 1;
+        return hash;
+    }
+
+    void Compressor::train(Dictionary* dictionary) const {
+        dictionary->trained = true;
+
+        switch (codec) {
+            case CODEC::STORED:
+                break;
+
+            case CODEC::ZSTD:
+#ifdef LINK_LIBRARY_ZSTD
+            {
+                dictionary->data.resize(dictionarySize);
+                const size_t ret = ZDICT_trainFromBuffer(dictionary->data.data(), dictionarySize, dictionary->samples.data(),
+                                                         dictionary->sampleSizes.data(), dictionary->sampleSizes.size());
+                // Too few or too similar samples, the table is compressed without dictionary
+                if (ZDICT_isError(ret) != 0)
+                    dictionary->data.clear();
+                else
+                    dictionary->data.resize(ret);
+            }
+#endif /* LINK_LIBRARY_ZSTD */
+                break;
+
+            case CODEC::LZ4:
+                // LZ4 has no trainer, recent messages are used as raw dictionary content
+                dictionary->data = dictionary->samples.substr(dictionary->samples.length() -
+                                                              std::min<uint64_t>(dictionary->samples.length(), dictionarySize));
+                break;
+        }
+
+        dictionary->samples.clear();
+        dictionary->samples.shrink_to_fit();
+        dictionary->sampleSizes.clear();
+        dictionary->sampleSizes.shrink_to_fit();
+
+        if (dictionary->data.empty())
+            return;
+        dictionary->id = dictionaryId(dictionary->data);
+#ifdef LINK_LIBRARY_ZSTD
+        if (codec == CODEC::ZSTD)
+            dictionary->compressDict = ZSTD_createCDict(dictionary->data.data(), dictionary->data.length(), level);
+#endif /* LINK_LIBRARY_ZSTD */
+    }
+
+    void Compressor::releaseDictionary(Dictionary* dictionary) const {
+#ifdef LINK_LIBRARY_ZSTD
+        if (dictionary->compressDict != nullptr)
+            ZSTD_freeCDict(reinterpret_cast<ZSTD_CDict*>(dictionary->compressDict));
+        if (dictionary->decompressDict != nullptr)
+            ZSTD_freeDDict(reinterpret_cast<ZSTD_DDict*>(dictionary->decompressDict));
+#endif /* LINK_LIBRARY_ZSTD */
+        delete dictionary;
+    }
+
+    void Compressor::appendHeader(std::vector<uint8_t>& output, uint64_t pos, uint8_t frameType, uint32_t id, uint64_t originalSize,
+                                  uint64_t payloadSize) {
+        uint8_t* header = output.data() + pos;
+        header[0] = MAGIC0;
+        header[1] = MAGIC1;
+        header[2] = frameType;
+        header[3] = 0;
+        Ctx::write32Little(header + 4, id);
+        Ctx::write32Little(header + 8, static_cast<uint32_t>(originalSize));
+        Ctx::write32Little(header + 12, static_cast<uint32_t>(payloadSize));
+    }
+
+    uint64_t Compressor::compressPayload(const Dictionary* dictionary __attribute__((unused)), const uint8_t* data __attribute__((unused)),
+                                         uint64_t size __attribute__((unused)), uint64_t pos __attribute__((unused))) {
+        switch (codec) {
+            case CODEC::STORED:
+                break;
+
+            case CODEC::ZSTD:
+#ifdef LINK_LIBRARY_ZSTD
+            {
+                const size_t bound = ZSTD_compressBound(size);
+                buffer.resize(pos + bound);
+                size_t ret;
+                if (dictionary != nullptr)
+                    ret = ZSTD_compress_usingCDict(reinterpret_cast<ZSTD_CCtx*>(compressCtx), buffer.data() + pos, bound, data, size,
+                                                   reinterpret_cast<const ZSTD_CDict*>(dictionary->compressDict));
+                else
+                    ret = ZSTD_compressCCtx(reinterpret_cast<ZSTD_CCtx*>(compressCtx), buffer.data() + pos, bound, data, size, level);
+                if (ZSTD_isError(ret) != 0)
+                    throw RuntimeException(10075, "compression: zstd returned: " + std::string(ZSTD_getErrorName(ret)));
+                return ret;
+            }
+#endif /* LINK_LIBRARY_ZSTD */
+                break;
+
+            case CODEC::LZ4:
+#ifdef LINK_LIBRARY_LZ4
+            {
+                const int bound = LZ4_compressBound(static_cast<int>(size));
+                buffer.resize(pos + bound);
+                int ret;
+                if (dictionary != nullptr) {
+                    auto* stream = reinterpret_cast<LZ4_stream_t*>(lz4Stream);
+                    LZ4_loadDict(stream, dictionary->data.data(), static_cast<int>(dictionary->data.length()));
+                    ret = LZ4_compress_fast_continue(stream, reinterpret_cast<const char*>(data), reinterpret_cast<char*>(buffer.data() + pos),
+                                                     static_cast<int>(size), bound, 1);
+                } else
+                    ret = LZ4_compress_default(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(buffer.data() + pos),
+                                               static_cast<int>(size), bound);
+                if (ret <= 0)
+                    throw RuntimeException(10075, "compression: lz4 returned: " + std::to_string(ret));
+                return ret;
+            }
+#endif /* LINK_LIBRARY_LZ4 */
+                break;
+        }
+        return 0;
+    }
+
+    Compressor::Dictionary* Compressor::findDictionary(typeObj obj, const uint8_t* data, uint64_t size) {
+        if (unlikely(size > 0xFFFFFFFF))
+            throw RuntimeException(10075, "compression: message size: " + std::to_string(size) + " exceeds 4GB");
+
+        if (dictionarySize == 0 || codec == CODEC::STORED)
+            return nullptr;
+
+        Dictionary* dictionary;
+        auto tablesIt = tables.find(obj);
+        if (tablesIt != tables.end())
+            dictionary = tablesIt->second;
+        else {
+            dictionary = new Dictionary;
+            tables.insert_or_assign(obj, dictionary);
+        }
+
+        if (!dictionary->trained) {
+            const uint64_t samplesMax = dictionarySize * TRAIN_SIZE_FACTOR;
+            if (dictionary->samples.length() + size <= samplesMax) {
+                dictionary->samples.append(reinterpret_cast<const char*>(data), size);
+                dictionary->sampleSizes.push_back(size);
+            }
+            if (dictionary->sampleSizes.size() >= TRAIN_MESSAGES || dictionary->samples.length() + size > samplesMax)
+                train(dictionary);
+        }
+
+        if (dictionary->id == 0)
+            return nullptr;
+        return dictionary;
+    }
+
+    void Compressor::appendDictionaryFrame(std::vector<uint8_t>& output, Dictionary* dictionary) {
+        const uint64_t pos = output.size();
+        output.resize(pos + HEADER_SIZE + dictionary->data.length());
+        appendHeader(output, pos, FRAME_DICTIONARY | static_cast<uint8_t>(codec), dictionary->id, dictionary->data.length(), dictionary->data.length());
+        memcpy(reinterpret_cast<void*>(output.data() + pos + HEADER_SIZE), reinterpret_cast<const void*>(dictionary->data.data()),
+               dictionary->data.length());
+        dictionary->sent = true;
+    }
+
+    uint64_t Compressor::appendDataFrame(const Dictionary* dictionary, const uint8_t* data, uint64_t size, uint64_t pos) {
+        uint64_t payloadSize = compressPayload(dictionary, data, size, pos + HEADER_SIZE);
+        if (payloadSize > 0 && payloadSize < size) {
+            appendHeader(buffer, pos, static_cast<uint8_t>(codec), dictionary != nullptr ? dictionary->id : 0, size, payloadSize);
+        } else {
+            // Data which doesn't compress is stored
+            payloadSize = size;
+            buffer.resize(pos + HEADER_SIZE + size);
+            appendHeader(buffer, pos, static_cast<uint8_t>(CODEC::STORED), 0, size, size);
+            memcpy(reinterpret_cast<void*>(buffer.data() + pos + HEADER_SIZE), reinterpret_cast<const void*>(data), size);
+        }
+        return pos + HEADER_SIZE + payloadSize;
+    }
+
+    const uint8_t* Compressor::compress(typeObj obj, const uint8_t* data, uint64_t size, uint64_t& outputSize) {
+        Dictionary* dictionary = findDictionary(obj, data, size);
+        buffer.clear();
+        if (dictionary != nullptr && !dictionary->sent)
+            appendDictionaryFrame(buffer, dictionary);
+
+        outputSize = appendDataFrame(dictionary, data, size, buffer.size());
+        return buffer.data();
+    }
+
+    const uint8_t* Compressor::compressData(typeObj obj, const uint8_t* data, uint64_t size, uint64_t& outputSize) {
+        const Dictionary* dictionary = findDictionary(obj, data, size);
+        outputSize = appendDataFrame(dictionary, data, size, 0);
+        return buffer.data();
+    }
+
+    uint64_t Compressor::pendingDictionarySize(typeObj obj) const {
+        auto tablesIt = tables.find(obj);
+        if (tablesIt == tables.end() || tablesIt->second->id == 0 || tablesIt->second->sent)
+            return 0;
+        return HEADER_SIZE + tablesIt->second->data.length();
+    }
+
+    const uint8_t* Compressor::dictionaryFrame(typeObj obj, uint64_t& outputSize) {
+        auto tablesIt = tables.find(obj);
+        if (tablesIt == tables.end() || tablesIt->second->id == 0 || tablesIt->second->sent)
+            return nullptr;
+
+        dictionaryBuffer.clear();
+        appendDictionaryFrame(dictionaryBuffer, tablesIt->second);
+        outputSize = dictionaryBuffer.size();
+        return dictionaryBuffer.data();
+    }
+
+    void Compressor::resetSent() {
+        for (auto& [_, dictionary]: tables)
+            dictionary->sent = false;
+    }
+
+    uint64_t Compressor::decompress(const uint8_t* data, uint64_t size, std::string& output) {
+        if (unlikely(size < HEADER_SIZE || data[0] != MAGIC0 || data[1] != MAGIC1))
+            throw RuntimeException(10076, "compression: invalid frame header, size: " + std::to_string(size));
+
+        const uint8_t frameType = data[2];
+        const uint32_t id = Ctx::read32Little(data + 4);
+        const uint32_t originalSize __attribute__((unused)) = Ctx::read32Little(data + 8);
+        const uint32_t payloadSize = Ctx::read32Little(data + 12);
+        if (unlikely(HEADER_SIZE + payloadSize > size))
+            throw RuntimeException(10076, "compression: frame payload size: " + std::to_string(payloadSize) + " exceeds data size: " +
+                                          std::to_string(size - HEADER_SIZE));
+        const uint8_t* payload = data + HEADER_SIZE;
+        const auto frameCodec = static_cast<CODEC>(frameType & ~FRAME_DICTIONARY);
+        if (unlikely(!isCompiled(frameCodec)))
+            throw RuntimeException(10076, "compression: frame codec: " + std::to_string(static_cast<uint64_t>(frameCodec)) + " is not supported");
+
+        if ((frameType & FRAME_DICTIONARY) != 0) {
+            auto receivedIt = received.find(id);
+            if (receivedIt != received.end()) {
+                releaseDictionary(receivedIt->second);
+                received.erase(receivedIt);
+            }
+            auto* dictionary = new Dictionary;
+            dictionary->id = id;
+            dictionary->trained = true;
+            dictionary->data.assign(reinterpret_cast<const char*>(payload), payloadSize);
+#ifdef LINK_LIBRARY_ZSTD
+            if (frameCodec == CODEC::ZSTD)
+                dictionary->decompressDict = ZSTD_createDDict(dictionary->data.data(), dictionary->data.length());
+#endif /* LINK_LIBRARY_ZSTD */
+            received.insert_or_assign(id, dictionary);
+            return HEADER_SIZE + payloadSize;
+        }
+
+        const Dictionary* dictionary __attribute__((unused)) = nullptr;
+        if (id != 0) {
+            auto receivedIt = received.find(id);
+            if (unlikely(receivedIt == received.end()))
+                throw RuntimeException(10076, "compression: unknown dictionary id: " + std::to_string(id));
+            dictionary = receivedIt->second;
+        }
+
+        switch (frameCodec) {
+            case CODEC::STORED:
+                output.assign(reinterpret_cast<const char*>(payload), payloadSize);
+                break;
+
+            case CODEC::ZSTD:
+#ifdef LINK_LIBRARY_ZSTD
+            {
+                output.resize(originalSize);
+                size_t ret;
+                if (dictionary != nullptr)
+                    ret = ZSTD_decompress_usingDDict(reinterpret_cast<ZSTD_DCtx*>(decompressCtx), output.data(), originalSize, payload, payloadSize,
+                                                     reinterpret_cast<const ZSTD_DDict*>(dictionary->decompressDict));
+                else
+                    ret = ZSTD_decompressDCtx(reinterpret_cast<ZSTD_DCtx*>(decompressCtx), output.data(), originalSize, payload, payloadSize);
+                if (unlikely(ZSTD_isError(ret) != 0 || ret != originalSize))
+                    throw RuntimeException(10076, "compression: zstd frame can't be decompressed, size: " + std::to_string(originalSize));
+            }
+#endif /* LINK_LIBRARY_ZSTD */
+                break;
+
+            case CODEC::LZ4:
+#ifdef LINK_LIBRARY_LZ4
+            {
+                output.resize(originalSize);
+                int ret;
+                if (dictionary != nullptr)
+                    ret = LZ4_decompress_safe_usingDict(reinterpret_cast<const char*>(payload), output.data(), static_cast<int>(payloadSize),
+                                                        static_cast<int>(originalSize), dictionary->data.data(),
+                                                        static_cast<int>(dictionary->data.length()));
+                else
+                    ret = LZ4_decompress_safe(reinterpret_cast<const char*>(payload), output.data(), static_cast<int>(payloadSize),
+                                              static_cast<int>(originalSize));
+                if (unlikely(ret < 0 || static_cast<uint32_t>(ret) != originalSize))
+                    throw RuntimeException(10076, "compression: lz4 frame can't be decompressed, size: " + std::to_string(originalSize));
+            }
+#endif /* LINK_LIBRARY_LZ4 */
+                break;
+        }
+
+        return HEADER_SIZE + payloadSize;
+    }
+}
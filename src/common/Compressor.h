@@ -0,0 +1,108 @@
+/* Header for Compressor class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef COMPRESSOR_H_
+#define COMPRESSOR_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types/Types.h"
+
+namespace OpenLogReplicator {
+    // Messages are sent as frames: 16 byte header followed by the payload.
+    // Header: magic "OZ", frame type, reserved byte, dictionary id, original size and payload size (32-bit, little endian).
+    // A dictionary frame is sent before the first data frame which uses the dictionary on every output file or connection.
+    class Compressor final {
+    public:
+        static constexpr uint64_t HEADER_SIZE{16};
+        static constexpr uint8_t MAGIC0{'O'};
+        static constexpr uint8_t MAGIC1{'Z'};
+
+        enum class CODEC : unsigned char {
+            STORED = 0, ZSTD = 1, LZ4 = 2
+        };
+
+        // Frame type, codec of the data frame or DICTIONARY
+        static constexpr uint8_t FRAME_DICTIONARY{0x80};
+
+    protected:
+        // Number of messages of a table used to train the dictionary
+        static constexpr uint64_t TRAIN_MESSAGES{128};
+        // Bytes of samples used to train the dictionary, multiple of the dictionary size
+        static constexpr uint64_t TRAIN_SIZE_FACTOR{32};
+        static constexpr uint64_t LZ4_DICTIONARY_MAX{65536};
+
+        struct Dictionary {
+            uint32_t id{0};
+            std::string data;
+            // Samples are collected until the dictionary is trained
+            std::string samples;
+            std::vector<size_t> sampleSizes;
+            bool trained{false};
+            bool sent{false};
+            void* compressDict{nullptr};
+            void* decompressDict{nullptr};
+        };
+
+        CODEC codec;
+        int level;
+        uint64_t dictionarySize;
+        void* compressCtx{nullptr};
+        void* decompressCtx{nullptr};
+        void* lz4Stream{nullptr};
+        std::unordered_map<typeObj, Dictionary*> tables;
+        // Dictionaries received from the sender, by id
+        std::unordered_map<uint32_t, Dictionary*> received;
+        std::vector<uint8_t> buffer;
+        std::vector<uint8_t> dictionaryBuffer;
+
+        static uint32_t dictionaryId(const std::string& data);
+        void train(Dictionary* dictionary) const;
+        [[nodiscard]] Dictionary* findDictionary(typeObj obj, const uint8_t* data, uint64_t size);
+        static void appendHeader(std::vector<uint8_t>& output, uint64_t pos, uint8_t frameType, uint32_t id, uint64_t originalSize,
+                                 uint64_t payloadSize);
+        void appendDictionaryFrame(std::vector<uint8_t>& output, Dictionary* dictionary);
+        [[nodiscard]] uint64_t appendDataFrame(const Dictionary* dictionary, const uint8_t* data, uint64_t size, uint64_t pos);
+        [[nodiscard]] uint64_t compressPayload(const Dictionary* dictionary, const uint8_t* data, uint64_t size, uint64_t pos);
+        void releaseDictionary(Dictionary* dictionary) const;
+
+    public:
+        Compressor(CODEC newCodec, int newLevel, uint64_t newDictionarySize);
+        ~Compressor();
+
+        [[nodiscard]] static bool isCompiled(CODEC codec);
+        [[nodiscard]] static const char* codecName(CODEC codec);
+        // Returns frames (dictionary if not sent yet and data) in the internal buffer, valid until the next call
+        const uint8_t* compress(typeObj obj, const uint8_t* data, uint64_t size, uint64_t& outputSize);
+        // Returns only the data frame, the dictionary it uses is taken separately with dictionaryFrame()
+        const uint8_t* compressData(typeObj obj, const uint8_t* data, uint64_t size, uint64_t& outputSize);
+        // Size of the dictionary frame of the table which is not sent yet, 0 when there is none
+        [[nodiscard]] uint64_t pendingDictionarySize(typeObj obj) const;
+        // Returns the dictionary frame of the table when not sent yet, nullptr otherwise
+        const uint8_t* dictionaryFrame(typeObj obj, uint64_t& outputSize);
+        // New output file or connection, dictionaries are sent again
+        void resetSent();
+        // Receiver side, data frames are decompressed to output, dictionary frames are kept, returns size of the consumed frame
+        uint64_t decompress(const uint8_t* data, uint64_t size, std::string& output);
+    };
+}
+
+#endif
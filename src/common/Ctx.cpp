@@ -20,13 +20,20 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define GLOBALS 1
 
 #include <algorithm>
+#include <cctype>
 #include <cstdlib>
+#include <cstring>
 #include <csignal>
 #include <execinfo.h>
 #include <iostream>
 #include <set>
 #include <string>
 #include <unistd.h>
+#if __linux__
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
 
 #include "ClockHW.h"
 #include "Ctx.h"
@@ -40,7 +47,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 OpenLogReplicator::Ctx::LOCALES OLR_LOCALES = OpenLogReplicator::Ctx::LOCALES::TIMESTAMP;
 
 namespace OpenLogReplicator {
-    const std::string Ctx::memoryModules[MEMORY_COUNT]{"builder", "parser", "reader", "transaction", "writer"};
+    const std::string Ctx::memoryModules[MEMORY_COUNT]{"builder", "lobs", "misc", "parser", "reader", "transaction", "writer"};
+    thread_local Ctx::MemoryCache* Ctx::memoryCache{nullptr};
 
     IntX IntX::BASE10[IntX::DIGITS][10];
 
@@ -56,6 +64,23 @@ namespace OpenLogReplicator {
     Ctx::~Ctx() {
         lobIdToXidMap.clear();
 
+        for (MemoryCache* cache: memoryCaches) {
+            while (cache->size > 0)
+                memoryChunks[memoryChunksFree++] = cache->chunks[--cache->size];
+            delete cache;
+        }
+        memoryCaches.clear();
+        memoryCache = nullptr;
+
+        if (memoryArenaMap != nullptr) {
+#if __linux__
+            munmap(memoryArenaMap, memoryArenaMapSize);
+#endif
+            memoryArenaMap = nullptr;
+            memoryArena = nullptr;
+            memoryChunksAllocated = 0;
+        }
+
         while (memoryChunksAllocated > 0) {
             --memoryChunksAllocated;
             free(memoryChunks[memoryChunksAllocated]);
@@ -330,12 +355,16 @@ namespace OpenLogReplicator {
             memoryChunksUnswapBufferMin = memoryUnswapBufferMinMb / MEMORY_CHUNK_SIZE_MB;
             memoryChunksWriteBufferMax = memoryWriteBufferMaxMb / MEMORY_CHUNK_SIZE_MB;
             memoryChunksWriteBufferMin = memoryWriteBufferMinMb / MEMORY_CHUNK_SIZE_MB;
+            memoryChunksReadBufferQuota = memoryChunksReadBufferMax;
+            memoryChunksWriteBufferQuota = memoryChunksWriteBufferMax;
+            memoryChunksSwapQuota = memoryChunksSwap;
             bufferSizeMax = memoryReadBufferMaxMb * 1024 * 1024;
             bufferSizeFree = memoryReadBufferMaxMb / MEMORY_CHUNK_SIZE_MB;
 
             memoryChunks = new uint8_t* [memoryChunksMax];
+            initializeArena();
             for (uint64_t i = 0; i < memoryChunksMin; ++i) {
-                memoryChunks[i] = reinterpret_cast<uint8_t*>(aligned_alloc(MEMORY_ALIGNMENT, MEMORY_CHUNK_SIZE));
+                memoryChunks[i] = allocateChunk();
                 if (unlikely(memoryChunks[i] == nullptr))
                     throw RuntimeException(10016, "couldn't allocate " + std::to_string(MEMORY_CHUNK_SIZE_MB) +
                                                   " bytes memory for: memory chunks#2");
@@ -361,7 +390,7 @@ namespace OpenLogReplicator {
         {
             t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_NOTHING_TO_SWAP);
             std::unique_lock<std::mutex> const lck(memoryMtx);
-            ret = memoryChunksSwap == 0 || (memoryChunksAllocated - memoryChunksFree < memoryChunksSwap);
+            ret = memoryChunksSwap == 0 || (memoryChunksUsed < memoryChunksSwapQuota);
         }
         t->contextSet(Thread::CONTEXT::CPU);
         return ret;
@@ -377,7 +406,7 @@ namespace OpenLogReplicator {
         {
             t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_FREE_MEMORY);
             std::unique_lock<std::mutex> const lck(memoryMtx);
-            ret = memoryChunksFree * MEMORY_CHUNK_SIZE_MB;
+            ret = (memoryChunksFree + memoryChunksCached) * MEMORY_CHUNK_SIZE_MB;
         }
         t->contextSet(Thread::CONTEXT::CPU);
         return ret;
@@ -399,14 +428,195 @@ namespace OpenLogReplicator {
         return ret;
     }
 
-    uint8_t* Ctx::getMemoryChunk(Thread* t, MEMORY module, bool swap) {
+    uint64_t Ctx::getMemoryReserved(bool swap) const {
+        uint64_t reservedChunks = 0;
+        if (memoryModulesAllocated[static_cast<uint>(MEMORY::READER)] < memoryChunksReadBufferMin)
+            reservedChunks += memoryChunksReadBufferMin - memoryModulesAllocated[static_cast<uint>(MEMORY::READER)];
+        if (memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] < memoryChunksWriteBufferMin)
+            reservedChunks += memoryChunksWriteBufferMin - memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)];
+        if (!swap)
+            reservedChunks += memoryChunksUnswapBufferMin;
+        return reservedChunks;
+    }
+
+    uint64_t Ctx::drainMemoryCaches() {
+        // Called with memoryMtx locked
+        uint64_t drained = 0;
+        for (MemoryCache* cache: memoryCaches) {
+            std::unique_lock<std::mutex> const lckCache(cache->mtx);
+            while (cache->size > 0) {
+                memoryChunks[memoryChunksFree++] = cache->chunks[--cache->size];
+                --memoryChunksCached;
+                ++drained;
+            }
+        }
+        return drained;
+    }
+
+    void Ctx::updateMemoryModuleHWM(MEMORY module, uint64_t allocatedModule) {
+        uint64_t hwm = memoryModulesHWM[static_cast<uint>(module)].load(std::memory_order_relaxed);
+        while (allocatedModule > hwm && !memoryModulesHWM[static_cast<uint>(module)].compare_exchange_weak(hwm, allocatedModule, std::memory_order_relaxed))
+            ;
+    }
+
+    void Ctx::initializeArena() {
+        // Called with memoryMtx locked
+#if __linux__
+        if (memoryHugePages == MEMORY_HUGE_PAGES::NONE && !memoryNumaLocal)
+            return;
+
+        if (memoryNumaLocal) {
+            std::ifstream nodesFile("/sys/devices/system/node/online");
+            std::string nodes;
+            if (nodesFile.is_open() && std::getline(nodesFile, nodes)) {
+                const size_t pos = nodes.find_last_of(",-");
+                const std::string lastNode = (pos == std::string::npos) ? nodes : nodes.substr(pos + 1);
+                if (!lastNode.empty() && std::isdigit(static_cast<unsigned char>(lastNode[0])) != 0)
+                    memoryNumaNodes = std::min<uint>(std::stoul(lastNode) + 1, MEMORY_NUMA_NODES_MAX);
+            }
+        }
+
+        uint64_t pageSize = MEMORY_HUGE_PAGE_SIZE;
+        int mapFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+        if (memoryHugePages == MEMORY_HUGE_PAGES::HUGETLB_1GB) {
+            pageSize = 1024 * 1024 * 1024;
+            mapFlags |= MAP_HUGETLB | (30 << MAP_HUGE_SHIFT);
+        } else if (memoryHugePages == MEMORY_HUGE_PAGES::HUGETLB_2MB)
+            mapFlags |= MAP_HUGETLB | (21 << MAP_HUGE_SHIFT);
+        else
+            mapFlags |= MAP_NORESERVE;
+
+        // Every node gets an equal, page aligned part of the arena, chunks of one huge page stay on one node
+        memoryArenaNodeSize = (memoryChunksMax + memoryNumaNodes - 1) / memoryNumaNodes * MEMORY_CHUNK_SIZE;
+        memoryArenaNodeSize = (memoryArenaNodeSize + pageSize - 1) / pageSize * pageSize;
+        const uint64_t arenaSize = memoryArenaNodeSize * memoryNumaNodes;
+
+        if ((mapFlags & MAP_HUGETLB) != 0) {
+            void* map = mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, mapFlags, -1, 0);
+            if (map == MAP_FAILED) {
+                warning(10073, "huge pages: mmap of " + std::to_string(arenaSize / 1024 / 1024) + "MB returned: " + strerror(errno) +
+                               ", falling back to transparent huge pages");
+                memoryHugePages = MEMORY_HUGE_PAGES::TRANSPARENT;
+                pageSize = MEMORY_HUGE_PAGE_SIZE;
+                memoryArenaNodeSize = (memoryArenaNodeSize + pageSize - 1) / pageSize * pageSize;
+            } else {
+                memoryArenaMap = reinterpret_cast<uint8_t*>(map);
+                memoryArenaMapSize = arenaSize;
+                memoryArena = memoryArenaMap;
+            }
+        }
+
+        if (memoryArenaMap == nullptr) {
+            // Over-allocate by one huge page to align the arena
+            memoryArenaMapSize = memoryArenaNodeSize * memoryNumaNodes + MEMORY_HUGE_PAGE_SIZE;
+            void* map = mmap(nullptr, memoryArenaMapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (map == MAP_FAILED) {
+                warning(10073, "huge pages: mmap of " + std::to_string(memoryArenaMapSize / 1024 / 1024) + "MB returned: " + strerror(errno) +
+                               ", falling back to heap allocation");
+                memoryArenaMapSize = 0;
+                memoryNumaNodes = 1;
+                return;
+            }
+            memoryArenaMap = reinterpret_cast<uint8_t*>(map);
+            memoryArena = reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(memoryArenaMap) + MEMORY_HUGE_PAGE_SIZE - 1) &
+                                                     ~(MEMORY_HUGE_PAGE_SIZE - 1));
+
+            if (memoryHugePages == MEMORY_HUGE_PAGES::TRANSPARENT &&
+                    madvise(memoryArena, memoryArenaNodeSize * memoryNumaNodes, MADV_HUGEPAGE) != 0)
+                warning(10073, "huge pages: madvise returned: " + std::string(strerror(errno)) + ", using regular pages");
+        }
+
+        for (uint node = 0; node < memoryNumaNodes; ++node) {
+            uint8_t* nodeArena = memoryArena + node * memoryArenaNodeSize;
+
+            if (memoryNumaNodes > 1) {
+                unsigned long nodeMask = 1UL << node;
+                if (syscall(SYS_mbind, nodeArena, memoryArenaNodeSize, MPOL_PREFERRED, &nodeMask, sizeof(nodeMask) * 8, 0) != 0)
+                    warning(10074, "numa: mbind for node " + std::to_string(node) + " returned: " + strerror(errno));
+            }
+
+            // Reverse order, so that chunks are taken from the beginning of the node arena
+            const uint64_t nodeChunks = memoryArenaNodeSize / MEMORY_CHUNK_SIZE;
+            memoryArenaFree[node].reserve(nodeChunks);
+            for (uint64_t i = nodeChunks; i > 0; --i)
+                memoryArenaFree[node].push_back(nodeArena + (i - 1) * MEMORY_CHUNK_SIZE);
+        }
+#endif
+    }
+
+    uint8_t* Ctx::allocateChunk() {
+        // Called with memoryMtx locked
+        if (memoryArena == nullptr)
+            return reinterpret_cast<uint8_t*>(aligned_alloc(MEMORY_ALIGNMENT, MEMORY_CHUNK_SIZE));
+
+        const uint localNode = getNumaNode();
+        for (uint i = 0; i < memoryNumaNodes; ++i) {
+            const uint node = (localNode + i) % memoryNumaNodes;
+            if (memoryArenaFree[node].empty())
+                continue;
+
+            uint8_t* chunk = memoryArenaFree[node].back();
+            memoryArenaFree[node].pop_back();
+            return chunk;
+        }
+        return nullptr;
+    }
+
+    void Ctx::releaseChunk(uint8_t* chunk) {
+        if (memoryArena == nullptr) {
+            free(chunk);
+            return;
+        }
+
+#if __linux__
+        // Pages of explicit huge pages can't be partially released, they stay reserved in the arena
+        if (memoryHugePages == MEMORY_HUGE_PAGES::NONE || memoryHugePages == MEMORY_HUGE_PAGES::TRANSPARENT)
+            madvise(chunk, MEMORY_CHUNK_SIZE, MADV_DONTNEED);
+#endif
+
+        std::unique_lock<std::mutex> const lck(memoryMtx);
+        memoryArenaFree[getChunkNode(chunk)].push_back(chunk);
+    }
+
+    uint Ctx::getNumaNode() const {
+        if (memoryNumaNodes <= 1)
+            return 0;
+
+#if __linux__
+        unsigned int cpu = 0;
+        unsigned int node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+            return node % memoryNumaNodes;
+#endif
+        return 0;
+    }
+
+    uint Ctx::getChunkNode(const uint8_t* chunk) const {
+        if (memoryArena == nullptr || memoryNumaNodes <= 1)
+            return 0;
+        return static_cast<uint>((chunk - memoryArena) / memoryArenaNodeSize);
+    }
+
+    uint8_t* Ctx::getMemoryChunk(Thread* t, MEMORY module, bool swap, bool wait) {
         uint64_t allocatedModule = 0;
         uint64_t usedTotal = 0;
         uint64_t allocatedTotal = 0;
         uint8_t* chunk = nullptr;
 
         t->contextSet(Thread::CONTEXT::MEM, Thread::REASON::MEM);
-        {
+
+        // Fast path: chunk cached by this thread, reservations were already honored when the cache was filled
+        MemoryCache* cache = memoryCache;
+        if (cache != nullptr && (module != MEMORY::PARSER || !outOfMemoryParser) &&
+                (module != MEMORY::BUILDER || memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] < memoryChunksWriteBufferQuota)) {
+            std::unique_lock<std::mutex> const lckCache(cache->mtx);
+            if (cache->size > 0) {
+                chunk = cache->chunks[--cache->size];
+                --memoryChunksCached;
+            }
+        }
+
+        if (chunk == nullptr) {
             std::unique_lock<std::mutex> lck(memoryMtx);
             while (true) {
                 if (module == MEMORY::READER) {
@@ -417,21 +627,15 @@ namespace OpenLogReplicator {
                         break;
                 }
 
-                uint64_t reservedChunks = 0;
-                if (memoryModulesAllocated[static_cast<uint>(MEMORY::READER)] < memoryChunksReadBufferMin)
-                    reservedChunks += memoryChunksReadBufferMin - memoryModulesAllocated[static_cast<uint>(MEMORY::READER)];
-                if (memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] < memoryChunksWriteBufferMin)
-                    reservedChunks += memoryChunksWriteBufferMin - memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)];
-                if (!swap)
-                    reservedChunks += memoryChunksUnswapBufferMin;
+                const uint64_t reservedChunks = getMemoryReserved(swap);
 
-                if (module != MEMORY::BUILDER || memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] < memoryChunksWriteBufferMax) {
+                if (module != MEMORY::BUILDER || memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] < memoryChunksWriteBufferQuota) {
                     if (memoryChunksFree > reservedChunks)
                         break;
 
                     if (memoryChunksAllocated < memoryChunksMax) {
                         t->contextSet(Thread::CONTEXT::OS, Thread::REASON::OS);
-                        memoryChunks[memoryChunksFree] = reinterpret_cast<uint8_t*>(aligned_alloc(MEMORY_ALIGNMENT, MEMORY_CHUNK_SIZE));
+                        memoryChunks[memoryChunksFree] = allocateChunk();
                         t->contextSet(Thread::CONTEXT::MEM, Thread::REASON::MEM);
                         if (unlikely(memoryChunks[memoryChunksFree] == nullptr))
                             throw RuntimeException(10016, "couldn't allocate " + std::to_string(MEMORY_CHUNK_SIZE_MB) +
@@ -444,16 +648,35 @@ namespace OpenLogReplicator {
                     }
                 }
 
+                // Chunks kept idle by other threads are returned before going to sleep. The waiter is counted first, so a chunk freed
+                // in the meantime is either drained here or returned through the locked path with a notification
+                ++memoryWaiting;
+                if (drainMemoryCaches() > 0) {
+                    --memoryWaiting;
+                    continue;
+                }
+
+                // Optional allocations give up instead of waiting for memory
+                if (!wait) {
+                    --memoryWaiting;
+                    t->contextSet(Thread::CONTEXT::CPU);
+                    return nullptr;
+                }
+
                 if (module == MEMORY::PARSER)
                     outOfMemoryParser = true;
 
-                if (hardShutdown)
+                if (hardShutdown) {
+                    --memoryWaiting;
                     return nullptr;
+                }
 
                 if (unlikely(isTraceSet(TRACE::SLEEP)))
                     logTrace(TRACE::SLEEP, "Ctx:getMemoryChunk");
                 t->contextSet(Thread::CONTEXT::WAIT, Thread::REASON::MEMORY_EXHAUSTED);
+                ++memoryModulesWaits[static_cast<uint>(module)];
                 condOutOfMemory.wait(lck);
+                --memoryWaiting;
                 t->contextSet(Thread::CONTEXT::MEM, Thread::REASON::MEM);
             }
 
@@ -461,13 +684,40 @@ namespace OpenLogReplicator {
                 outOfMemoryParser = false;
 
             --memoryChunksFree;
-            usedTotal = memoryChunksAllocated - memoryChunksFree;
-            allocatedModule = ++memoryModulesAllocated[static_cast<uint>(module)];
-            memoryModulesHWM[static_cast<uint>(module)] = std::max(memoryModulesAllocated[static_cast<uint>(module)], memoryModulesHWM[static_cast<uint>(module)]);
+
+            // Prefer a chunk placed on the NUMA node of the calling thread
+            if (memoryNumaNodes > 1) {
+                const uint node = getNumaNode();
+                for (uint64_t i = 0; i < MEMORY_NUMA_SCAN && i <= memoryChunksFree; ++i) {
+                    if (getChunkNode(memoryChunks[memoryChunksFree - i]) == node) {
+                        std::swap(memoryChunks[memoryChunksFree - i], memoryChunks[memoryChunksFree]);
+                        break;
+                    }
+                }
+            }
             chunk = memoryChunks[memoryChunksFree];
+
+            // Refill the cache of this thread while there is enough memory above the reserved level
+            if (memoryWaiting == 0 && memoryChunksFree > getMemoryReserved(false) + MEMORY_CACHE_BATCH) {
+                if (cache == nullptr) {
+                    cache = new MemoryCache();
+                    memoryCaches.push_back(cache);
+                    memoryCache = cache;
+                }
+
+                std::unique_lock<std::mutex> const lckCache(cache->mtx);
+                for (uint64_t i = 0; i < MEMORY_CACHE_BATCH && cache->size < MEMORY_CACHE_SIZE; ++i) {
+                    cache->chunks[cache->size++] = memoryChunks[--memoryChunksFree];
+                    ++memoryChunksCached;
+                }
+            }
         }
         t->contextSet(Thread::CONTEXT::CPU);
 
+        usedTotal = ++memoryChunksUsed;
+        allocatedModule = ++memoryModulesAllocated[static_cast<uint>(module)];
+        updateMemoryModuleHWM(module, allocatedModule);
+
         if (unlikely(hardShutdown))
             throw RuntimeException(10018, "shutdown during memory allocation");
 
@@ -482,6 +732,10 @@ namespace OpenLogReplicator {
                     metrics->emitMemoryUsedMbBuilder(allocatedModule * MEMORY_CHUNK_SIZE_MB);
                     break;
 
+                case MEMORY::LOBS:
+                    metrics->emitMemoryUsedMbLobs(allocatedModule * MEMORY_CHUNK_SIZE_MB);
+                    break;
+
                 case MEMORY::MISC:
                     metrics->emitMemoryUsedMbMisc(allocatedModule * MEMORY_CHUNK_SIZE_MB);
                     break;
@@ -511,11 +765,33 @@ namespace OpenLogReplicator {
         uint64_t usedTotal = 0;
         uint64_t allocatedTotal = 0;
         t->contextSet(Thread::CONTEXT::MEM, Thread::REASON::MEM);
-        {
+
+        if (unlikely(memoryModulesAllocated[static_cast<uint>(module)] == 0))
+            throw RuntimeException(50001, "trying to free unknown memory block for: " + memoryModules[static_cast<uint>(module)]);
+
+        // Fast path: keep the chunk in the cache of this thread unless some thread is waiting for memory,
+        // checked under the cache lock which a waiter takes to drain the cache after it is counted
+        MemoryCache* cache = memoryCache;
+        if (cache != nullptr) {
+            std::unique_lock<std::mutex> const lckCache(cache->mtx);
+            if (memoryWaiting == 0 && cache->size < MEMORY_CACHE_SIZE) {
+                cache->chunks[cache->size++] = chunk;
+                ++memoryChunksCached;
+                chunk = nullptr;
+            }
+        }
+
+        if (chunk != nullptr) {
             std::unique_lock<std::mutex> const lck(memoryMtx);
 
-            if (unlikely(memoryChunksFree == memoryChunksAllocated))
-                throw RuntimeException(50001, "trying to free unknown memory block for: " + memoryModules[static_cast<uint>(module)]);
+            // Return half of a full cache in one batch
+            if (cache != nullptr) {
+                std::unique_lock<std::mutex> const lckCache(cache->mtx);
+                for (uint64_t i = 0; i < MEMORY_CACHE_BATCH && cache->size > 0; ++i) {
+                    memoryChunks[memoryChunksFree++] = cache->chunks[--cache->size];
+                    --memoryChunksCached;
+                }
+            }
 
             // Keep memoryChunksMin reserved
             if (memoryChunksFree >= memoryChunksMin)
@@ -525,15 +801,15 @@ namespace OpenLogReplicator {
                 chunk = nullptr;
             }
 
-            usedTotal = memoryChunksAllocated - memoryChunksFree;
-            allocatedModule = --memoryModulesAllocated[static_cast<uint>(module)];
-
             condOutOfMemory.notify_all();
         }
 
+        usedTotal = --memoryChunksUsed;
+        allocatedModule = --memoryModulesAllocated[static_cast<uint>(module)];
+
         if (chunk != nullptr) {
             t->contextSet(Thread::CONTEXT::OS, Thread::REASON::OS);
-            free(chunk);
+            releaseChunk(chunk);
         }
 
         t->contextSet(Thread::CONTEXT::CPU);
@@ -548,6 +824,10 @@ namespace OpenLogReplicator {
                     metrics->emitMemoryUsedMbBuilder(allocatedModule * MEMORY_CHUNK_SIZE_MB);
                     break;
 
+                case MEMORY::LOBS:
+                    metrics->emitMemoryUsedMbLobs(allocatedModule * MEMORY_CHUNK_SIZE_MB);
+                    break;
+
                 case MEMORY::MISC:
                     metrics->emitMemoryUsedMbMisc(allocatedModule * MEMORY_CHUNK_SIZE_MB);
                     break;
@@ -587,6 +867,8 @@ namespace OpenLogReplicator {
                 t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_MEMORY_INIT);
             }
 
+            sc->created = swapClock;
+            sc->touched = swapClock;
             swapChunks.insert_or_assign(xid, sc);
         }
         t->contextSet(Thread::CONTEXT::CPU);
@@ -644,6 +926,8 @@ namespace OpenLogReplicator {
             SwapChunk* sc = it->second;
             tc = sc->chunks.at(index);
             sc->chunks[index] = nullptr;
+            if (index >= sc->released)
+                sc->released = index + 1;
         }
         t->contextSet(Thread::CONTEXT::CPU);
 
@@ -669,6 +953,7 @@ namespace OpenLogReplicator {
             t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_SWAPPED_GROW2);
             std::unique_lock<std::mutex> const lck(swapMtx);
             sc->chunks.push_back(tc);
+            sc->touched = ++swapClock;
         }
         t->contextSet(Thread::CONTEXT::CPU);
         return tc;
@@ -718,7 +1003,16 @@ namespace OpenLogReplicator {
         {
             t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_SWAPPED_FLUSH1);
             std::unique_lock<std::mutex> const lck(swapMtx);
-            swappedFlushXid = xid;
+            swappedFlushXids.insert(xid);
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void Ctx::swappedMemoryFlushEnd(Thread* t, Xid xid) {
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_SWAPPED_FLUSH1);
+            std::unique_lock<std::mutex> const lck(swapMtx);
+            swappedFlushXids.erase(xid);
         }
         t->contextSet(Thread::CONTEXT::CPU);
     }
@@ -733,7 +1027,7 @@ namespace OpenLogReplicator {
                 throw RuntimeException(50070, "swap chunk not found for xid: " + xid.toString() + " during memory remove");
             sc = it->second;
             sc->release = true;
-            swappedFlushXid = 0;
+            swappedFlushXids.erase(xid);
         }
         t->contextSet(Thread::CONTEXT::CPU);
 
@@ -1120,7 +1414,8 @@ namespace OpenLogReplicator {
 
     void Ctx::printMemoryUsageHWM() const {
         info(0, "Memory HWM: " + std::to_string(getMemoryHWM()) + "MB, builder HWM: " +
-                std::to_string(memoryModulesHWM[static_cast<uint>(Ctx::MEMORY::BUILDER)] * MEMORY_CHUNK_SIZE_MB) + "MB, misc HWM: " +
+                std::to_string(memoryModulesHWM[static_cast<uint>(Ctx::MEMORY::BUILDER)] * MEMORY_CHUNK_SIZE_MB) + "MB, orphaned lobs HWM: " +
+                std::to_string(memoryModulesHWM[static_cast<uint>(Ctx::MEMORY::LOBS)] * MEMORY_CHUNK_SIZE_MB) + "MB, misc HWM: " +
                 std::to_string(memoryModulesHWM[static_cast<uint>(Ctx::MEMORY::MISC)] * MEMORY_CHUNK_SIZE_MB) + "MB, parser HWM: " +
                 std::to_string(memoryModulesHWM[static_cast<uint>(Ctx::MEMORY::PARSER)] * MEMORY_CHUNK_SIZE_MB) + "MB, disk read buffer HWM: " +
                 std::to_string(memoryModulesHWM[static_cast<uint>(Ctx::MEMORY::READER)] * MEMORY_CHUNK_SIZE_MB) + "MB, transaction HWM: " +
@@ -1132,8 +1427,10 @@ namespace OpenLogReplicator {
     void Ctx::printMemoryUsageCurrent() const {
         info(0, "Memory current swap: " + std::to_string(memoryChunksSwap * MEMORY_CHUNK_SIZE_MB) + "MB, allocated: " +
                 std::to_string(memoryChunksAllocated * MEMORY_CHUNK_SIZE_MB) + "MB, free: " +
-                std::to_string(memoryChunksFree * MEMORY_CHUNK_SIZE_MB) + "MB, memory builder: " +
-                std::to_string(memoryModulesAllocated[static_cast<uint>(Ctx::MEMORY::BUILDER)] * MEMORY_CHUNK_SIZE_MB) + "MB, misc: " +
+                std::to_string(memoryChunksFree * MEMORY_CHUNK_SIZE_MB) + "MB, cached: " +
+                std::to_string(memoryChunksCached * MEMORY_CHUNK_SIZE_MB) + "MB, memory builder: " +
+                std::to_string(memoryModulesAllocated[static_cast<uint>(Ctx::MEMORY::BUILDER)] * MEMORY_CHUNK_SIZE_MB) + "MB, orphaned lobs: " +
+                std::to_string(memoryModulesAllocated[static_cast<uint>(Ctx::MEMORY::LOBS)] * MEMORY_CHUNK_SIZE_MB) + "MB, misc: " +
                 std::to_string(memoryModulesAllocated[static_cast<uint>(Ctx::MEMORY::MISC)] * MEMORY_CHUNK_SIZE_MB) + "MB, parser: " +
                 std::to_string(memoryModulesAllocated[static_cast<uint>(Ctx::MEMORY::PARSER)] * MEMORY_CHUNK_SIZE_MB) + "MB, disk read buffer: " +
                 std::to_string(memoryModulesAllocated[static_cast<uint>(Ctx::MEMORY::READER)] * MEMORY_CHUNK_SIZE_MB) + "MB, transaction: " +
@@ -17,6 +17,7 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
@@ -28,6 +29,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <set>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "types/LobId.h"
@@ -47,7 +49,17 @@ namespace OpenLogReplicator {
         std::vector<uint8_t*> chunks;
         int64_t swappedMin{-1};
         int64_t swappedMax{-1};
+        int64_t unswapNext{-1};
+        uint64_t unswapInFlight{0};
+        uint64_t created{0};
+        uint64_t touched{0};
+        int64_t released{0};
         bool release{false};
+
+        // Chunks below released were already sent as provisional data and freed
+        [[nodiscard]] int64_t swapNext() const {
+            return std::max(swappedMax + 1, released);
+        }
     };
 
     class Ctx final {
@@ -59,9 +71,12 @@ namespace OpenLogReplicator {
             SILENT, ERROR, WARNING, INFO, DEBUG
         };
         enum class MEMORY : unsigned char {
-            BUILDER, MISC, PARSER, READER, TRANSACTIONS, WRITER
+            BUILDER, LOBS, MISC, PARSER, READER, TRANSACTIONS, WRITER
+        };
+        static constexpr uint MEMORY_COUNT{7};
+        enum class MEMORY_HUGE_PAGES : unsigned char {
+            NONE, TRANSPARENT, HUGETLB_2MB, HUGETLB_1GB
         };
-        static constexpr uint MEMORY_COUNT{6};
         enum class DISABLE_CHECKS : unsigned char {
             GRANTS = 1 << 0, SUPPLEMENTAL_LOG = 1 << 1, BLOCK_SUM = 1 << 2, JSON_TAGS = 1 << 3
         };
@@ -81,6 +96,11 @@ namespace OpenLogReplicator {
         static constexpr uint64_t MEMORY_CHUNK_SIZE_MB{1};
         static constexpr uint64_t MEMORY_CHUNK_SIZE{MEMORY_CHUNK_SIZE_MB * 1024 * 1024};
         static constexpr uint64_t MEMORY_CHUNK_MIN_MB{32};
+        static constexpr uint64_t MEMORY_CACHE_SIZE{8};
+        static constexpr uint64_t MEMORY_CACHE_BATCH{4};
+        static constexpr uint64_t MEMORY_HUGE_PAGE_SIZE{2 * 1024 * 1024};
+        static constexpr uint MEMORY_NUMA_NODES_MAX{8};
+        static constexpr uint64_t MEMORY_NUMA_SCAN{8};
 
         static constexpr typeBlk ZERO_BLK{0xFFFFFFFF};
 
@@ -109,8 +129,20 @@ namespace OpenLogReplicator {
         uint flags{0};
         uint disableChecks{0};
         LOG logLevel{LOG::INFO};
+        MEMORY_HUGE_PAGES memoryHugePages{MEMORY_HUGE_PAGES::NONE};
+        bool memoryNumaLocal{false};
+        // Orphaned LOB pages are evicted from the oldest when they use more chunks
+        uint64_t memoryChunksOrphanedLobsMax{0};
 
     protected:
+        // Free chunks kept by one thread, taken without the global memory lock
+        struct MemoryCache {
+            std::mutex mtx;
+            uint8_t* chunks[MEMORY_CACHE_SIZE]{};
+            uint64_t size{0};
+        };
+
+        static thread_local MemoryCache* memoryCache;
         mutable std::mutex memoryMtx;
         std::condition_variable condOutOfMemory;
         uint8_t** memoryChunks{nullptr};
@@ -120,18 +152,37 @@ namespace OpenLogReplicator {
         uint64_t memoryChunksAllocated{0};
         uint64_t memoryChunksFree{0};
         uint64_t memoryChunksHWM{0};
-        uint64_t memoryModulesAllocated[MEMORY_COUNT]{0, 0, 0, 0, 0, 0};
+        std::vector<MemoryCache*> memoryCaches;
+        uint8_t* memoryArenaMap{nullptr};
+        uint8_t* memoryArena{nullptr};
+        uint64_t memoryArenaMapSize{0};
+        uint64_t memoryArenaNodeSize{0};
+        uint memoryNumaNodes{1};
+        std::vector<uint8_t*> memoryArenaFree[MEMORY_NUMA_NODES_MAX];
+        std::atomic<uint64_t> memoryChunksCached{0};
+        std::atomic<uint64_t> memoryChunksUsed{0};
+        std::atomic<uint64_t> memoryWaiting{0};
+        std::atomic<uint64_t> memoryModulesAllocated[MEMORY_COUNT]{0, 0, 0, 0, 0, 0, 0};
 
         std::mutex mtx;
         std::condition_variable condMainLoop;
         std::set<Thread*> threads;
         pthread_t mainThread;
-        bool outOfMemoryParser{false};
+        std::atomic<bool> outOfMemoryParser{false};
         bool bigEndian{false};
 
+        [[nodiscard]] uint64_t getMemoryReserved(bool swap) const;
+        uint64_t drainMemoryCaches();
+        void updateMemoryModuleHWM(MEMORY module, uint64_t allocatedModule);
+        void initializeArena();
+        [[nodiscard]] uint8_t* allocateChunk();
+        void releaseChunk(uint8_t* chunk);
+        [[nodiscard]] uint getNumaNode() const;
+        [[nodiscard]] uint getChunkNode(const uint8_t* chunk) const;
+
     public:
         // 内存模块名称数组
-        uint64_t memoryModulesHWM[MEMORY_COUNT]{0, 0, 0, 0, 0, 0};  // 各模块内存使用高水位标记
+        std::atomic<uint64_t> memoryModulesHWM[MEMORY_COUNT]{0, 0, 0, 0, 0, 0, 0};  // 各模块内存使用高水位标记
 
         // 全局组件指针
         Metrics* metrics{nullptr};         // 指标收集器
@@ -149,6 +200,13 @@ namespace OpenLogReplicator {
         uint64_t memoryChunksWriteBufferMax{0};   // 写入缓冲区最大块数
         uint64_t memoryChunksWriteBufferMin{0};   // 写入缓冲区最小块数
 
+        // 动态内存配额（由内存调节线程调整）
+        std::atomic<uint64_t> memoryChunksReadBufferQuota{0};   // 读取缓冲区当前配额
+        std::atomic<uint64_t> memoryChunksWriteBufferQuota{0};  // 写入缓冲区当前配额
+        std::atomic<uint64_t> memoryChunksSwapQuota{0};         // 开始交换的内存阈值
+        std::atomic<uint64_t> memoryModulesWaits[MEMORY_COUNT]{0, 0, 0, 0, 0, 0, 0};  // 各模块等待内存次数
+        std::atomic<uint64_t> memoryReadBufferWaits{0};         // 读取缓冲区已满的等待次数
+
         // Disk read buffers
         uint64_t bufferSizeMax{0};
         uint64_t bufferSizeFree{0};
@@ -191,7 +249,8 @@ namespace OpenLogReplicator {
         std::condition_variable chunksMemoryManager;
         std::condition_variable chunksTransaction;
         uint64_t swappedMB{0};
-        Xid swappedFlushXid{0, 0, 0};
+        uint64_t swapClock{0};
+        std::unordered_set<Xid> swappedFlushXids;
         Xid swappedShrinkXid{0, 0, 0};
         mutable std::mutex swapMtx;
         std::condition_variable reusedTransactions;
@@ -227,6 +286,22 @@ namespace OpenLogReplicator {
             return bigEndian;
         }
 
+        [[nodiscard]] uint64_t getMemoryChunksMax() const {
+            return memoryChunksMax;
+        }
+
+        [[nodiscard]] uint64_t getMemoryChunksSwap() const {
+            return memoryChunksSwap;
+        }
+
+        [[nodiscard]] uint64_t getMemoryChunksUsed() const {
+            return memoryChunksUsed;
+        }
+
+        [[nodiscard]] uint64_t getMemoryModuleChunks(MEMORY module) const {
+            return memoryModulesAllocated[static_cast<uint>(module)];
+        }
+
         uint16_t read16(const uint8_t* buf) const {
             if (bigEndian)
                 return read16Big(buf);
@@ -536,7 +611,7 @@ namespace OpenLogReplicator {
         [[nodiscard]] uint64_t getAllocatedMemory() const;
         [[nodiscard]] uint64_t getSwapMemory(Thread* t) const;
         [[nodiscard]] uint64_t getFreeMemory(Thread* t) const;
-        [[nodiscard]] uint8_t* getMemoryChunk(Thread* t, MEMORY module, bool swap = false);
+        [[nodiscard]] uint8_t* getMemoryChunk(Thread* t, MEMORY module, bool swap = false, bool wait = true);
         void freeMemoryChunk(Thread* t, MEMORY module, uint8_t* chunk);
         void swappedMemoryInit(Thread* t, Xid xid);
         [[nodiscard]] uint64_t swappedMemorySize(Thread* t, Xid xid) const;
@@ -545,6 +620,7 @@ namespace OpenLogReplicator {
         [[nodiscard]] uint8_t* swappedMemoryGrow(Thread* t, Xid xid);
         [[nodiscard]] uint8_t* swappedMemoryShrink(Thread* t, Xid xid);
         void swappedMemoryFlush(Thread* t, Xid xid);
+        void swappedMemoryFlushEnd(Thread* t, Xid xid);
         void swappedMemoryRemove(Thread* t, Xid xid);
         void wontSwap(Thread* t);
 
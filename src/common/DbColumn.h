@@ -23,6 +23,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <utility>
 
 #include "table/SysCol.h"
+#include "types/Data.h"
 #include "types/Types.h"
 
 namespace OpenLogReplicator {
@@ -48,6 +49,8 @@ namespace OpenLogReplicator {
         bool guard;
         bool xmlType;
         bool nullWarning{false};
+        // Pre-escaped "NAME": fragment for JSON output
+        std::string jsonName;
 
         DbColumn(typeCol newCol, typeCol newGuardSeg, typeCol newSegCol, std::string newName, SysCol::COLTYPE newType, uint newLength,
                  int newPrecision, int newScale, uint64_t newCharsetId, typeCol newNumPk, bool newNullable, bool newHidden,
@@ -71,6 +74,9 @@ namespace OpenLogReplicator {
                 added(newAdded),
                 guard(newGuard),
                 xmlType(newXmlType) {
+            jsonName.push_back('"');
+            Data::writeEscapeJson(jsonName, name);
+            jsonName.append("\":");
         }
 
         friend std::ostream& operator<<(std::ostream& os, const DbColumn& column) {
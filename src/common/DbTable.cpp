@@ -26,6 +26,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "DbTable.h"
 #include "exception/RuntimeException.h"
 #include "expression/BoolValue.h"
+#include "expression/Condition.h"
 #include "expression/Token.h"
 
 namespace OpenLogReplicator {
@@ -88,6 +89,13 @@ namespace OpenLogReplicator {
             }
         } else
             sys = false;
+
+        jsonSchema.append(R"("schema":{"owner":")");
+        Data::writeEscapeJson(jsonSchema, owner);
+        jsonSchema.append(R"(","table":")");
+        Data::writeEscapeJson(jsonSchema, name);
+        jsonSchema.push_back('"');
+        jsonColumns.append(R"(,"columns":[])");
     }
 
     DbTable::~DbTable() {
@@ -130,6 +138,95 @@ namespace OpenLogReplicator {
         maxSegCol = std::max(column->segCol, maxSegCol);
 
         columns.push_back(column);
+        appendJsonColumn(column);
+    }
+
+    void DbTable::appendJsonColumn(const DbColumn* column) {
+        jsonColumns.pop_back();
+        if (columns.size() > 1)
+            jsonColumns.push_back(',');
+
+        jsonColumns.append(R"({"name":")");
+        Data::writeEscapeJson(jsonColumns, column->name);
+        jsonColumns.append(R"(","type":)");
+        switch (column->type) {
+            case SysCol::COLTYPE::VARCHAR:
+                jsonColumns.append(R"("varchar2","length":)" + std::to_string(column->length));
+                break;
+
+            case SysCol::COLTYPE::NUMBER:
+                jsonColumns.append(R"("number","precision":)" + std::to_string(column->precision) + R"(,"scale":)" +
+                                   std::to_string(column->scale));
+                break;
+
+            case SysCol::COLTYPE::LONG:
+                // Long, not supported
+                jsonColumns.append(R"("long")");
+                break;
+
+            case SysCol::COLTYPE::DATE:
+                jsonColumns.append(R"("date")");
+                break;
+
+            case SysCol::COLTYPE::RAW:
+                jsonColumns.append(R"("raw","length":)" + std::to_string(column->length));
+                break;
+
+            case SysCol::COLTYPE::LONG_RAW: // Not supported
+                jsonColumns.append(R"("long raw")");
+                break;
+
+            case SysCol::COLTYPE::CHAR:
+                jsonColumns.append(R"("char","length":)" + std::to_string(column->length));
+                break;
+
+            case SysCol::COLTYPE::FLOAT:
+                jsonColumns.append(R"("binary_float")");
+                break;
+
+            case SysCol::COLTYPE::DOUBLE:
+                jsonColumns.append(R"("binary_double")");
+                break;
+
+            case SysCol::COLTYPE::CLOB:
+                jsonColumns.append(R"("clob")");
+                break;
+
+            case SysCol::COLTYPE::BLOB:
+                jsonColumns.append(R"("blob")");
+                break;
+
+            case SysCol::COLTYPE::TIMESTAMP:
+                jsonColumns.append(R"("timestamp","length":)" + std::to_string(column->length));
+                break;
+
+            case SysCol::COLTYPE::TIMESTAMP_WITH_TZ:
+                jsonColumns.append(R"("timestamp with time zone","length":)" + std::to_string(column->length));
+                break;
+
+            case SysCol::COLTYPE::INTERVAL_YEAR_TO_MONTH:
+                jsonColumns.append(R"("interval year to month","length":)" + std::to_string(column->length));
+                break;
+
+            case SysCol::COLTYPE::INTERVAL_DAY_TO_SECOND:
+                jsonColumns.append(R"("interval day to second","length":)" + std::to_string(column->length));
+                break;
+
+            case SysCol::COLTYPE::UROWID:
+                jsonColumns.append(R"("urowid","length":)" + std::to_string(column->length));
+                break;
+
+            case SysCol::COLTYPE::TIMESTAMP_WITH_LOCAL_TZ:
+                jsonColumns.append(R"("timestamp with local time zone","length":)" + std::to_string(column->length));
+                break;
+
+            default:
+                jsonColumns.append(R"("unknown")");
+                break;
+        }
+
+        jsonColumns.append(column->nullable ? R"(,"nullable":true})" : R"(,"nullable":false})");
+        jsonColumns.push_back(']');
     }
 
     void DbTable::addLob(DbLob* lob) {
@@ -142,10 +239,11 @@ namespace OpenLogReplicator {
         tablePartitions.push_back(objx);
     }
 
-    bool DbTable::matchesCondition(const Ctx* ctx, char op, const std::unordered_map<std::string, std::string>* attributes) const {
+    bool DbTable::matchesCondition(const Ctx* ctx, char op, const std::unordered_map<std::string, std::string>* attributes,
+                                   const ExpressionRow* row, ConditionCache* cache) const {
         bool result = true;
         if (conditionValue != nullptr)
-            result = conditionValue->evaluateToBool(op, attributes);
+            result = conditionValue->evaluate(op, attributes, row, cache);
 
         if (unlikely(ctx->isTraceSet(Ctx::TRACE::CONDITION)))
             ctx->logTrace(Ctx::TRACE::CONDITION, "matchesCondition: table: " + owner + "." + name + ", condition: " + condition + ", result: " +
@@ -153,13 +251,37 @@ namespace OpenLogReplicator {
         return result;
     }
 
-    void DbTable::setCondition(const std::string& newCondition) {
+    void DbTable::setCondition(const Ctx* ctx, const std::string& newCondition, bool afterDdl) {
         this->condition = newCondition;
         if (newCondition.empty())
             return;
 
         Expression::buildTokens(newCondition, tokens);
-        conditionValue = Expression::buildCondition(newCondition, tokens, stack);
+        BoolValue* root = Expression::buildCondition(ctx, newCondition, tokens, stack, this, afterDdl);
+        try {
+            conditionValue = new Condition(newCondition, root);
+        } catch (RuntimeException& ex) {
+            delete root;
+            throw;
+        }
+        delete root;
+    }
+
+    void DbTable::skipColumn(typeCol column) {
+        const auto base = static_cast<size_t>(column >> 6);
+        if (columnsSkip.size() <= base)
+            columnsSkip.resize(base + 1, 0);
+        columnsSkip[base] |= 1ULL << (column & 0x3F);
+        ++columnsSkipped;
+    }
+
+    void DbTable::keepColumn(typeCol column) {
+        const auto base = static_cast<size_t>(column >> 6);
+        const typeMask mask = 1ULL << (column & 0x3F);
+        if (columnsSkip.size() <= base || (columnsSkip[base] & mask) == 0)
+            return;
+        columnsSkip[base] &= ~mask;
+        --columnsSkipped;
     }
 
     std::ostream& operator<<(std::ostream& os, const DbTable& table) {
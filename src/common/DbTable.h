@@ -20,7 +20,8 @@
 #include "types/Types.h"
 
 namespace OpenLogReplicator {
-    class BoolValue;
+    class Condition;
+    class ConditionCache;
     class Ctx;
     class DbColumn;
     class DbLob;
@@ -70,14 +71,20 @@ namespace OpenLogReplicator {
         std::string name;
         std::string tokSuf;
         std::string condition;
-        BoolValue* conditionValue{nullptr};
+        Condition* conditionValue{nullptr};
         std::vector<DbColumn*> columns;
         std::vector<DbLob*> lobs;
         std::vector<typeObj2> tablePartitions;
         std::vector<typeCol> pk;
         std::vector<typeCol> tagCols;
+        // Columns not selected by the "columns" filter, one bit per column like the builder value set
+        std::vector<typeMask> columnsSkip;
+        typeCol columnsSkipped{0};
         std::vector<Token*> tokens;
         std::vector<Expression*> stack;
+        // Pre-escaped JSON output, a schema change creates a new table object
+        std::string jsonSchema;
+        std::string jsonColumns;
         TABLE systemTable;
         bool sys;
 
@@ -86,10 +93,22 @@ namespace OpenLogReplicator {
         ~DbTable();
 
         void addColumn(DbColumn* column);
+        void appendJsonColumn(const DbColumn* column);
         void addLob(DbLob* lob);
         void addTablePartition(typeObj newObj, typeDataObj newDataObj);
-        bool matchesCondition(const Ctx* ctx, char op, const std::unordered_map<std::string, std::string>* attributes) const;
-        void setCondition(const std::string& newCondition);
+        bool matchesCondition(const Ctx* ctx, char op, const std::unordered_map<std::string, std::string>* attributes,
+                              const ExpressionRow* row, ConditionCache* cache) const;
+        void setCondition(const Ctx* ctx, const std::string& newCondition, bool afterDdl);
+        void skipColumn(typeCol column);
+        void keepColumn(typeCol column);
+
+        [[nodiscard]] bool isColumnSkipped(typeCol column) const {
+            // Only words up to the last skipped column are allocated
+            const uint64_t base = column >> 6;
+            if (likely(base >= columnsSkip.size()))
+                return false;
+            return (columnsSkip[base] & (1ULL << (column & 0x3F))) != 0;
+        }
 
         static bool isDebugTable(OPTIONS options) {
             return (static_cast<uint>(options) & static_cast<uint>(OPTIONS::DEBUG_TABLE)) != 0;
@@ -18,6 +18,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
 #include <cstddef>
+#include <utility>
+#include <vector>
 
 #include "LobCtx.h"
 #include "LobData.h"
@@ -26,16 +28,14 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 
 namespace OpenLogReplicator {
     void LobCtx::checkOrphanedLobs(const Ctx* ctx, const LobId& lobId, Xid xid, FileOffset fileOffset) {
-        const LobKey lobKey(lobId, 0);
-        for (auto orphanedLobsIt = orphanedLobs->upper_bound(lobKey);
-             orphanedLobsIt != orphanedLobs->end() && orphanedLobsIt->first.lobId == lobId;) {
+        std::vector<std::pair<typeDba, uint8_t*>> adopted;
+        orphanedLobs->adopt(lobId, adopted);
 
-            addLob(ctx, lobId, orphanedLobsIt->first.page, 0, orphanedLobsIt->second, xid, fileOffset);
+        for (const auto& [page, data]: adopted) {
+            addLob(ctx, lobId, page, 0, data, xid, fileOffset);
 
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::LOB)))
-                ctx->logTrace(Ctx::TRACE::LOB, "id: " + lobId.lower() + " page: " + std::to_string(orphanedLobsIt->first.page));
-
-            orphanedLobsIt = orphanedLobs->erase(orphanedLobsIt);
+                ctx->logTrace(Ctx::TRACE::LOB, "id: " + lobId.lower() + " page: " + std::to_string(page));
         }
     }
 
@@ -49,16 +49,14 @@ namespace OpenLogReplicator {
             lobs.insert_or_assign(lobId, lobData);
         }
 
-        const LobDataElement element(page, pageOffset);
-        auto dataMapIt = lobData->dataMap.find(element);
-        if (dataMapIt != lobData->dataMap.end()) {
+        auto [dataMapIt, inserted] = lobData->dataMap.try_emplace(LobDataElement(page, pageOffset), data);
+        if (!inserted) {
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::LOB)))
                 ctx->logTrace(Ctx::TRACE::LOB, "id: " + lobId.lower() + " page: " + std::to_string(page) + " OVERWRITE");
             delete[] dataMapIt->second;
+            dataMapIt->second = data;
         }
 
-        lobData->dataMap.insert_or_assign(element, data);
-
         const auto* redoLogRecordLob = reinterpret_cast<const RedoLogRecord*>(data + sizeof(uint64_t));
         if (redoLogRecordLob->lobPageSize != 0) {
             if (lobData->pageSize == 0) {
@@ -71,17 +69,8 @@ namespace OpenLogReplicator {
         }
 
         const typeDba pageNo = redoLogRecordLob->lobPageNo;
-        if (pageNo != RedoLogRecord::INVALID_LOB_PAGE_NO) {
-            auto indexMapIt = lobData->indexMap.find(page);
-            if (indexMapIt != lobData->indexMap.end()) {
-                if (unlikely(indexMapIt->second != page))
-                    throw RedoLogException(50004, "duplicate index lobid: " + lobId.upper() + ", page: " + std::to_string(page) +
-                                                  ", already set to: " + std::to_string(indexMapIt->second) + ", xid: " + xid.toString() + ", offset: " +
-                                                  fileOffset.toString());
-            } else {
-                lobData->indexMap.insert_or_assign(pageNo, page);
-            }
-        }
+        if (pageNo != RedoLogRecord::INVALID_LOB_PAGE_NO)
+            lobData->setPage(pageNo, page);
     }
 
     void LobCtx::orderList(typeDba page, typeDba next) {
@@ -161,9 +150,10 @@ namespace OpenLogReplicator {
 
         lobData->sizePages = sizePages;
         lobData->sizeRest = sizeRest;
+        lobData->reserve(sizeRest > 0 ? sizePages + 1 : sizePages);
     }
 
-    void LobCtx::setPage(const LobId& lobId, typeDba page, typeDba pageNo, Xid xid, FileOffset fileOffset) {
+    void LobCtx::setPage(const LobId& lobId, typeDba page, typeDba pageNo) {
         LobData* lobData;
         auto lobsIt = lobs.find(lobId);
         if (lobsIt != lobs.end()) {
@@ -173,16 +163,7 @@ namespace OpenLogReplicator {
             lobs.insert_or_assign(lobId, lobData);
         }
 
-        auto indexMapIt = lobData->indexMap.find(page);
-        if (indexMapIt != lobData->indexMap.end()) {
-            if (unlikely(indexMapIt->second != page))
-                throw RedoLogException(50004, "duplicate index lobid: " + lobId.upper() + ", page: " + std::to_string(page) +
-                                              ", already set to: " + std::to_string(indexMapIt->second) + ", xid: " + xid.toString() + ", offset: " +
-                                              fileOffset.toString());
-            return;
-        }
-
-        lobData->indexMap.insert_or_assign(pageNo, page);
+        lobData->setPage(pageNo, page);
     }
 
     void LobCtx::purge() {
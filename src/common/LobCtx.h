@@ -20,11 +20,10 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #ifndef LOB_CTX_H_
 #define LOB_CTX_H_
 
-#include <map>
 #include <unordered_map>
 
 #include "LobData.h"
-#include "LobKey.h"
+#include "OrphanedLobs.h"
 #include "types/LobId.h"
 #include "types/FileOffset.h"
 #include "types/Xid.h"
@@ -36,8 +35,8 @@ namespace OpenLogReplicator {
     class LobCtx final {
     public:
         std::unordered_map<LobId, LobData*> lobs;
-        std::map<LobKey, uint8_t*>* orphanedLobs;
-        std::map<typeDba, uint8_t*> listMap;
+        OrphanedLobs* orphanedLobs;
+        std::unordered_map<typeDba, uint8_t*> listMap;
 
         void checkOrphanedLobs(const Ctx* ctx, const LobId& lobId, Xid xid, FileOffset fileOffset);
         void addLob(const Ctx* ctx, const LobId& lobId, typeDba page, uint16_t pageOffset, uint8_t* data, Xid xid, FileOffset fileOffset);
@@ -45,7 +44,7 @@ namespace OpenLogReplicator {
         void setList(typeDba page, const uint8_t* data, uint16_t size);
         void appendList(const Ctx* ctx, typeDba page, const uint8_t* data);
         void setSize(const LobId& lobId, uint32_t sizePages, uint16_t sizeRest);
-        void setPage(const LobId& lobId, typeDba page, uint32_t pageNo, Xid xid, FileOffset fileOffset);
+        void setPage(const LobId& lobId, typeDba page, uint32_t pageNo);
         void purge();
     };
 }
@@ -38,6 +38,10 @@ namespace OpenLogReplicator {
         return false;
     }
 
+    bool LobDataElement::operator==(const LobDataElement& other) const {
+        return (dba == other.dba) && (pageOffset == other.pageOffset);
+    }
+
 
     LobData::LobData() :
             pageSize(0),
@@ -49,6 +53,55 @@ namespace OpenLogReplicator {
         for (const auto& [_, ptr]: dataMap)
             delete[] ptr;
         dataMap.clear();
-        indexMap.clear();
+        indexPages.clear();
+        indexPagesHigh.clear();
+    }
+
+    void LobData::reserve(uint32_t pages) {
+        if (pages > PAGES_PRESIZE_MAX || pages <= indexPages.size())
+            return;
+        indexPages.resize(pages, 0);
+    }
+
+    void LobData::setPage(uint32_t pageNo, typeDba page) {
+        if (unlikely(pageNo >= PAGES_PRESIZE_MAX)) {
+            indexPagesHigh.insert_or_assign(pageNo, page);
+            return;
+        }
+        if (pageNo >= indexPages.size())
+            indexPages.resize(static_cast<size_t>(pageNo) + 1, 0);
+        indexPages[pageNo] = page;
+    }
+
+    typeDba LobData::getPage(uint32_t pageNo) const {
+        if (unlikely(pageNo >= PAGES_PRESIZE_MAX)) {
+            auto indexPagesHighIt = indexPagesHigh.find(pageNo);
+            if (indexPagesHighIt == indexPagesHigh.end())
+                return 0;
+            return indexPagesHighIt->second;
+        }
+        if (pageNo >= indexPages.size())
+            return 0;
+        return indexPages[pageNo];
+    }
+
+    uint8_t* LobData::getData(typeDba page, uint16_t pageOffset) const {
+        auto dataMapIt = dataMap.find(LobDataElement(page, pageOffset));
+        if (dataMapIt == dataMap.end())
+            return nullptr;
+        return dataMapIt->second;
+    }
+
+    uint8_t* LobData::getPageData(uint32_t pageNo) const {
+        const typeDba page = getPage(pageNo);
+        if (page == 0)
+            return nullptr;
+        return getData(page, 0);
+    }
+}
+
+namespace std {
+    size_t hash<OpenLogReplicator::LobDataElement>::operator()(const OpenLogReplicator::LobDataElement& element) const {
+        return hash<uint64_t>()((static_cast<uint64_t>(element.dba) << 16) | element.pageOffset);
     }
 }
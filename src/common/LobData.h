@@ -20,7 +20,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #ifndef LOB_DATA_H_
 #define LOB_DATA_H_
 
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "types/Types.h"
 
@@ -30,18 +31,40 @@ namespace OpenLogReplicator {
         LobDataElement(typeDba newDba, uint16_t newPageOffset);
 
         bool operator<(const LobDataElement& other) const;
+        bool operator==(const LobDataElement& other) const;
 
         typeDba dba{0};
         uint16_t pageOffset{0};
     };
+}
+
+namespace std {
+    template<>
+    struct hash<OpenLogReplicator::LobDataElement> {
+        size_t operator()(const OpenLogReplicator::LobDataElement& element) const;
+    };
+}
 
+namespace OpenLogReplicator {
     class LobData final {
     public:
+        // Larger sizes from redo are not trusted for pre-sizing, the index grows as pages arrive
+        static constexpr uint32_t PAGES_PRESIZE_MAX{1024 * 1024};
+
         LobData();
         ~LobData();
 
-        std::map<LobDataElement, uint8_t*> dataMap;
-        std::map<uint32_t, typeDba> indexMap;
+        void reserve(uint32_t pages);
+        void setPage(uint32_t pageNo, typeDba page);
+        [[nodiscard]] typeDba getPage(uint32_t pageNo) const;
+        [[nodiscard]] uint8_t* getData(typeDba page, uint16_t pageOffset) const;
+        [[nodiscard]] uint8_t* getPageData(uint32_t pageNo) const;
+
+        std::unordered_map<LobDataElement, uint8_t*> dataMap;
+        // Block address of every page, indexed by page number, 0 for not known pages
+        std::vector<typeDba> indexPages;
+        // Pages with numbers above PAGES_PRESIZE_MAX, not trusted to size the index
+        std::unordered_map<uint32_t, typeDba> indexPagesHigh;
 
         uint32_t pageSize;
         uint32_t sizePages;
@@ -0,0 +1,179 @@
+/* Thread moving memory quotas between modules
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <algorithm>
+
+#include "MemoryGovernor.h"
+#include "exception/RuntimeException.h"
+#include "metrics/Metrics.h"
+
+namespace OpenLogReplicator {
+    MemoryGovernor::MemoryGovernor(Ctx* newCtx, std::string newAlias, uint64_t newIntervalMs) :
+            Thread(newCtx, std::move(newAlias)),
+            intervalMs(newIntervalMs) {
+    }
+
+    void MemoryGovernor::initialize() {
+        step = std::max<uint64_t>(1, ctx->getMemoryChunksMax() / REBALANCE_STEPS);
+
+        // The read buffer starts small and grows when the reader is blocked, the write buffer starts at its maximum and shrinks when
+        // the writer keeps up
+        ctx->memoryChunksReadBufferQuota = ctx->memoryChunksReadBufferMin;
+        ctx->memoryChunksWriteBufferQuota = ctx->memoryChunksWriteBufferMax;
+        ctx->memoryChunksSwapQuota = ctx->getMemoryChunksSwap();
+        lastReadBufferWaits = ctx->memoryReadBufferWaits;
+        for (uint module = 0; module < Ctx::MEMORY_COUNT; ++module)
+            lastModulesWaits[module] = ctx->memoryModulesWaits[module];
+
+        emitQuotas();
+    }
+
+    void MemoryGovernor::wakeUp() {
+        contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_GOVERNOR_WAKEUP);
+        std::unique_lock<std::mutex> const lck(mtx);
+        condGovernor.notify_all();
+        contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void MemoryGovernor::run() {
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "memory governor (" + ss.str() + ") start");
+        }
+
+        try {
+            while (!ctx->softShutdown) {
+                rebalance();
+
+                contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_GOVERNOR_WAKEUP);
+                std::unique_lock<std::mutex> lck(mtx);
+                if (ctx->softShutdown)
+                    break;
+                if (unlikely(ctx->isTraceSet(Ctx::TRACE::SLEEP)))
+                    ctx->logTrace(Ctx::TRACE::SLEEP, "MemoryGovernor:run");
+                contextSet(Thread::CONTEXT::WAIT, Thread::REASON::MEMORY_GOVERNOR_NO_WORK);
+                condGovernor.wait_for(lck, std::chrono::milliseconds(intervalMs));
+                contextSet(Thread::CONTEXT::CPU);
+            }
+        } catch (RuntimeException& ex) {
+            ctx->error(ex.code, ex.msg);
+            ctx->stopHard();
+        }
+        contextSet(Thread::CONTEXT::CPU);
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "memory governor (" + ss.str() + ") stop");
+        }
+    }
+
+    void MemoryGovernor::rebalance() {
+        const uint64_t chunksMax = ctx->getMemoryChunksMax();
+        const uint64_t chunksUsed = ctx->getMemoryChunksUsed();
+        const bool spare = chunksMax > chunksUsed + 2 * step;
+
+        const uint64_t readBufferWaits = ctx->memoryReadBufferWaits;
+        const uint64_t readerWaits = readBufferWaits - lastReadBufferWaits;
+        lastReadBufferWaits = readBufferWaits;
+        const uint64_t builderWaits = waitsDelta(Ctx::MEMORY::BUILDER);
+        uint64_t transactionWaits = 0;
+        transactionWaits += waitsDelta(Ctx::MEMORY::LOBS);
+        transactionWaits += waitsDelta(Ctx::MEMORY::MISC);
+        transactionWaits += waitsDelta(Ctx::MEMORY::PARSER);
+        transactionWaits += waitsDelta(Ctx::MEMORY::READER);
+        transactionWaits += waitsDelta(Ctx::MEMORY::TRANSACTIONS);
+        transactionWaits += waitsDelta(Ctx::MEMORY::WRITER);
+
+        const uint64_t builderUsed = ctx->getMemoryModuleChunks(Ctx::MEMORY::BUILDER);
+        uint64_t readerQuota = ctx->memoryChunksReadBufferQuota;
+        uint64_t builderQuota = ctx->memoryChunksWriteBufferQuota;
+        uint64_t swapQuota = ctx->memoryChunksSwapQuota;
+
+        if (transactionWaits > 0) {
+            // Transactions are out of memory: take memory back from the buffers and start swapping earlier
+            readerQuota = std::max(ctx->memoryChunksReadBufferMin, readerQuota > step ? readerQuota - step : 0);
+            builderQuota = std::max({ctx->memoryChunksWriteBufferMin, builderUsed, builderQuota > step ? builderQuota - step : 0});
+            swapQuota = std::max(ctx->getMemoryChunksSwap(), swapQuota > step ? swapQuota - step : 0);
+        } else {
+            // Reader is blocked by its buffer quota, for example during archive log catch-up
+            if (readerWaits > 0 && spare)
+                readerQuota = std::min(ctx->memoryChunksReadBufferMax, readerQuota + step);
+
+            // Builder is blocked by its quota, or the writer keeps up and the buffer stays mostly empty
+            if (builderWaits > 0 && spare)
+                builderQuota = std::min(ctx->memoryChunksWriteBufferMax, builderQuota + step);
+            else if (builderWaits == 0 && builderUsed * 2 < builderQuota)
+                builderQuota = std::max(ctx->memoryChunksWriteBufferMin, builderQuota > step ? builderQuota - step : 0);
+
+            // Memory use is close to the swap threshold while there is spare memory, for example during a batch window
+            const uint64_t reserved = readerQuota + builderQuota + ctx->memoryChunksUnswapBufferMin;
+            const uint64_t swapCeiling = std::max(ctx->getMemoryChunksSwap(), chunksMax > reserved ? chunksMax - reserved : 0);
+            if (ctx->getMemoryChunksSwap() > 0 && spare && chunksUsed + step >= swapQuota)
+                swapQuota = std::min(swapCeiling, swapQuota + step);
+        }
+
+        bool changed = false;
+        changed |= setQuota(ctx->memoryChunksReadBufferQuota, readerQuota);
+        changed |= setQuota(ctx->memoryChunksWriteBufferQuota, builderQuota);
+        changed |= setQuota(ctx->memoryChunksSwapQuota, swapQuota);
+        if (!changed)
+            return;
+
+        // Builders waiting for the old quota can continue
+        ctx->wakeAllOutOfMemory();
+        emitQuotas();
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::PERFORMANCE)))
+            ctx->logTrace(Ctx::TRACE::PERFORMANCE, "memory quota: read buffer: " + std::to_string(readerQuota * Ctx::MEMORY_CHUNK_SIZE_MB) +
+                                                   "MB, write buffer: " + std::to_string(builderQuota * Ctx::MEMORY_CHUNK_SIZE_MB) + "MB, swap: " +
+                                                   std::to_string(swapQuota * Ctx::MEMORY_CHUNK_SIZE_MB) + "MB");
+    }
+
+    uint64_t MemoryGovernor::waitsDelta(Ctx::MEMORY module) {
+        const uint64_t waits = ctx->memoryModulesWaits[static_cast<uint>(module)];
+        const uint64_t delta = waits - lastModulesWaits[static_cast<uint>(module)];
+        lastModulesWaits[static_cast<uint>(module)] = waits;
+        return delta;
+    }
+
+    bool MemoryGovernor::setQuota(std::atomic<uint64_t>& quota, uint64_t value) {
+        const uint64_t oldValue = quota.exchange(value);
+        if (oldValue == value)
+            return false;
+
+        if (ctx->metrics != nullptr) {
+            if (value > oldValue)
+                ctx->metrics->emitMemoryQuotaChangesGrow(1);
+            else
+                ctx->metrics->emitMemoryQuotaChangesShrink(1);
+        }
+        return true;
+    }
+
+    void MemoryGovernor::emitQuotas() const {
+        if (ctx->metrics == nullptr)
+            return;
+
+        ctx->metrics->emitMemoryQuotaMbBuilder(ctx->memoryChunksWriteBufferQuota * Ctx::MEMORY_CHUNK_SIZE_MB);
+        ctx->metrics->emitMemoryQuotaMbReader(ctx->memoryChunksReadBufferQuota * Ctx::MEMORY_CHUNK_SIZE_MB);
+        ctx->metrics->emitMemoryQuotaMbSwap(ctx->memoryChunksSwapQuota * Ctx::MEMORY_CHUNK_SIZE_MB);
+    }
+}
@@ -0,0 +1,65 @@
+/* Header for MemoryGovernor class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef MEMORY_GOVERNOR_H_
+#define MEMORY_GOVERNOR_H_
+
+#include <condition_variable>
+#include <mutex>
+
+#include "Ctx.h"
+#include "Thread.h"
+
+namespace OpenLogReplicator {
+    class MemoryGovernor final : public Thread {
+    public:
+        static constexpr uint64_t REBALANCE_INTERVAL_MIN_MS{100};
+        static constexpr uint64_t REBALANCE_INTERVAL_MAX_MS{60000};
+        static constexpr uint64_t REBALANCE_STEPS{32};
+
+    protected:
+        uint64_t intervalMs;
+        uint64_t step{1};
+        uint64_t lastReadBufferWaits{0};
+        uint64_t lastModulesWaits[Ctx::MEMORY_COUNT]{0, 0, 0, 0, 0, 0};
+
+        std::mutex mtx;
+        std::condition_variable condGovernor;
+
+    public:
+        MemoryGovernor(Ctx* newCtx, std::string newAlias, uint64_t newIntervalMs);
+        ~MemoryGovernor() override = default;
+
+        void initialize();
+        void wakeUp() override;
+        void run() override;
+
+        std::string getName() const override {
+            return {"MemoryGovernor"};
+        }
+
+    private:
+        void rebalance();
+        uint64_t waitsDelta(Ctx::MEMORY module);
+        bool setQuota(std::atomic<uint64_t>& quota, uint64_t value);
+        void emitQuotas() const;
+    };
+}
+
+#endif
@@ -24,22 +24,47 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 
 #include "Ctx.h"
 #include "MemoryManager.h"
+#include "SwapPolicy.h"
+#include "SwapReader.h"
 #include "exception/RuntimeException.h"
 #include "metrics/Metrics.h"
 
 namespace OpenLogReplicator {
-    MemoryManager::MemoryManager(Ctx* newCtx, std::string newAlias, std::string newSwapPath) :
+    MemoryManager::MemoryManager(Ctx* newCtx, std::string newAlias, std::string newSwapPath, uint64_t newSwapReadThreads, uint64_t newUnswapPrefetch,
+                                 SwapPolicy* newSwapPolicy) :
             Thread(newCtx, std::move(newAlias)),
-            swapPath(std::move(newSwapPath)) {
+            swapPath(std::move(newSwapPath)),
+            swapReadThreads(newSwapReadThreads),
+            unswapPrefetch(newUnswapPrefetch),
+            swapPolicy(newSwapPolicy) {
     }
 
     MemoryManager::~MemoryManager() {
         cleanup(true);
+
+        delete swapPolicy;
+        swapPolicy = nullptr;
+
+        for (SwapReader* swapReader: swapReaders)
+            delete swapReader;
+        swapReaders.clear();
     }
 
     void MemoryManager::wakeUp() {
-        std::unique_lock<std::mutex> const lck(ctx->swapMtx);
-        ctx->chunksMemoryManager.notify_all();
+        {
+            std::unique_lock<std::mutex> const lck(ctx->swapMtx);
+            ctx->chunksMemoryManager.notify_all();
+        }
+        wakeUpIo(this);
+    }
+
+    void MemoryManager::wakeUpIo(Thread* t) {
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::SWAP_READER_WAKEUP);
+            std::unique_lock<std::mutex> const lck(ioMtx);
+            condIo.notify_all();
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
     }
 
     void MemoryManager::run() {
@@ -65,17 +90,22 @@ namespace OpenLogReplicator {
                 int64_t swapIndex = -1;
                 Xid unswapXid;
                 int64_t unswapIndex = -1;
+                Xid prefetchXid;
+                int64_t prefetchFirst = -1;
+                int64_t prefetchLast = -1;
+                bool prefetchReserve = false;
 
                 {
                     contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_RUN1);
                     std::unique_lock<std::mutex> lck(ctx->swapMtx);
+                    getChunksToPrefetch(prefetchXid, prefetchFirst, prefetchLast, prefetchReserve);
                     getChunkToUnswap(unswapXid, unswapIndex);
                     getChunkToSwap(swapXid, swapIndex);
 
                     if (swapIndex == -1)
                         ctx->wontSwap(this);
 
-                    if (unswapIndex == -1 && swapIndex == -1) {
+                    if (prefetchFirst == -1 && unswapIndex == -1 && swapIndex == -1) {
                         contextSet(Thread::CONTEXT::WAIT, Thread::REASON::MEMORY_NO_WORK);
                         ctx->chunksMemoryManager.wait_for(lck, std::chrono::milliseconds(10000));
                         contextSet(Thread::CONTEXT::CPU);
@@ -84,6 +114,12 @@ namespace OpenLogReplicator {
                 }
                 contextSet(Thread::CONTEXT::CPU);
 
+                // Reads for the committed transaction are handed over to swap readers, so several chunks can be in flight
+                // while this thread continues swapping out other transactions
+                bool prefetchStalled = false;
+                if (prefetchFirst != -1)
+                    prefetchStalled = !prefetch(prefetchXid, prefetchFirst, prefetchLast, prefetchReserve);
+
                 if (unswapIndex != -1) {
                     if (unswap(unswapXid, unswapIndex) && ctx->metrics != nullptr)
                         ctx->metrics->emitSwapOperationsMbRead(1);
@@ -96,12 +132,25 @@ namespace OpenLogReplicator {
                 }
                 if (swapIndex != -1 && swap(swapXid, swapIndex) && ctx->metrics != nullptr)
                     ctx->metrics->emitSwapOperationsMbWrite(1);
+
+                // No memory for the read ahead and nothing to swap out, retry when chunks are freed
+                if (prefetchStalled && unswapIndex == -1 && swapIndex == -1) {
+                    {
+                        contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_RUN2);
+                        std::unique_lock<std::mutex> lck(ctx->swapMtx);
+                        contextSet(Thread::CONTEXT::WAIT, Thread::REASON::MEMORY_NO_WORK);
+                        ctx->chunksMemoryManager.wait_for(lck, std::chrono::milliseconds(10));
+                    }
+                    contextSet(Thread::CONTEXT::CPU);
+                }
             }
         } catch (RuntimeException& ex) {
             ctx->error(ex.code, ex.msg);
             ctx->stopHard();
         }
 
+        stopIo();
+
         if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
             std::ostringstream ss;
             ss << std::this_thread::get_id();
@@ -111,10 +160,124 @@ namespace OpenLogReplicator {
 
     void MemoryManager::initialize() {
         cleanup();
+
+        if (ctx->getSwapMemory(this) == 0)
+            return;
+
+        for (uint64_t i = 0; i < swapReadThreads; ++i) {
+            auto* swapReader = new SwapReader(ctx, alias + "-swap-reader-" + std::to_string(i), this);
+            swapReaders.push_back(swapReader);
+            ctx->spawnThread(swapReader);
+        }
+    }
+
+    void MemoryManager::stopIo() {
+        {
+            contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::SWAP_READER_WAKEUP);
+            std::unique_lock<std::mutex> const lck(ioMtx);
+            ioShutdown = true;
+            condIo.notify_all();
+        }
+        contextSet(Thread::CONTEXT::CPU);
+    }
+
+    bool MemoryManager::getUnswapRequest(Thread* t, UnswapRequest& request) {
+        t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_SWAP_READ);
+        std::unique_lock<std::mutex> lck(ioMtx);
+        while (ioQueue.empty()) {
+            if (ioShutdown || ctx->hardShutdown) {
+                t->contextSet(Thread::CONTEXT::CPU);
+                return false;
+            }
+
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::SLEEP)))
+                ctx->logTrace(Ctx::TRACE::SLEEP, "MemoryManager:getUnswapRequest");
+            t->contextSet(Thread::CONTEXT::WAIT, Thread::REASON::SWAP_READER_NO_WORK);
+            condIo.wait(lck);
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_SWAP_READ);
+        }
+
+        request = ioQueue.front();
+        ioQueue.pop_front();
+        t->contextSet(Thread::CONTEXT::CPU);
+        return true;
+    }
+
+    bool MemoryManager::prefetch(Xid xid, int64_t indexFirst, int64_t indexLast, bool reserve) {
+        for (int64_t index = indexFirst; index <= indexLast; ++index) {
+            // The allocation doesn't wait, so swapping out is never stalled by the read ahead. Only the chunk the flush is blocked on
+            // may use the unswap reserve, the other chunks are read only into memory free above it
+            uint8_t* tc = ctx->getMemoryChunk(this, Ctx::MEMORY::TRANSACTIONS, reserve && index == indexFirst, false);
+            if (tc == nullptr) {
+                prefetchCancel(xid, index, indexLast);
+                return index > indexFirst;
+            }
+
+            {
+                contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_PREFETCH);
+                std::unique_lock<std::mutex> const lck(ioMtx);
+                ioQueue.push_back({xid, index, tc});
+                condIo.notify_one();
+            }
+            contextSet(Thread::CONTEXT::CPU);
+        }
+        return true;
+    }
+
+    void MemoryManager::prefetchCancel(Xid xid, int64_t indexFirst, int64_t indexLast) {
+        // Chunks not queued for reading are picked again by the next prefetch
+        {
+            contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_PREFETCH);
+            std::unique_lock<std::mutex> const lck(ctx->swapMtx);
+            const auto& it = ctx->swapChunks.find(xid);
+            if (unlikely(it == ctx->swapChunks.end()))
+                throw RuntimeException(50070, "swap chunk not found for xid: " + xid.toString() + " during prefetch");
+            SwapChunk* sc = it->second;
+            sc->unswapInFlight -= indexLast - indexFirst + 1;
+            sc->unswapNext = indexFirst;
+        }
+        contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void MemoryManager::unswapPrefetched(Thread* t, const UnswapRequest& request) {
+        readChunk(t, request.xid, request.index, request.tc);
+
+        uint8_t* tc = request.tc;
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_SWAP_READ);
+            std::unique_lock<std::mutex> const lck(ctx->swapMtx);
+            const auto& it = ctx->swapChunks.find(request.xid);
+            if (unlikely(it == ctx->swapChunks.end()))
+                throw RuntimeException(50070, "swap chunk not found for xid: " + request.xid.toString() + " during prefetch read");
+            SwapChunk* sc = it->second;
+            --sc->unswapInFlight;
+
+            // Reads may complete out of order, the swapped range shrinks only when the lowest chunk is back in memory
+            if (!sc->release) {
+                sc->chunks[request.index] = tc;
+                tc = nullptr;
+                while (sc->swappedMin != -1 && sc->chunks[sc->swappedMin] != nullptr) {
+                    if (sc->swappedMin == sc->swappedMax)
+                        sc->swappedMin = sc->swappedMax = -1;
+                    else
+                        ++sc->swappedMin;
+                }
+            }
+
+            ctx->chunksTransaction.notify_all();
+            ctx->chunksMemoryManager.notify_all();
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+
+        if (tc != nullptr)
+            ctx->freeMemoryChunk(t, Ctx::MEMORY::TRANSACTIONS, tc);
+        else if (ctx->metrics != nullptr)
+            ctx->metrics->emitSwapOperationsMbRead(1);
     }
 
     uint64_t MemoryManager::cleanOldTransactions() {
         uint64_t discard = 0;
+        std::vector<Xid> busyXids;
         while (true) {
             Xid xid;
             SwapChunk* sc;
@@ -122,6 +285,8 @@ namespace OpenLogReplicator {
                 contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_CLEAN);
                 std::unique_lock<std::mutex> const lck(ctx->swapMtx);
                 if (ctx->commitedXids.empty()) {
+                    // Prefetched chunks still being read, retry later
+                    ctx->commitedXids.insert(ctx->commitedXids.end(), busyXids.begin(), busyXids.end());
                     contextSet(Thread::CONTEXT::CPU);
                     return discard;
                 }
@@ -132,6 +297,10 @@ namespace OpenLogReplicator {
                 if (it == ctx->swapChunks.end())
                     continue;
                 sc = it->second;
+                if (sc->unswapInFlight > 0) {
+                    busyXids.push_back(xid);
+                    continue;
+                }
                 if (sc->swappedMax >= 0)
                     discard += sc->swappedMax - sc->swappedMin;
                 ctx->swapChunks.erase(it);
@@ -197,19 +366,38 @@ namespace OpenLogReplicator {
         closedir(dir);
     }
 
-    void MemoryManager::getChunkToUnswap(Xid& xid, int64_t& index) {
-        if (ctx->swappedFlushXid.toUint() != 0) {
-            const auto& it = ctx->swapChunks.find(ctx->swappedFlushXid);
+    void MemoryManager::getChunksToPrefetch(Xid& xid, int64_t& indexFirst, int64_t& indexLast, bool& reserve) {
+        // Several transactions may be flushed in parallel, read ahead for the first one which needs it
+        for (const Xid flushXid: ctx->swappedFlushXids) {
+            const auto& it = ctx->swapChunks.find(flushXid);
             if (unlikely(it == ctx->swapChunks.end()))
-                throw RuntimeException(50070, "swap chunk not found for xid: " + ctx->swappedFlushXid.toString() + " during unswap");
-            const SwapChunk* sc = it->second;
-            if (sc->swappedMin > -1) {
-                index = sc->swappedMin;
-                xid = ctx->swappedFlushXid;
+                throw RuntimeException(50070, "swap chunk not found for xid: " + flushXid.toString() + " during unswap");
+            SwapChunk* sc = it->second;
+            if (sc->swappedMin == -1 || sc->release)
+                continue;
+
+            // Read ahead of the flush, keeping at most unswapPrefetch chunks in flight
+            if (sc->unswapNext < sc->swappedMin)
+                sc->unswapNext = sc->swappedMin;
+            // Nothing in flight, the flush waits for the first chunk
+            reserve = (sc->unswapInFlight == 0);
+
+            while (sc->unswapNext <= sc->swappedMax && sc->unswapInFlight < unswapPrefetch) {
+                if (indexFirst == -1)
+                    indexFirst = sc->unswapNext;
+                indexLast = sc->unswapNext;
+                ++sc->unswapNext;
+                ++sc->unswapInFlight;
+            }
+
+            if (indexFirst != -1) {
+                xid = flushXid;
                 return;
             }
         }
+    }
 
+    void MemoryManager::getChunkToUnswap(Xid& xid, int64_t& index) {
         if (ctx->swappedShrinkXid.toUint() == 0)
             return;
 
@@ -228,23 +416,27 @@ namespace OpenLogReplicator {
         if (ctx->nothingToSwap(this))
             return;
 
-        for (const auto& [swapXid, sc]: ctx->swapChunks) {
-            if (ctx->swappedFlushXid == swapXid || sc->release || sc->chunks.size() <= 1)
-                continue;
+        const SwapChunk* sc = swapPolicy->selectVictim(xid);
+        if (sc == nullptr)
+            return;
+        index = sc->swapNext();
 
-            if (sc->swappedMax < static_cast<int64_t>(sc->chunks.size() - 2)) {
-                index = sc->swappedMax + 1;
-                xid = swapXid;
-                return;
-            }
+        if (xid == swapVictimXid)
+            return;
+        swapVictimXid = xid;
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::TRANSACTION)))
+            ctx->logTrace(Ctx::TRACE::TRANSACTION, "swap victim xid: " + xid.toString() + " policy: " + swapPolicy->getName() + " size: " +
+                          std::to_string(sc->chunks.size()) + "MB idle: " + std::to_string(ctx->swapClock - sc->touched) + "MB");
+
+        if (ctx->metrics != nullptr) {
+            ctx->metrics->emitSwapVictims(1);
+            ctx->metrics->emitSwapVictimIdleMb(ctx->swapClock - sc->touched);
+            ctx->metrics->emitSwapVictimSizeMb(sc->chunks.size());
         }
     }
 
-    bool MemoryManager::unswap(Xid xid, int64_t index) {
-        uint8_t* tc = ctx->getMemoryChunk(this, Ctx::MEMORY::TRANSACTIONS, true);
-        if (tc == nullptr)
-            return false;
-
+    void MemoryManager::readChunk(Thread* t, Xid xid, int64_t index, uint8_t* tc) const {
         const std::string fileName = swapPath + "/" + xid.toString() + ".swap";
         struct stat fileStat{};
 
@@ -276,12 +468,23 @@ namespace OpenLogReplicator {
         }
 #endif
 
+        t->contextSet(Thread::CONTEXT::OS, Thread::REASON::OS);
         const uint64_t bytes = pread(fileDes, tc, Ctx::MEMORY_CHUNK_SIZE, index * Ctx::MEMORY_CHUNK_SIZE);
         close(fileDes);
+        t->contextSet(Thread::CONTEXT::CPU);
 
         if (bytes != Ctx::MEMORY_CHUNK_SIZE)
             throw RuntimeException(50072, "swap file: " + fileName + " - read returned: " + strerror(errno));
+    }
 
+    bool MemoryManager::unswap(Xid xid, int64_t index) {
+        uint8_t* tc = ctx->getMemoryChunk(this, Ctx::MEMORY::TRANSACTIONS, true);
+        if (tc == nullptr)
+            return false;
+
+        readChunk(this, xid, index, tc);
+
+        const std::string fileName = swapPath + "/" + xid.toString() + ".swap";
         {
             contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::MEMORY_UNSWAP);
             std::unique_lock<std::mutex> const lck(ctx->swapMtx);
@@ -331,7 +534,7 @@ namespace OpenLogReplicator {
                 throw RuntimeException(50070, "swap chunk not found for xid: " + xid.toString() + " during swap write");
             sc = it->second;
 
-            if (sc->chunks.size() <= 1 || index >= static_cast<int64_t>(sc->chunks.size() - 1) || sc->swappedMax != index - 1) {
+            if (sc->chunks.size() <= 1 || index >= static_cast<int64_t>(sc->chunks.size() - 1) || sc->swapNext() != index) {
                 contextSet(CONTEXT::CPU);
                 return false;
             }
@@ -383,7 +586,7 @@ namespace OpenLogReplicator {
             if (ctx->swappedShrinkXid == xid) {
                 sc->chunks[index] = tc;
 
-                if (sc->swappedMax == 0) {
+                if (sc->swappedMax == sc->swappedMin) {
                     sc->swappedMin = sc->swappedMax = -1;
                     remove = true;
                 } else {
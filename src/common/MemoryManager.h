@@ -20,27 +20,62 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #ifndef MEMORY_MANAGER_H_
 #define MEMORY_MANAGER_H_
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
 #include "../common/Thread.h"
 
 namespace OpenLogReplicator {
+    class SwapPolicy;
+    class SwapReader;
+
+    struct UnswapRequest {
+        Xid xid;
+        int64_t index;
+        uint8_t* tc;
+    };
 
     class MemoryManager final : public Thread {
+    public:
+        static constexpr uint64_t SWAP_READ_THREADS_MAX{16};
+
     protected:
         std::string swapPath;
+        uint64_t swapReadThreads;
+        uint64_t unswapPrefetch;
+        SwapPolicy* swapPolicy;
+        Xid swapVictimXid{0, 0, 0};
+        std::vector<SwapReader*> swapReaders;
+
+        std::mutex ioMtx;
+        std::condition_variable condIo;
+        std::deque<UnswapRequest> ioQueue;
+        bool ioShutdown{false};
 
     public:
-        MemoryManager(Ctx* newCtx, std::string newAlias, std::string newSwapPath);
+        MemoryManager(Ctx* newCtx, std::string newAlias, std::string newSwapPath, uint64_t newSwapReadThreads, uint64_t newUnswapPrefetch,
+                      SwapPolicy* newSwapPolicy);
         ~MemoryManager() override;
 
         void wakeUp() override;
         void run() override;
         void initialize();
+        void wakeUpIo(Thread* t);
+        [[nodiscard]] bool getUnswapRequest(Thread* t, UnswapRequest& request);
+        void unswapPrefetched(Thread* t, const UnswapRequest& request);
 
     private:
         uint64_t cleanOldTransactions();
         void cleanup(bool silent = false);
         void getChunkToUnswap(Xid& xid, int64_t& index);
+        void getChunksToPrefetch(Xid& xid, int64_t& indexFirst, int64_t& indexLast, bool& reserve);
         void getChunkToSwap(Xid& xid, int64_t& index);
+        [[nodiscard]] bool prefetch(Xid xid, int64_t indexFirst, int64_t indexLast, bool reserve);
+        void prefetchCancel(Xid xid, int64_t indexFirst, int64_t indexLast);
+        void readChunk(Thread* t, Xid xid, int64_t index, uint8_t* tc) const;
+        void stopIo();
         bool unswap(Xid xid, int64_t index);
         bool swap(Xid xid, int64_t index);
 
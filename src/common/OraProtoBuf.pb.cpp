@@ -22,6 +22,27 @@ namespace _pbi = _pb::internal;
 
 namespace OpenLogReplicator {
 namespace pb {
+PROTOBUF_CONSTEXPR Lob::Lob(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.column_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.chunks_)*/uint64_t{0u}
+  , /*decltype(_impl_.chunk_)*/uint64_t{0u}
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_)*/false
+  , /*decltype(_impl_.datum_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct LobDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LobDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LobDefaultTypeInternal() {}
+  union {
+    Lob _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LobDefaultTypeInternal _Lob_default_instance_;
 PROTOBUF_CONSTEXPR Value::Value(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
@@ -80,6 +101,7 @@ PROTOBUF_CONSTEXPR Payload::Payload(
   , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.ddl_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.schema_)*/nullptr
+  , /*decltype(_impl_.lob_)*/nullptr
   , /*decltype(_impl_.op_)*/0
   , /*decltype(_impl_.seq_)*/0u
   , /*decltype(_impl_.offset_)*/uint64_t{0u}
@@ -165,11 +187,27 @@ struct RedoResponseDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RedoResponseDefaultTypeInternal _RedoResponse_default_instance_;
 }  // namespace pb
 }  // namespace OpenLogReplicator
-static ::_pb::Metadata file_level_metadata_OraProtoBuf_2eproto[8];
+static ::_pb::Metadata file_level_metadata_OraProtoBuf_2eproto[9];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_OraProtoBuf_2eproto[4];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_OraProtoBuf_2eproto = nullptr;
 
 const uint32_t TableStruct_OraProtoBuf_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _impl_.column_),
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _impl_.chunks_),
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _impl_.chunk_),
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _impl_.last_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Lob, _impl_.datum_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Value, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -182,6 +220,7 @@ const uint32_t TableStruct_OraProtoBuf_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
   PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Value, _impl_.datum_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Column, _internal_metadata_),
@@ -224,6 +263,7 @@ const uint32_t TableStruct_OraProtoBuf_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Payload, _impl_.offset_),
   PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Payload, _impl_.redo_),
   PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Payload, _impl_.num_),
+  PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::Payload, _impl_.lob_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::SchemaRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -290,17 +330,19 @@ const uint32_t TableStruct_OraProtoBuf_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::OpenLogReplicator::pb::RedoResponse, _impl_.xid_val_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::OpenLogReplicator::pb::Value)},
-  { 13, -1, -1, sizeof(::OpenLogReplicator::pb::Column)},
-  { 25, -1, -1, sizeof(::OpenLogReplicator::pb::Schema)},
-  { 38, -1, -1, sizeof(::OpenLogReplicator::pb::Payload)},
-  { 54, -1, -1, sizeof(::OpenLogReplicator::pb::SchemaRequest)},
-  { 62, 78, -1, sizeof(::OpenLogReplicator::pb::RedoRequest)},
-  { 87, 95, -1, sizeof(::OpenLogReplicator::pb::RedoResponse_AttributesEntry_DoNotUse)},
-  { 97, -1, -1, sizeof(::OpenLogReplicator::pb::RedoResponse)},
+  { 0, -1, -1, sizeof(::OpenLogReplicator::pb::Lob)},
+  { 16, -1, -1, sizeof(::OpenLogReplicator::pb::Value)},
+  { 30, -1, -1, sizeof(::OpenLogReplicator::pb::Column)},
+  { 42, -1, -1, sizeof(::OpenLogReplicator::pb::Schema)},
+  { 55, -1, -1, sizeof(::OpenLogReplicator::pb::Payload)},
+  { 72, -1, -1, sizeof(::OpenLogReplicator::pb::SchemaRequest)},
+  { 80, 96, -1, sizeof(::OpenLogReplicator::pb::RedoRequest)},
+  { 105, 113, -1, sizeof(::OpenLogReplicator::pb::RedoResponse_AttributesEntry_DoNotUse)},
+  { 115, -1, -1, sizeof(::OpenLogReplicator::pb::RedoResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
+  &::OpenLogReplicator::pb::_Lob_default_instance_._instance,
   &::OpenLogReplicator::pb::_Value_default_instance_._instance,
   &::OpenLogReplicator::pb::_Column_default_instance_._instance,
   &::OpenLogReplicator::pb::_Schema_default_instance_._instance,
@@ -313,67 +355,75 @@ static const ::_pb::Message* const file_default_instances[] = {
 
 const char descriptor_table_protodef_OraProtoBuf_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\021OraProtoBuf.proto\022\024OpenLogReplicator.p"
-  "b\"\221\001\n\005Value\022\014\n\004name\030\001 \001(\t\022\023\n\tvalue_int\030\002"
-  " \001(\003H\000\022\025\n\013value_float\030\003 \001(\002H\000\022\026\n\014value_d"
-  "ouble\030\004 \001(\001H\000\022\026\n\014value_string\030\005 \001(\tH\000\022\025\n"
-  "\013value_bytes\030\006 \001(\014H\000B\007\n\005datum\"\212\001\n\006Column"
-  "\022\014\n\004name\030\001 \001(\t\022.\n\004type\030\002 \001(\0162 .OpenLogRe"
-  "plicator.pb.ColumnType\022\016\n\006length\030\003 \001(\005\022\021"
-  "\n\tprecision\030\004 \001(\005\022\r\n\005scale\030\005 \001(\005\022\020\n\010null"
-  "able\030\006 \001(\010\"\207\001\n\006Schema\022\r\n\005owner\030\001 \001(\t\022\014\n\004"
-  "name\030\002 \001(\t\022\013\n\003obj\030\003 \001(\r\022\014\n\002tm\030\004 \001(\004H\000\022\r\n"
-  "\003tms\030\005 \001(\tH\000\022,\n\006column\030\006 \003(\0132\034.OpenLogRe"
-  "plicator.pb.ColumnB\010\n\006tm_val\"\210\002\n\007Payload"
-  "\022$\n\002op\030\001 \001(\0162\030.OpenLogReplicator.pb.Op\022,"
-  "\n\006schema\030\002 \001(\0132\034.OpenLogReplicator.pb.Sc"
-  "hema\022\013\n\003rid\030\003 \001(\t\022+\n\006before\030\004 \003(\0132\033.Open"
-  "LogReplicator.pb.Value\022*\n\005after\030\005 \003(\0132\033."
-  "OpenLogReplicator.pb.Value\022\013\n\003ddl\030\006 \001(\t\022"
-  "\013\n\003seq\030\007 \001(\r\022\016\n\006offset\030\010 \001(\004\022\014\n\004redo\030\t \001"
-  "(\010\022\013\n\003num\030\n \001(\004\"-\n\rSchemaRequest\022\014\n\004mask"
-  "\030\001 \001(\t\022\016\n\006filter\030\002 \001(\t\"\232\002\n\013RedoRequest\022/"
-  "\n\004code\030\001 \001(\0162!.OpenLogReplicator.pb.Requ"
-  "estCode\022\025\n\rdatabase_name\030\002 \001(\t\022\r\n\003scn\030\003 "
-  "\001(\004H\000\022\r\n\003tms\030\004 \001(\tH\000\022\020\n\006tm_rel\030\005 \001(\003H\000\022\020"
-  "\n\003seq\030\006 \001(\004H\001\210\001\001\0223\n\006schema\030\007 \003(\0132#.OpenL"
-  "ogReplicator.pb.SchemaRequest\022\022\n\005c_scn\030\010"
-  " \001(\004H\002\210\001\001\022\022\n\005c_idx\030\t \001(\004H\003\210\001\001B\010\n\006tm_valB"
-  "\006\n\004_seqB\010\n\006_c_scnB\010\n\006_c_idx\"\220\003\n\014RedoResp"
-  "onse\0220\n\004code\030\001 \001(\0162\".OpenLogReplicator.p"
-  "b.ResponseCode\022\r\n\003scn\030\002 \001(\004H\000\022\016\n\004scns\030\003 "
-  "\001(\tH\000\022\014\n\002tm\030\004 \001(\004H\001\022\r\n\003tms\030\005 \001(\tH\001\022\r\n\003xi"
-  "d\030\006 \001(\tH\002\022\016\n\004xidn\030\007 \001(\004H\002\022\n\n\002db\030\010 \001(\t\022.\n"
-  "\007payload\030\t \003(\0132\035.OpenLogReplicator.pb.Pa"
-  "yload\022\r\n\005c_scn\030\n \001(\004\022\r\n\005c_idx\030\013 \001(\004\022F\n\na"
-  "ttributes\030\014 \003(\01322.OpenLogReplicator.pb.R"
-  "edoResponse.AttributesEntry\0321\n\017Attribute"
-  "sEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001B\t"
-  "\n\007scn_valB\010\n\006tm_valB\t\n\007xid_val*S\n\002Op\022\t\n\005"
-  "BEGIN\020\000\022\n\n\006COMMIT\020\001\022\n\n\006INSERT\020\002\022\n\n\006UPDAT"
-  "E\020\003\022\n\n\006DELETE\020\004\022\007\n\003DDL\020\005\022\t\n\005CHKPT\020\006*\250\002\n\n"
-  "ColumnType\022\013\n\007UNKNOWN\020\000\022\014\n\010VARCHAR2\020\001\022\n\n"
-  "\006NUMBER\020\002\022\010\n\004LONG\020\003\022\010\n\004DATE\020\004\022\007\n\003RAW\020\005\022\014"
-  "\n\010LONG_RAW\020\006\022\010\n\004CHAR\020\007\022\020\n\014BINARY_FLOAT\020\010"
-  "\022\021\n\rBINARY_DOUBLE\020\t\022\010\n\004CLOB\020\n\022\010\n\004BLOB\020\013\022"
-  "\r\n\tTIMESTAMP\020\014\022\025\n\021TIMESTAMP_WITH_TZ\020\r\022\032\n"
-  "\026INTERVAL_YEAR_TO_MONTH\020\016\022\032\n\026INTERVAL_DA"
-  "Y_TO_SECOND\020\017\022\n\n\006UROWID\020\020\022\033\n\027TIMESTAMP_W"
-  "ITH_LOCAL_TZ\020\021*=\n\013RequestCode\022\010\n\004INFO\020\000\022"
-  "\t\n\005START\020\001\022\014\n\010CONTINUE\020\002\022\013\n\007CONFIRM\020\003*\225\001"
-  "\n\014ResponseCode\022\t\n\005READY\020\000\022\020\n\014FAILED_STAR"
-  "T\020\001\022\014\n\010STARTING\020\002\022\023\n\017ALREADY_STARTED\020\003\022\r"
-  "\n\tREPLICATE\020\004\022\013\n\007PAYLOAD\020\005\022\024\n\020INVALID_DA"
-  "TABASE\020\006\022\023\n\017INVALID_COMMAND\020\0072f\n\021OpenLog"
-  "Replicator\022Q\n\004Redo\022!.OpenLogReplicator.p"
-  "b.RedoRequest\032\".OpenLogReplicator.pb.Red"
-  "oResponse(\0010\001B7\n\"io.debezium.connector.o"
-  "racle.protoB\021OpenLogReplicatorb\006proto3"
+  "b\"\244\001\n\003Lob\022\n\n\002id\030\001 \001(\t\022\016\n\006column\030\002 \001(\t\022\014\n"
+  "\004size\030\003 \001(\004\022\016\n\006chunks\030\004 \001(\004\022\r\n\005chunk\030\005 \001"
+  "(\004\022\016\n\006offset\030\006 \001(\004\022\014\n\004last\030\007 \001(\010\022\026\n\014valu"
+  "e_string\030\010 \001(\tH\000\022\025\n\013value_bytes\030\t \001(\014H\000B"
+  "\007\n\005datum\"\301\001\n\005Value\022\014\n\004name\030\001 \001(\t\022\023\n\tvalu"
+  "e_int\030\002 \001(\003H\000\022\025\n\013value_float\030\003 \001(\002H\000\022\026\n\014"
+  "value_double\030\004 \001(\001H\000\022\026\n\014value_string\030\005 \001"
+  "(\tH\000\022\025\n\013value_bytes\030\006 \001(\014H\000\022.\n\tvalue_lob"
+  "\030\007 \001(\0132\031.OpenLogReplicator.pb.LobH\000B\007\n\005d"
+  "atum\"\212\001\n\006Column\022\014\n\004name\030\001 \001(\t\022.\n\004type\030\002 "
+  "\001(\0162 .OpenLogReplicator.pb.ColumnType\022\016\n"
+  "\006length\030\003 \001(\005\022\021\n\tprecision\030\004 \001(\005\022\r\n\005scal"
+  "e\030\005 \001(\005\022\020\n\010nullable\030\006 \001(\010\"\207\001\n\006Schema\022\r\n\005"
+  "owner\030\001 \001(\t\022\014\n\004name\030\002 \001(\t\022\013\n\003obj\030\003 \001(\r\022\014"
+  "\n\002tm\030\004 \001(\004H\000\022\r\n\003tms\030\005 \001(\tH\000\022,\n\006column\030\006 "
+  "\003(\0132\034.OpenLogReplicator.pb.ColumnB\010\n\006tm_"
+  "val\"\260\002\n\007Payload\022$\n\002op\030\001 \001(\0162\030.OpenLogRep"
+  "licator.pb.Op\022,\n\006schema\030\002 \001(\0132\034.OpenLogR"
+  "eplicator.pb.Schema\022\013\n\003rid\030\003 \001(\t\022+\n\006befo"
+  "re\030\004 \003(\0132\033.OpenLogReplicator.pb.Value\022*\n"
+  "\005after\030\005 \003(\0132\033.OpenLogReplicator.pb.Valu"
+  "e\022\013\n\003ddl\030\006 \001(\t\022\013\n\003seq\030\007 \001(\r\022\016\n\006offset\030\010 "
+  "\001(\004\022\014\n\004redo\030\t \001(\010\022\013\n\003num\030\n \001(\004\022&\n\003lob\030\013 "
+  "\001(\0132\031.OpenLogReplicator.pb.Lob\"-\n\rSchema"
+  "Request\022\014\n\004mask\030\001 \001(\t\022\016\n\006filter\030\002 \001(\t\"\232\002"
+  "\n\013RedoRequest\022/\n\004code\030\001 \001(\0162!.OpenLogRep"
+  "licator.pb.RequestCode\022\025\n\rdatabase_name\030"
+  "\002 \001(\t\022\r\n\003scn\030\003 \001(\004H\000\022\r\n\003tms\030\004 \001(\tH\000\022\020\n\006t"
+  "m_rel\030\005 \001(\003H\000\022\020\n\003seq\030\006 \001(\004H\001\210\001\001\0223\n\006schem"
+  "a\030\007 \003(\0132#.OpenLogReplicator.pb.SchemaReq"
+  "uest\022\022\n\005c_scn\030\010 \001(\004H\002\210\001\001\022\022\n\005c_idx\030\t \001(\004H"
+  "\003\210\001\001B\010\n\006tm_valB\006\n\004_seqB\010\n\006_c_scnB\010\n\006_c_i"
+  "dx\"\220\003\n\014RedoResponse\0220\n\004code\030\001 \001(\0162\".Open"
+  "LogReplicator.pb.ResponseCode\022\r\n\003scn\030\002 \001"
+  "(\004H\000\022\016\n\004scns\030\003 \001(\tH\000\022\014\n\002tm\030\004 \001(\004H\001\022\r\n\003tm"
+  "s\030\005 \001(\tH\001\022\r\n\003xid\030\006 \001(\tH\002\022\016\n\004xidn\030\007 \001(\004H\002"
+  "\022\n\n\002db\030\010 \001(\t\022.\n\007payload\030\t \003(\0132\035.OpenLogR"
+  "eplicator.pb.Payload\022\r\n\005c_scn\030\n \001(\004\022\r\n\005c"
+  "_idx\030\013 \001(\004\022F\n\nattributes\030\014 \003(\01322.OpenLog"
+  "Replicator.pb.RedoResponse.AttributesEnt"
+  "ry\0321\n\017AttributesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005va"
+  "lue\030\002 \001(\t:\0028\001B\t\n\007scn_valB\010\n\006tm_valB\t\n\007xi"
+  "d_val*{\n\002Op\022\t\n\005BEGIN\020\000\022\n\n\006COMMIT\020\001\022\n\n\006IN"
+  "SERT\020\002\022\n\n\006UPDATE\020\003\022\n\n\006DELETE\020\004\022\007\n\003DDL\020\005\022"
+  "\t\n\005CHKPT\020\006\022\017\n\013PROVISIONAL\020\007\022\014\n\010ROLLBACK\020"
+  "\010\022\007\n\003LOB\020\t*\250\002\n\nColumnType\022\013\n\007UNKNOWN\020\000\022\014"
+  "\n\010VARCHAR2\020\001\022\n\n\006NUMBER\020\002\022\010\n\004LONG\020\003\022\010\n\004DA"
+  "TE\020\004\022\007\n\003RAW\020\005\022\014\n\010LONG_RAW\020\006\022\010\n\004CHAR\020\007\022\020\n"
+  "\014BINARY_FLOAT\020\010\022\021\n\rBINARY_DOUBLE\020\t\022\010\n\004CL"
+  "OB\020\n\022\010\n\004BLOB\020\013\022\r\n\tTIMESTAMP\020\014\022\025\n\021TIMESTA"
+  "MP_WITH_TZ\020\r\022\032\n\026INTERVAL_YEAR_TO_MONTH\020\016"
+  "\022\032\n\026INTERVAL_DAY_TO_SECOND\020\017\022\n\n\006UROWID\020\020"
+  "\022\033\n\027TIMESTAMP_WITH_LOCAL_TZ\020\021*=\n\013Request"
+  "Code\022\010\n\004INFO\020\000\022\t\n\005START\020\001\022\014\n\010CONTINUE\020\002\022"
+  "\013\n\007CONFIRM\020\003*\225\001\n\014ResponseCode\022\t\n\005READY\020\000"
+  "\022\020\n\014FAILED_START\020\001\022\014\n\010STARTING\020\002\022\023\n\017ALRE"
+  "ADY_STARTED\020\003\022\r\n\tREPLICATE\020\004\022\013\n\007PAYLOAD\020"
+  "\005\022\024\n\020INVALID_DATABASE\020\006\022\023\n\017INVALID_COMMA"
+  "ND\020\0072f\n\021OpenLogReplicator\022Q\n\004Redo\022!.Open"
+  "LogReplicator.pb.RedoRequest\032\".OpenLogRe"
+  "plicator.pb.RedoResponse(\0010\001B7\n\"io.debez"
+  "ium.connector.oracle.protoB\021OpenLogRepli"
+  "catorb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_OraProtoBuf_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_OraProtoBuf_2eproto = {
-    false, false, 2238, descriptor_table_protodef_OraProtoBuf_2eproto,
+    false, false, 2533, descriptor_table_protodef_OraProtoBuf_2eproto,
     "OraProtoBuf.proto",
-    &descriptor_table_OraProtoBuf_2eproto_once, nullptr, 0, 8,
+    &descriptor_table_OraProtoBuf_2eproto_once, nullptr, 0, 9,
     schemas, file_default_instances, TableStruct_OraProtoBuf_2eproto::offsets,
     file_level_metadata_OraProtoBuf_2eproto, file_level_enum_descriptors_OraProtoBuf_2eproto,
     file_level_service_descriptors_OraProtoBuf_2eproto,
@@ -399,6 +449,9 @@ bool Op_IsValid(int value) {
     case 4:
     case 5:
     case 6:
+    case 7:
+    case 8:
+    case 9:
       return true;
     default:
       return false;
@@ -472,12 +525,528 @@ bool ResponseCode_IsValid(int value) {
 }
 
 
+// ===================================================================
+
+class Lob::_Internal {
+ public:
+};
+
+Lob::Lob(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:OpenLogReplicator.pb.Lob)
+}
+Lob::Lob(const Lob& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Lob* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.column_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.chunks_){}
+    , decltype(_impl_.chunk_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.last_){}
+    , decltype(_impl_.datum_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.column_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.column_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_column().empty()) {
+    _this->_impl_.column_.Set(from._internal_column(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.size_, &from._impl_.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_) -
+    reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.last_));
+  clear_has_datum();
+  switch (from.datum_case()) {
+    case kValueString: {
+      _this->_internal_set_value_string(from._internal_value_string());
+      break;
+    }
+    case kValueBytes: {
+      _this->_internal_set_value_bytes(from._internal_value_bytes());
+      break;
+    }
+    case DATUM_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:OpenLogReplicator.pb.Lob)
+}
+
+inline void Lob::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.column_){}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.chunks_){uint64_t{0u}}
+    , decltype(_impl_.chunk_){uint64_t{0u}}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.last_){false}
+    , decltype(_impl_.datum_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.column_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.column_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_datum();
+}
+
+Lob::~Lob() {
+  // @@protoc_insertion_point(destructor:OpenLogReplicator.pb.Lob)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Lob::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.column_.Destroy();
+  if (has_datum()) {
+    clear_datum();
+  }
+}
+
+void Lob::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Lob::clear_datum() {
+// @@protoc_insertion_point(one_of_clear_start:OpenLogReplicator.pb.Lob)
+  switch (datum_case()) {
+    case kValueString: {
+      _impl_.datum_.value_string_.Destroy();
+      break;
+    }
+    case kValueBytes: {
+      _impl_.datum_.value_bytes_.Destroy();
+      break;
+    }
+    case DATUM_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = DATUM_NOT_SET;
+}
+
+
+void Lob::Clear() {
+// @@protoc_insertion_point(message_clear_start:OpenLogReplicator.pb.Lob)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.column_.ClearToEmpty();
+  ::memset(&_impl_.size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.last_) -
+      reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.last_));
+  clear_datum();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Lob::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "OpenLogReplicator.pb.Lob.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string column = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_column();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "OpenLogReplicator.pb.Lob.column"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 chunks = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.chunks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 chunk = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.chunk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool last = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string value_string = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_value_string();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "OpenLogReplicator.pb.Lob.value_string"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes value_bytes = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_value_bytes();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Lob::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:OpenLogReplicator.pb.Lob)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "OpenLogReplicator.pb.Lob.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string column = 2;
+  if (!this->_internal_column().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_column().data(), static_cast<int>(this->_internal_column().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "OpenLogReplicator.pb.Lob.column");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_column(), target);
+  }
+
+  // uint64 size = 3;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_size(), target);
+  }
+
+  // uint64 chunks = 4;
+  if (this->_internal_chunks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_chunks(), target);
+  }
+
+  // uint64 chunk = 5;
+  if (this->_internal_chunk() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_chunk(), target);
+  }
+
+  // uint64 offset = 6;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_offset(), target);
+  }
+
+  // bool last = 7;
+  if (this->_internal_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_last(), target);
+  }
+
+  // string value_string = 8;
+  if (_internal_has_value_string()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value_string().data(), static_cast<int>(this->_internal_value_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "OpenLogReplicator.pb.Lob.value_string");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_value_string(), target);
+  }
+
+  // bytes value_bytes = 9;
+  if (_internal_has_value_bytes()) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_value_bytes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:OpenLogReplicator.pb.Lob)
+  return target;
+}
+
+size_t Lob::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:OpenLogReplicator.pb.Lob)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string column = 2;
+  if (!this->_internal_column().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_column());
+  }
+
+  // uint64 size = 3;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  // uint64 chunks = 4;
+  if (this->_internal_chunks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_chunks());
+  }
+
+  // uint64 chunk = 5;
+  if (this->_internal_chunk() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_chunk());
+  }
+
+  // uint64 offset = 6;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  // bool last = 7;
+  if (this->_internal_last() != 0) {
+    total_size += 1 + 1;
+  }
+
+  switch (datum_case()) {
+    // string value_string = 8;
+    case kValueString: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_value_string());
+      break;
+    }
+    // bytes value_bytes = 9;
+    case kValueBytes: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_value_bytes());
+      break;
+    }
+    case DATUM_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Lob::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Lob::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Lob::GetClassData() const { return &_class_data_; }
+
+
+void Lob::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Lob*>(&to_msg);
+  auto& from = static_cast<const Lob&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:OpenLogReplicator.pb.Lob)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_column().empty()) {
+    _this->_internal_set_column(from._internal_column());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  if (from._internal_chunks() != 0) {
+    _this->_internal_set_chunks(from._internal_chunks());
+  }
+  if (from._internal_chunk() != 0) {
+    _this->_internal_set_chunk(from._internal_chunk());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_last() != 0) {
+    _this->_internal_set_last(from._internal_last());
+  }
+  switch (from.datum_case()) {
+    case kValueString: {
+      _this->_internal_set_value_string(from._internal_value_string());
+      break;
+    }
+    case kValueBytes: {
+      _this->_internal_set_value_bytes(from._internal_value_bytes());
+      break;
+    }
+    case DATUM_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Lob::CopyFrom(const Lob& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:OpenLogReplicator.pb.Lob)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Lob::IsInitialized() const {
+  return true;
+}
+
+void Lob::InternalSwap(Lob* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.column_, lhs_arena,
+      &other->_impl_.column_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Lob, _impl_.last_)
+      + sizeof(Lob::_impl_.last_)
+      - PROTOBUF_FIELD_OFFSET(Lob, _impl_.size_)>(
+          reinterpret_cast<char*>(&_impl_.size_),
+          reinterpret_cast<char*>(&other->_impl_.size_));
+  swap(_impl_.datum_, other->_impl_.datum_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Lob::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_OraProtoBuf_2eproto_getter, &descriptor_table_OraProtoBuf_2eproto_once,
+      file_level_metadata_OraProtoBuf_2eproto[0]);
+}
+
 // ===================================================================
 
 class Value::_Internal {
  public:
+  static const ::OpenLogReplicator::pb::Lob& value_lob(const Value* msg);
 };
 
+const ::OpenLogReplicator::pb::Lob&
+Value::_Internal::value_lob(const Value* msg) {
+  return *msg->_impl_.datum_.value_lob_;
+}
+void Value::set_allocated_value_lob(::OpenLogReplicator::pb::Lob* value_lob) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_datum();
+  if (value_lob) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(value_lob);
+    if (message_arena != submessage_arena) {
+      value_lob = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value_lob, submessage_arena);
+    }
+    set_has_value_lob();
+    _impl_.datum_.value_lob_ = value_lob;
+  }
+  // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Value.value_lob)
+}
 Value::Value(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -524,6 +1093,11 @@ Value::Value(const Value& from)
       _this->_internal_set_value_bytes(from._internal_value_bytes());
       break;
     }
+    case kValueLob: {
+      _this->_internal_mutable_value_lob()->::OpenLogReplicator::pb::Lob::MergeFrom(
+          from._internal_value_lob());
+      break;
+    }
     case DATUM_NOT_SET: {
       break;
     }
@@ -592,6 +1166,12 @@ void Value::clear_datum() {
       _impl_.datum_.value_bytes_.Destroy();
       break;
     }
+    case kValueLob: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.datum_.value_lob_;
+      }
+      break;
+    }
     case DATUM_NOT_SET: {
       break;
     }
@@ -670,6 +1250,14 @@ const char* Value::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // .OpenLogReplicator.pb.Lob value_lob = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value_lob(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -743,6 +1331,13 @@ uint8_t* Value::_InternalSerialize(
         6, this->_internal_value_bytes(), target);
   }
 
+  // .OpenLogReplicator.pb.Lob value_lob = 7;
+  if (_internal_has_value_lob()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::value_lob(this),
+        _Internal::value_lob(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -796,6 +1391,13 @@ size_t Value::ByteSizeLong() const {
           this->_internal_value_bytes());
       break;
     }
+    // .OpenLogReplicator.pb.Lob value_lob = 7;
+    case kValueLob: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.datum_.value_lob_);
+      break;
+    }
     case DATUM_NOT_SET: {
       break;
     }
@@ -842,6 +1444,11 @@ void Value::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF
       _this->_internal_set_value_bytes(from._internal_value_bytes());
       break;
     }
+    case kValueLob: {
+      _this->_internal_mutable_value_lob()->::OpenLogReplicator::pb::Lob::MergeFrom(
+          from._internal_value_lob());
+      break;
+    }
     case DATUM_NOT_SET: {
       break;
     }
@@ -876,7 +1483,7 @@ void Value::InternalSwap(Value* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata Value::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_OraProtoBuf_2eproto_getter, &descriptor_table_OraProtoBuf_2eproto_once,
-      file_level_metadata_OraProtoBuf_2eproto[0]);
+      file_level_metadata_OraProtoBuf_2eproto[1]);
 }
 
 // ===================================================================
@@ -1214,7 +1821,7 @@ void Column::InternalSwap(Column* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata Column::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_OraProtoBuf_2eproto_getter, &descriptor_table_OraProtoBuf_2eproto_once,
-      file_level_metadata_OraProtoBuf_2eproto[1]);
+      file_level_metadata_OraProtoBuf_2eproto[2]);
 }
 
 // ===================================================================
@@ -1636,7 +2243,7 @@ void Schema::InternalSwap(Schema* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata Schema::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_OraProtoBuf_2eproto_getter, &descriptor_table_OraProtoBuf_2eproto_once,
-      file_level_metadata_OraProtoBuf_2eproto[2]);
+      file_level_metadata_OraProtoBuf_2eproto[3]);
 }
 
 // ===================================================================
@@ -1644,12 +2251,17 @@ void Schema::InternalSwap(Schema* other) {
 class Payload::_Internal {
  public:
   static const ::OpenLogReplicator::pb::Schema& schema(const Payload* msg);
+  static const ::OpenLogReplicator::pb::Lob& lob(const Payload* msg);
 };
 
 const ::OpenLogReplicator::pb::Schema&
 Payload::_Internal::schema(const Payload* msg) {
   return *msg->_impl_.schema_;
 }
+const ::OpenLogReplicator::pb::Lob&
+Payload::_Internal::lob(const Payload* msg) {
+  return *msg->_impl_.lob_;
+}
 Payload::Payload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -1665,6 +2277,7 @@ Payload::Payload(const Payload& from)
     , decltype(_impl_.rid_){}
     , decltype(_impl_.ddl_){}
     , decltype(_impl_.schema_){nullptr}
+    , decltype(_impl_.lob_){nullptr}
     , decltype(_impl_.op_){}
     , decltype(_impl_.seq_){}
     , decltype(_impl_.offset_){}
@@ -1692,6 +2305,9 @@ Payload::Payload(const Payload& from)
   if (from._internal_has_schema()) {
     _this->_impl_.schema_ = new ::OpenLogReplicator::pb::Schema(*from._impl_.schema_);
   }
+  if (from._internal_has_lob()) {
+    _this->_impl_.lob_ = new ::OpenLogReplicator::pb::Lob(*from._impl_.lob_);
+  }
   ::memcpy(&_impl_.op_, &from._impl_.op_,
     static_cast<size_t>(reinterpret_cast<char*>(&_impl_.redo_) -
     reinterpret_cast<char*>(&_impl_.op_)) + sizeof(_impl_.redo_));
@@ -1708,6 +2324,7 @@ inline void Payload::SharedCtor(
     , decltype(_impl_.rid_){}
     , decltype(_impl_.ddl_){}
     , decltype(_impl_.schema_){nullptr}
+    , decltype(_impl_.lob_){nullptr}
     , decltype(_impl_.op_){0}
     , decltype(_impl_.seq_){0u}
     , decltype(_impl_.offset_){uint64_t{0u}}
@@ -1741,6 +2358,7 @@ inline void Payload::SharedDtor() {
   _impl_.rid_.Destroy();
   _impl_.ddl_.Destroy();
   if (this != internal_default_instance()) delete _impl_.schema_;
+  if (this != internal_default_instance()) delete _impl_.lob_;
 }
 
 void Payload::SetCachedSize(int size) const {
@@ -1761,6 +2379,10 @@ void Payload::Clear() {
     delete _impl_.schema_;
   }
   _impl_.schema_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.lob_ != nullptr) {
+    delete _impl_.lob_;
+  }
+  _impl_.lob_ = nullptr;
   ::memset(&_impl_.op_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&_impl_.redo_) -
       reinterpret_cast<char*>(&_impl_.op_)) + sizeof(_impl_.redo_));
@@ -1868,6 +2490,14 @@ const char* Payload::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
         } else
           goto handle_unusual;
         continue;
+      // .OpenLogReplicator.pb.Lob lob = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_lob(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1971,6 +2601,13 @@ uint8_t* Payload::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_num(), target);
   }
 
+  // .OpenLogReplicator.pb.Lob lob = 11;
+  if (this->_internal_has_lob()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::lob(this),
+        _Internal::lob(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2022,6 +2659,13 @@ size_t Payload::ByteSizeLong() const {
         *_impl_.schema_);
   }
 
+  // .OpenLogReplicator.pb.Lob lob = 11;
+  if (this->_internal_has_lob()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.lob_);
+  }
+
   // .OpenLogReplicator.pb.Op op = 1;
   if (this->_internal_op() != 0) {
     total_size += 1 +
@@ -2078,6 +2722,10 @@ void Payload::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOB
     _this->_internal_mutable_schema()->::OpenLogReplicator::pb::Schema::MergeFrom(
         from._internal_schema());
   }
+  if (from._internal_has_lob()) {
+    _this->_internal_mutable_lob()->::OpenLogReplicator::pb::Lob::MergeFrom(
+        from._internal_lob());
+  }
   if (from._internal_op() != 0) {
     _this->_internal_set_op(from._internal_op());
   }
@@ -2133,7 +2781,7 @@ void Payload::InternalSwap(Payload* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata Payload::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_OraProtoBuf_2eproto_getter, &descriptor_table_OraProtoBuf_2eproto_once,
-      file_level_metadata_OraProtoBuf_2eproto[3]);
+      file_level_metadata_OraProtoBuf_2eproto[4]);
 }
 
 // ===================================================================
@@ -2386,7 +3034,7 @@ void SchemaRequest::InternalSwap(SchemaRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SchemaRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_OraProtoBuf_2eproto_getter, &descriptor_table_OraProtoBuf_2eproto_once,
-      file_level_metadata_OraProtoBuf_2eproto[4]);
+      file_level_metadata_OraProtoBuf_2eproto[5]);
 }
 
 // ===================================================================
@@ -2903,7 +3551,7 @@ void RedoRequest::InternalSwap(RedoRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata RedoRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_OraProtoBuf_2eproto_getter, &descriptor_table_OraProtoBuf_2eproto_once,
-      file_level_metadata_OraProtoBuf_2eproto[5]);
+      file_level_metadata_OraProtoBuf_2eproto[6]);
 }
 
 // ===================================================================
@@ -2917,7 +3565,7 @@ void RedoResponse_AttributesEntry_DoNotUse::MergeFrom(const RedoResponse_Attribu
 ::PROTOBUF_NAMESPACE_ID::Metadata RedoResponse_AttributesEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_OraProtoBuf_2eproto_getter, &descriptor_table_OraProtoBuf_2eproto_once,
-      file_level_metadata_OraProtoBuf_2eproto[6]);
+      file_level_metadata_OraProtoBuf_2eproto[7]);
 }
 
 // ===================================================================
@@ -3627,13 +4275,17 @@ void RedoResponse::InternalSwap(RedoResponse* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata RedoResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_OraProtoBuf_2eproto_getter, &descriptor_table_OraProtoBuf_2eproto_once,
-      file_level_metadata_OraProtoBuf_2eproto[7]);
+      file_level_metadata_OraProtoBuf_2eproto[8]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace pb
 }  // namespace OpenLogReplicator
 PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::OpenLogReplicator::pb::Lob*
+Arena::CreateMaybeMessage< ::OpenLogReplicator::pb::Lob >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::OpenLogReplicator::pb::Lob >(arena);
+}
 template<> PROTOBUF_NOINLINE ::OpenLogReplicator::pb::Value*
 Arena::CreateMaybeMessage< ::OpenLogReplicator::pb::Value >(Arena* arena) {
   return Arena::CreateMessageInternal< ::OpenLogReplicator::pb::Value >(arena);
@@ -53,6 +53,9 @@ namespace pb {
 class Column;
 struct ColumnDefaultTypeInternal;
 extern ColumnDefaultTypeInternal _Column_default_instance_;
+class Lob;
+struct LobDefaultTypeInternal;
+extern LobDefaultTypeInternal _Lob_default_instance_;
 class Payload;
 struct PayloadDefaultTypeInternal;
 extern PayloadDefaultTypeInternal _Payload_default_instance_;
@@ -78,6 +81,7 @@ extern ValueDefaultTypeInternal _Value_default_instance_;
 }  // namespace OpenLogReplicator
 PROTOBUF_NAMESPACE_OPEN
 template<> ::OpenLogReplicator::pb::Column* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::Column>(Arena*);
+template<> ::OpenLogReplicator::pb::Lob* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::Lob>(Arena*);
 template<> ::OpenLogReplicator::pb::Payload* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::Payload>(Arena*);
 template<> ::OpenLogReplicator::pb::RedoRequest* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::RedoRequest>(Arena*);
 template<> ::OpenLogReplicator::pb::RedoResponse* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::RedoResponse>(Arena*);
@@ -97,12 +101,15 @@ enum Op : int {
   DELETE = 4,
   DDL = 5,
   CHKPT = 6,
+  PROVISIONAL = 7,
+  ROLLBACK = 8,
+  LOB = 9,
   Op_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
   Op_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Op_IsValid(int value);
 constexpr Op Op_MIN = BEGIN;
-constexpr Op Op_MAX = CHKPT;
+constexpr Op Op_MAX = LOB;
 constexpr int Op_ARRAYSIZE = Op_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Op_descriptor();
@@ -220,6 +227,289 @@ inline bool ResponseCode_Parse(
 }
 // ===================================================================
 
+class Lob final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OpenLogReplicator.pb.Lob) */ {
+ public:
+  inline Lob() : Lob(nullptr) {}
+  ~Lob() override;
+  explicit PROTOBUF_CONSTEXPR Lob(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Lob(const Lob& from);
+  Lob(Lob&& from) noexcept
+    : Lob() {
+    *this = ::std::move(from);
+  }
+
+  inline Lob& operator=(const Lob& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Lob& operator=(Lob&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Lob& default_instance() {
+    return *internal_default_instance();
+  }
+  enum DatumCase {
+    kValueString = 8,
+    kValueBytes = 9,
+    DATUM_NOT_SET = 0,
+  };
+
+  static inline const Lob* internal_default_instance() {
+    return reinterpret_cast<const Lob*>(
+               &_Lob_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Lob& a, Lob& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Lob* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Lob* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Lob* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Lob>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Lob& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Lob& from) {
+    Lob::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Lob* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "OpenLogReplicator.pb.Lob";
+  }
+  protected:
+  explicit Lob(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kColumnFieldNumber = 2,
+    kSizeFieldNumber = 3,
+    kChunksFieldNumber = 4,
+    kChunkFieldNumber = 5,
+    kOffsetFieldNumber = 6,
+    kLastFieldNumber = 7,
+    kValueStringFieldNumber = 8,
+    kValueBytesFieldNumber = 9,
+  };
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string column = 2;
+  void clear_column();
+  const std::string& column() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_column(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_column();
+  PROTOBUF_NODISCARD std::string* release_column();
+  void set_allocated_column(std::string* column);
+  private:
+  const std::string& _internal_column() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_column(const std::string& value);
+  std::string* _internal_mutable_column();
+  public:
+
+  // uint64 size = 3;
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // uint64 chunks = 4;
+  void clear_chunks();
+  uint64_t chunks() const;
+  void set_chunks(uint64_t value);
+  private:
+  uint64_t _internal_chunks() const;
+  void _internal_set_chunks(uint64_t value);
+  public:
+
+  // uint64 chunk = 5;
+  void clear_chunk();
+  uint64_t chunk() const;
+  void set_chunk(uint64_t value);
+  private:
+  uint64_t _internal_chunk() const;
+  void _internal_set_chunk(uint64_t value);
+  public:
+
+  // uint64 offset = 6;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // bool last = 7;
+  void clear_last();
+  bool last() const;
+  void set_last(bool value);
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+  public:
+
+  // string value_string = 8;
+  bool has_value_string() const;
+  private:
+  bool _internal_has_value_string() const;
+  public:
+  void clear_value_string();
+  const std::string& value_string() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value_string(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value_string();
+  PROTOBUF_NODISCARD std::string* release_value_string();
+  void set_allocated_value_string(std::string* value_string);
+  private:
+  const std::string& _internal_value_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value_string(const std::string& value);
+  std::string* _internal_mutable_value_string();
+  public:
+
+  // bytes value_bytes = 9;
+  bool has_value_bytes() const;
+  private:
+  bool _internal_has_value_bytes() const;
+  public:
+  void clear_value_bytes();
+  const std::string& value_bytes() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value_bytes(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value_bytes();
+  PROTOBUF_NODISCARD std::string* release_value_bytes();
+  void set_allocated_value_bytes(std::string* value_bytes);
+  private:
+  const std::string& _internal_value_bytes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value_bytes(const std::string& value);
+  std::string* _internal_mutable_value_bytes();
+  public:
+
+  void clear_datum();
+  DatumCase datum_case() const;
+  // @@protoc_insertion_point(class_scope:OpenLogReplicator.pb.Lob)
+ private:
+  class _Internal;
+  void set_has_value_string();
+  void set_has_value_bytes();
+
+  inline bool has_datum() const;
+  inline void clear_has_datum();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr column_;
+    uint64_t size_;
+    uint64_t chunks_;
+    uint64_t chunk_;
+    uint64_t offset_;
+    bool last_;
+    union DatumUnion {
+      constexpr DatumUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_string_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_bytes_;
+    } datum_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_OraProtoBuf_2eproto;
+};
+// -------------------------------------------------------------------
+
 class Value final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OpenLogReplicator.pb.Value) */ {
  public:
@@ -269,6 +559,7 @@ class Value final :
     kValueDouble = 4,
     kValueString = 5,
     kValueBytes = 6,
+    kValueLob = 7,
     DATUM_NOT_SET = 0,
   };
 
@@ -277,7 +568,7 @@ class Value final :
                &_Value_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    1;
 
   friend void swap(Value& a, Value& b) {
     a.Swap(&b);
@@ -356,6 +647,7 @@ class Value final :
     kValueDoubleFieldNumber = 4,
     kValueStringFieldNumber = 5,
     kValueBytesFieldNumber = 6,
+    kValueLobFieldNumber = 7,
   };
   // string name = 1;
   void clear_name();
@@ -446,6 +738,24 @@ class Value final :
   std::string* _internal_mutable_value_bytes();
   public:
 
+  // .OpenLogReplicator.pb.Lob value_lob = 7;
+  bool has_value_lob() const;
+  private:
+  bool _internal_has_value_lob() const;
+  public:
+  void clear_value_lob();
+  const ::OpenLogReplicator::pb::Lob& value_lob() const;
+  PROTOBUF_NODISCARD ::OpenLogReplicator::pb::Lob* release_value_lob();
+  ::OpenLogReplicator::pb::Lob* mutable_value_lob();
+  void set_allocated_value_lob(::OpenLogReplicator::pb::Lob* value_lob);
+  private:
+  const ::OpenLogReplicator::pb::Lob& _internal_value_lob() const;
+  ::OpenLogReplicator::pb::Lob* _internal_mutable_value_lob();
+  public:
+  void unsafe_arena_set_allocated_value_lob(
+      ::OpenLogReplicator::pb::Lob* value_lob);
+  ::OpenLogReplicator::pb::Lob* unsafe_arena_release_value_lob();
+
   void clear_datum();
   DatumCase datum_case() const;
   // @@protoc_insertion_point(class_scope:OpenLogReplicator.pb.Value)
@@ -456,6 +766,7 @@ class Value final :
   void set_has_value_double();
   void set_has_value_string();
   void set_has_value_bytes();
+  void set_has_value_lob();
 
   inline bool has_datum() const;
   inline void clear_has_datum();
@@ -473,6 +784,7 @@ class Value final :
       double value_double_;
       ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_string_;
       ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_bytes_;
+      ::OpenLogReplicator::pb::Lob* value_lob_;
     } datum_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     uint32_t _oneof_case_[1];
@@ -531,7 +843,7 @@ class Column final :
                &_Column_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
   friend void swap(Column& a, Column& b) {
     a.Swap(&b);
@@ -745,7 +1057,7 @@ class Schema final :
                &_Schema_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(Schema& a, Schema& b) {
     a.Swap(&b);
@@ -993,7 +1305,7 @@ class Payload final :
                &_Payload_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(Payload& a, Payload& b) {
     a.Swap(&b);
@@ -1071,6 +1383,7 @@ class Payload final :
     kRidFieldNumber = 3,
     kDdlFieldNumber = 6,
     kSchemaFieldNumber = 2,
+    kLobFieldNumber = 11,
     kOpFieldNumber = 1,
     kSeqFieldNumber = 7,
     kOffsetFieldNumber = 8,
@@ -1159,6 +1472,24 @@ class Payload final :
       ::OpenLogReplicator::pb::Schema* schema);
   ::OpenLogReplicator::pb::Schema* unsafe_arena_release_schema();
 
+  // .OpenLogReplicator.pb.Lob lob = 11;
+  bool has_lob() const;
+  private:
+  bool _internal_has_lob() const;
+  public:
+  void clear_lob();
+  const ::OpenLogReplicator::pb::Lob& lob() const;
+  PROTOBUF_NODISCARD ::OpenLogReplicator::pb::Lob* release_lob();
+  ::OpenLogReplicator::pb::Lob* mutable_lob();
+  void set_allocated_lob(::OpenLogReplicator::pb::Lob* lob);
+  private:
+  const ::OpenLogReplicator::pb::Lob& _internal_lob() const;
+  ::OpenLogReplicator::pb::Lob* _internal_mutable_lob();
+  public:
+  void unsafe_arena_set_allocated_lob(
+      ::OpenLogReplicator::pb::Lob* lob);
+  ::OpenLogReplicator::pb::Lob* unsafe_arena_release_lob();
+
   // .OpenLogReplicator.pb.Op op = 1;
   void clear_op();
   ::OpenLogReplicator::pb::Op op() const;
@@ -1217,6 +1548,7 @@ class Payload final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ddl_;
     ::OpenLogReplicator::pb::Schema* schema_;
+    ::OpenLogReplicator::pb::Lob* lob_;
     int op_;
     uint32_t seq_;
     uint64_t offset_;
@@ -1277,7 +1609,7 @@ class SchemaRequest final :
                &_SchemaRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(SchemaRequest& a, SchemaRequest& b) {
     a.Swap(&b);
@@ -1453,7 +1785,7 @@ class RedoRequest final :
                &_RedoRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
   friend void swap(RedoRequest& a, RedoRequest& b) {
     a.Swap(&b);
@@ -1793,7 +2125,7 @@ class RedoResponse final :
                &_RedoResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
   friend void swap(RedoResponse& a, RedoResponse& b) {
     a.Swap(&b);
@@ -2124,6 +2456,373 @@ class RedoResponse final :
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
+// Lob
+
+// string id = 1;
+inline void Lob::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& Lob::id() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Lob.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Lob::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Lob.id)
+}
+inline std::string* Lob::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Lob.id)
+  return _s;
+}
+inline const std::string& Lob::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void Lob::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Lob::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Lob::release_id() {
+  // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Lob.id)
+  return _impl_.id_.Release();
+}
+inline void Lob::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Lob.id)
+}
+
+// string column = 2;
+inline void Lob::clear_column() {
+  _impl_.column_.ClearToEmpty();
+}
+inline const std::string& Lob::column() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Lob.column)
+  return _internal_column();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Lob::set_column(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.column_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Lob.column)
+}
+inline std::string* Lob::mutable_column() {
+  std::string* _s = _internal_mutable_column();
+  // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Lob.column)
+  return _s;
+}
+inline const std::string& Lob::_internal_column() const {
+  return _impl_.column_.Get();
+}
+inline void Lob::_internal_set_column(const std::string& value) {
+  
+  _impl_.column_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Lob::_internal_mutable_column() {
+  
+  return _impl_.column_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Lob::release_column() {
+  // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Lob.column)
+  return _impl_.column_.Release();
+}
+inline void Lob::set_allocated_column(std::string* column) {
+  if (column != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.column_.SetAllocated(column, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.column_.IsDefault()) {
+    _impl_.column_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Lob.column)
+}
+
+// uint64 size = 3;
+inline void Lob::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t Lob::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t Lob::size() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Lob.size)
+  return _internal_size();
+}
+inline void Lob::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void Lob::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Lob.size)
+}
+
+// uint64 chunks = 4;
+inline void Lob::clear_chunks() {
+  _impl_.chunks_ = uint64_t{0u};
+}
+inline uint64_t Lob::_internal_chunks() const {
+  return _impl_.chunks_;
+}
+inline uint64_t Lob::chunks() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Lob.chunks)
+  return _internal_chunks();
+}
+inline void Lob::_internal_set_chunks(uint64_t value) {
+  
+  _impl_.chunks_ = value;
+}
+inline void Lob::set_chunks(uint64_t value) {
+  _internal_set_chunks(value);
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Lob.chunks)
+}
+
+// uint64 chunk = 5;
+inline void Lob::clear_chunk() {
+  _impl_.chunk_ = uint64_t{0u};
+}
+inline uint64_t Lob::_internal_chunk() const {
+  return _impl_.chunk_;
+}
+inline uint64_t Lob::chunk() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Lob.chunk)
+  return _internal_chunk();
+}
+inline void Lob::_internal_set_chunk(uint64_t value) {
+  
+  _impl_.chunk_ = value;
+}
+inline void Lob::set_chunk(uint64_t value) {
+  _internal_set_chunk(value);
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Lob.chunk)
+}
+
+// uint64 offset = 6;
+inline void Lob::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t Lob::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t Lob::offset() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Lob.offset)
+  return _internal_offset();
+}
+inline void Lob::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void Lob::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Lob.offset)
+}
+
+// bool last = 7;
+inline void Lob::clear_last() {
+  _impl_.last_ = false;
+}
+inline bool Lob::_internal_last() const {
+  return _impl_.last_;
+}
+inline bool Lob::last() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Lob.last)
+  return _internal_last();
+}
+inline void Lob::_internal_set_last(bool value) {
+  
+  _impl_.last_ = value;
+}
+inline void Lob::set_last(bool value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Lob.last)
+}
+
+// string value_string = 8;
+inline bool Lob::_internal_has_value_string() const {
+  return datum_case() == kValueString;
+}
+inline bool Lob::has_value_string() const {
+  return _internal_has_value_string();
+}
+inline void Lob::set_has_value_string() {
+  _impl_._oneof_case_[0] = kValueString;
+}
+inline void Lob::clear_value_string() {
+  if (_internal_has_value_string()) {
+    _impl_.datum_.value_string_.Destroy();
+    clear_has_datum();
+  }
+}
+inline const std::string& Lob::value_string() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Lob.value_string)
+  return _internal_value_string();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Lob::set_value_string(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_value_string()) {
+    clear_datum();
+    set_has_value_string();
+    _impl_.datum_.value_string_.InitDefault();
+  }
+  _impl_.datum_.value_string_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Lob.value_string)
+}
+inline std::string* Lob::mutable_value_string() {
+  std::string* _s = _internal_mutable_value_string();
+  // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Lob.value_string)
+  return _s;
+}
+inline const std::string& Lob::_internal_value_string() const {
+  if (_internal_has_value_string()) {
+    return _impl_.datum_.value_string_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Lob::_internal_set_value_string(const std::string& value) {
+  if (!_internal_has_value_string()) {
+    clear_datum();
+    set_has_value_string();
+    _impl_.datum_.value_string_.InitDefault();
+  }
+  _impl_.datum_.value_string_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Lob::_internal_mutable_value_string() {
+  if (!_internal_has_value_string()) {
+    clear_datum();
+    set_has_value_string();
+    _impl_.datum_.value_string_.InitDefault();
+  }
+  return _impl_.datum_.value_string_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Lob::release_value_string() {
+  // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Lob.value_string)
+  if (_internal_has_value_string()) {
+    clear_has_datum();
+    return _impl_.datum_.value_string_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Lob::set_allocated_value_string(std::string* value_string) {
+  if (has_datum()) {
+    clear_datum();
+  }
+  if (value_string != nullptr) {
+    set_has_value_string();
+    _impl_.datum_.value_string_.InitAllocated(value_string, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Lob.value_string)
+}
+
+// bytes value_bytes = 9;
+inline bool Lob::_internal_has_value_bytes() const {
+  return datum_case() == kValueBytes;
+}
+inline bool Lob::has_value_bytes() const {
+  return _internal_has_value_bytes();
+}
+inline void Lob::set_has_value_bytes() {
+  _impl_._oneof_case_[0] = kValueBytes;
+}
+inline void Lob::clear_value_bytes() {
+  if (_internal_has_value_bytes()) {
+    _impl_.datum_.value_bytes_.Destroy();
+    clear_has_datum();
+  }
+}
+inline const std::string& Lob::value_bytes() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Lob.value_bytes)
+  return _internal_value_bytes();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Lob::set_value_bytes(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_value_bytes()) {
+    clear_datum();
+    set_has_value_bytes();
+    _impl_.datum_.value_bytes_.InitDefault();
+  }
+  _impl_.datum_.value_bytes_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Lob.value_bytes)
+}
+inline std::string* Lob::mutable_value_bytes() {
+  std::string* _s = _internal_mutable_value_bytes();
+  // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Lob.value_bytes)
+  return _s;
+}
+inline const std::string& Lob::_internal_value_bytes() const {
+  if (_internal_has_value_bytes()) {
+    return _impl_.datum_.value_bytes_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Lob::_internal_set_value_bytes(const std::string& value) {
+  if (!_internal_has_value_bytes()) {
+    clear_datum();
+    set_has_value_bytes();
+    _impl_.datum_.value_bytes_.InitDefault();
+  }
+  _impl_.datum_.value_bytes_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Lob::_internal_mutable_value_bytes() {
+  if (!_internal_has_value_bytes()) {
+    clear_datum();
+    set_has_value_bytes();
+    _impl_.datum_.value_bytes_.InitDefault();
+  }
+  return _impl_.datum_.value_bytes_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Lob::release_value_bytes() {
+  // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Lob.value_bytes)
+  if (_internal_has_value_bytes()) {
+    clear_has_datum();
+    return _impl_.datum_.value_bytes_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Lob::set_allocated_value_bytes(std::string* value_bytes) {
+  if (has_datum()) {
+    clear_datum();
+  }
+  if (value_bytes != nullptr) {
+    set_has_value_bytes();
+    _impl_.datum_.value_bytes_.InitAllocated(value_bytes, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Lob.value_bytes)
+}
+
+inline bool Lob::has_datum() const {
+  return datum_case() != DATUM_NOT_SET;
+}
+inline void Lob::clear_has_datum() {
+  _impl_._oneof_case_[0] = DATUM_NOT_SET;
+}
+inline Lob::DatumCase Lob::datum_case() const {
+  return Lob::DatumCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
 // Value
 
 // string name = 1;
@@ -2444,6 +3143,80 @@ inline void Value::set_allocated_value_bytes(std::string* value_bytes) {
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Value.value_bytes)
 }
 
+// .OpenLogReplicator.pb.Lob value_lob = 7;
+inline bool Value::_internal_has_value_lob() const {
+  return datum_case() == kValueLob;
+}
+inline bool Value::has_value_lob() const {
+  return _internal_has_value_lob();
+}
+inline void Value::set_has_value_lob() {
+  _impl_._oneof_case_[0] = kValueLob;
+}
+inline void Value::clear_value_lob() {
+  if (_internal_has_value_lob()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.datum_.value_lob_;
+    }
+    clear_has_datum();
+  }
+}
+inline ::OpenLogReplicator::pb::Lob* Value::release_value_lob() {
+  // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Value.value_lob)
+  if (_internal_has_value_lob()) {
+    clear_has_datum();
+    ::OpenLogReplicator::pb::Lob* temp = _impl_.datum_.value_lob_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.datum_.value_lob_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::OpenLogReplicator::pb::Lob& Value::_internal_value_lob() const {
+  return _internal_has_value_lob()
+      ? *_impl_.datum_.value_lob_
+      : reinterpret_cast< ::OpenLogReplicator::pb::Lob&>(::OpenLogReplicator::pb::_Lob_default_instance_);
+}
+inline const ::OpenLogReplicator::pb::Lob& Value::value_lob() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Value.value_lob)
+  return _internal_value_lob();
+}
+inline ::OpenLogReplicator::pb::Lob* Value::unsafe_arena_release_value_lob() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:OpenLogReplicator.pb.Value.value_lob)
+  if (_internal_has_value_lob()) {
+    clear_has_datum();
+    ::OpenLogReplicator::pb::Lob* temp = _impl_.datum_.value_lob_;
+    _impl_.datum_.value_lob_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Value::unsafe_arena_set_allocated_value_lob(::OpenLogReplicator::pb::Lob* value_lob) {
+  clear_datum();
+  if (value_lob) {
+    set_has_value_lob();
+    _impl_.datum_.value_lob_ = value_lob;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:OpenLogReplicator.pb.Value.value_lob)
+}
+inline ::OpenLogReplicator::pb::Lob* Value::_internal_mutable_value_lob() {
+  if (!_internal_has_value_lob()) {
+    clear_datum();
+    set_has_value_lob();
+    _impl_.datum_.value_lob_ = CreateMaybeMessage< ::OpenLogReplicator::pb::Lob >(GetArenaForAllocation());
+  }
+  return _impl_.datum_.value_lob_;
+}
+inline ::OpenLogReplicator::pb::Lob* Value::mutable_value_lob() {
+  ::OpenLogReplicator::pb::Lob* _msg = _internal_mutable_value_lob();
+  // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Value.value_lob)
+  return _msg;
+}
+
 inline bool Value::has_datum() const {
   return datum_case() != DATUM_NOT_SET;
 }
@@ -3269,6 +4042,96 @@ inline void Payload::set_num(uint64_t value) {
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Payload.num)
 }
 
+// .OpenLogReplicator.pb.Lob lob = 11;
+inline bool Payload::_internal_has_lob() const {
+  return this != internal_default_instance() && _impl_.lob_ != nullptr;
+}
+inline bool Payload::has_lob() const {
+  return _internal_has_lob();
+}
+inline void Payload::clear_lob() {
+  if (GetArenaForAllocation() == nullptr && _impl_.lob_ != nullptr) {
+    delete _impl_.lob_;
+  }
+  _impl_.lob_ = nullptr;
+}
+inline const ::OpenLogReplicator::pb::Lob& Payload::_internal_lob() const {
+  const ::OpenLogReplicator::pb::Lob* p = _impl_.lob_;
+  return p != nullptr ? *p : reinterpret_cast<const ::OpenLogReplicator::pb::Lob&>(
+      ::OpenLogReplicator::pb::_Lob_default_instance_);
+}
+inline const ::OpenLogReplicator::pb::Lob& Payload::lob() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.lob)
+  return _internal_lob();
+}
+inline void Payload::unsafe_arena_set_allocated_lob(
+    ::OpenLogReplicator::pb::Lob* lob) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lob_);
+  }
+  _impl_.lob_ = lob;
+  if (lob) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:OpenLogReplicator.pb.Payload.lob)
+}
+inline ::OpenLogReplicator::pb::Lob* Payload::release_lob() {
+  
+  ::OpenLogReplicator::pb::Lob* temp = _impl_.lob_;
+  _impl_.lob_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::OpenLogReplicator::pb::Lob* Payload::unsafe_arena_release_lob() {
+  // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Payload.lob)
+  
+  ::OpenLogReplicator::pb::Lob* temp = _impl_.lob_;
+  _impl_.lob_ = nullptr;
+  return temp;
+}
+inline ::OpenLogReplicator::pb::Lob* Payload::_internal_mutable_lob() {
+  
+  if (_impl_.lob_ == nullptr) {
+    auto* p = CreateMaybeMessage<::OpenLogReplicator::pb::Lob>(GetArenaForAllocation());
+    _impl_.lob_ = p;
+  }
+  return _impl_.lob_;
+}
+inline ::OpenLogReplicator::pb::Lob* Payload::mutable_lob() {
+  ::OpenLogReplicator::pb::Lob* _msg = _internal_mutable_lob();
+  // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Payload.lob)
+  return _msg;
+}
+inline void Payload::set_allocated_lob(::OpenLogReplicator::pb::Lob* lob) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.lob_;
+  }
+  if (lob) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lob);
+    if (message_arena != submessage_arena) {
+      lob = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lob, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.lob_ = lob;
+  // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Payload.lob)
+}
+
 // -------------------------------------------------------------------
 
 // SchemaRequest
@@ -4307,6 +5170,8 @@ inline RedoResponse::XidValCase RedoResponse::xid_val_case() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
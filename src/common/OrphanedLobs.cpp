@@ -0,0 +1,202 @@
+/* Store for LOB pages not matched to a transaction yet
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <cstring>
+#include <iterator>
+
+#include "Ctx.h"
+#include "OrphanedLobs.h"
+#include "RedoLogRecord.h"
+#include "Thread.h"
+#include "exception/RedoLogException.h"
+
+namespace OpenLogReplicator {
+    OrphanedLobs::OrphanedLobs(Ctx* newCtx) :
+            ctx(newCtx) {
+    }
+
+    OrphanedLobs::~OrphanedLobs() {
+        lobs.clear();
+        for (const auto& [_, chunk]: chunks)
+            ctx->freeMemoryChunk(ctx->parserThread, Ctx::MEMORY::LOBS, chunk.data);
+        chunks.clear();
+    }
+
+    void OrphanedLobs::releasePage(const OrphanedPage& orphanedPage) {
+        auto chunksIt = chunks.find(orphanedPage.chunkId);
+        if (chunksIt != chunks.end())
+            --chunksIt->second.pages;
+        --pages;
+    }
+
+    void OrphanedLobs::releaseChunks(Thread* t) {
+        std::vector<uint8_t*> released;
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::ORPHANED_LOBS);
+            std::unique_lock<std::mutex> const lck(mtx);
+            // The last chunk is kept for the next pages
+            for (auto chunksIt = chunks.begin(); chunksIt != chunks.end() && chunksIt->first + 1 != chunkIdNext;) {
+                if (chunksIt->second.pages == 0) {
+                    released.push_back(chunksIt->second.data);
+                    chunksIt = chunks.erase(chunksIt);
+                } else
+                    ++chunksIt;
+            }
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+
+        for (uint8_t* data: released)
+            ctx->freeMemoryChunk(t, Ctx::MEMORY::LOBS, data);
+    }
+
+    void OrphanedLobs::add(Thread* t, const RedoLogRecord* redoLogRecord1) {
+        const typeTransactionSize lobSize = redoLogRecord1->size + sizeof(RedoLogRecord) + sizeof(typeTransactionSize);
+        const uint64_t alignedSize = (lobSize + 7) & 0xFFFFFFFFFFFFFFF8;
+        if (unlikely(alignedSize > Ctx::MEMORY_CHUNK_SIZE))
+            throw RedoLogException(50075, "orphaned lob: " + redoLogRecord1->lobId.lower() + ", page: " + std::to_string(redoLogRecord1->dba) +
+                                          " size: " + std::to_string(lobSize) + " exceeds memory chunk size, offset: " +
+                                          redoLogRecord1->fileOffset.toString());
+
+        bool newChunk;
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::ORPHANED_LOBS);
+            std::unique_lock<std::mutex> const lck(mtx);
+            auto lobsIt = lobs.find(redoLogRecord1->lobId);
+            if (lobsIt != lobs.end()) {
+                for (const OrphanedPage& orphanedPage: lobsIt->second) {
+                    if (orphanedPage.page == redoLogRecord1->dba) {
+                        t->contextSet(Thread::CONTEXT::CPU);
+                        ctx->warning(60009, "duplicate orphaned lob: " + redoLogRecord1->lobId.lower() + ", page: " +
+                                            std::to_string(redoLogRecord1->dba));
+                        return;
+                    }
+                }
+            }
+            newChunk = chunks.empty() || chunks.rbegin()->second.size + alignedSize > Ctx::MEMORY_CHUNK_SIZE;
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+
+        // Only this thread adds chunks, memory is allocated without holding the lock
+        uint8_t* chunkData = nullptr;
+        if (newChunk)
+            chunkData = ctx->getMemoryChunk(t, Ctx::MEMORY::LOBS);
+
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::ORPHANED_LOBS);
+            std::unique_lock<std::mutex> const lck(mtx);
+            if (newChunk)
+                chunks.insert_or_assign(chunkIdNext++, OrphanedChunk{chunkData, 0, 0});
+
+            auto& [chunkId, chunk] = *chunks.rbegin();
+            uint8_t* data = chunk.data + chunk.size;
+            *reinterpret_cast<typeTransactionSize*>(data) = lobSize;
+            memcpy(reinterpret_cast<void*>(data + sizeof(typeTransactionSize)),
+                   reinterpret_cast<const void*>(redoLogRecord1), sizeof(RedoLogRecord));
+            memcpy(reinterpret_cast<void*>(data + sizeof(typeTransactionSize) + sizeof(RedoLogRecord)),
+                   reinterpret_cast<const void*>(redoLogRecord1->data()), redoLogRecord1->size);
+            auto* redoLogRecord1new = reinterpret_cast<RedoLogRecord*>(data + sizeof(typeTransactionSize));
+            redoLogRecord1new->dataExt = data + sizeof(typeTransactionSize) + sizeof(RedoLogRecord);
+
+            chunk.size += alignedSize;
+            ++chunk.pages;
+            ++pages;
+            lobs[redoLogRecord1->lobId].push_back({redoLogRecord1->dba, chunkId, data});
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void OrphanedLobs::adopt(const LobId& lobId, std::vector<std::pair<typeDba, uint8_t*>>& adopted) {
+        std::unique_lock<std::mutex> const lck(mtx);
+        auto lobsIt = lobs.find(lobId);
+        if (lobsIt == lobs.end())
+            return;
+
+        // The transaction owns a private copy, the chunk space is reclaimed by the parser
+        for (const OrphanedPage& orphanedPage: lobsIt->second) {
+            const typeTransactionSize lobSize = *reinterpret_cast<const typeTransactionSize*>(orphanedPage.data);
+            auto* data = new uint8_t[lobSize];
+            memcpy(reinterpret_cast<void*>(data), reinterpret_cast<const void*>(orphanedPage.data), lobSize);
+            auto* redoLogRecord1new = reinterpret_cast<RedoLogRecord*>(data + sizeof(typeTransactionSize));
+            redoLogRecord1new->dataExt = data + sizeof(typeTransactionSize) + sizeof(RedoLogRecord);
+
+            adopted.emplace_back(orphanedPage.page, data);
+            releasePage(orphanedPage);
+        }
+        lobs.erase(lobsIt);
+    }
+
+    void OrphanedLobs::evict(Thread* t) {
+        // A page may belong to a transaction which begins later, so it is kept until adopted.
+        // Only when the pages use too much memory, the oldest chunks are dropped
+        releaseChunks(t);
+
+        uint64_t evicted = 0;
+        uint64_t left;
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::ORPHANED_LOBS);
+            std::unique_lock<std::mutex> const lck(mtx);
+            if (chunks.size() > ctx->memoryChunksOrphanedLobsMax) {
+                auto chunksIt = chunks.begin();
+                std::advance(chunksIt, chunks.size() - ctx->memoryChunksOrphanedLobsMax);
+                const uint64_t evictChunkId = chunksIt->first;
+
+                for (auto lobsIt = lobs.begin(); lobsIt != lobs.end();) {
+                    std::vector<OrphanedPage>& orphanedPages = lobsIt->second;
+                    for (auto pagesIt = orphanedPages.begin(); pagesIt != orphanedPages.end();) {
+                        if (pagesIt->chunkId < evictChunkId) {
+                            releasePage(*pagesIt);
+                            pagesIt = orphanedPages.erase(pagesIt);
+                            ++evicted;
+                        } else
+                            ++pagesIt;
+                    }
+
+                    if (orphanedPages.empty())
+                        lobsIt = lobs.erase(lobsIt);
+                    else
+                        ++lobsIt;
+                }
+            }
+            left = pages;
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+
+        if (evicted > 0) {
+            ctx->warning(60039, "orphaned lob pages exceed memory limit, dropped pages: " + std::to_string(evicted) + ", left: " + std::to_string(left));
+            releaseChunks(t);
+        }
+    }
+
+    void OrphanedLobs::purge(Thread* t) {
+        std::vector<uint8_t*> released;
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::ORPHANED_LOBS);
+            std::unique_lock<std::mutex> const lck(mtx);
+            lobs.clear();
+            for (const auto& [_, chunk]: chunks)
+                released.push_back(chunk.data);
+            chunks.clear();
+            pages = 0;
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+
+        for (uint8_t* data: released)
+            ctx->freeMemoryChunk(t, Ctx::MEMORY::LOBS, data);
+    }
+}
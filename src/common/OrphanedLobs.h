@@ -0,0 +1,74 @@
+/* Header for OrphanedLobs class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef ORPHANED_LOBS_H_
+#define ORPHANED_LOBS_H_
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types/LobId.h"
+#include "types/Types.h"
+
+namespace OpenLogReplicator {
+    class Ctx;
+    class RedoLogRecord;
+    class Thread;
+
+    // LOB pages which arrived before the owning transaction is known
+    class OrphanedLobs final {
+    protected:
+        struct OrphanedPage {
+            typeDba page;
+            uint64_t chunkId;
+            const uint8_t* data;
+        };
+
+        struct OrphanedChunk {
+            uint8_t* data;
+            uint64_t size;
+            uint64_t pages;
+        };
+
+        Ctx* ctx;
+        std::mutex mtx;
+        std::unordered_map<LobId, std::vector<OrphanedPage>> lobs;
+        // Pages are stored one after another in memory chunks, a chunk is released when all its pages are gone
+        std::map<uint64_t, OrphanedChunk> chunks;
+        uint64_t chunkIdNext{0};
+        uint64_t pages{0};
+
+        void releasePage(const OrphanedPage& orphanedPage);
+        void releaseChunks(Thread* t);
+
+    public:
+        explicit OrphanedLobs(Ctx* newCtx);
+        ~OrphanedLobs();
+
+        void add(Thread* t, const RedoLogRecord* redoLogRecord1);
+        void adopt(const LobId& lobId, std::vector<std::pair<typeDba, uint8_t*>>& adopted);
+        void evict(Thread* t);
+        void purge(Thread* t);
+    };
+}
+
+#endif
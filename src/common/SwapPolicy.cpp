@@ -0,0 +1,37 @@
+/* Base class for swap victim selection
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+
+#include "Ctx.h"
+#include "SwapPolicy.h"
+
+namespace OpenLogReplicator {
+    SwapPolicy::SwapPolicy(Ctx* newCtx) :
+            ctx(newCtx) {
+    }
+
+    bool SwapPolicy::isSwappable(Xid xid, const SwapChunk* sc) const {
+        // The last chunk is still appended to, and transactions being flushed or shrunk would be read back at once
+        if (ctx->swappedFlushXids.find(xid) != ctx->swappedFlushXids.end() || ctx->swappedShrinkXid == xid || sc->release ||
+            sc->chunks.size() <= 1)
+            return false;
+
+        return sc->swapNext() < static_cast<int64_t>(sc->chunks.size() - 1);
+    }
+}
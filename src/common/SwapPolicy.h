@@ -0,0 +1,46 @@
+/* Header for SwapPolicy class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+
+#ifndef SWAP_POLICY_H_
+#define SWAP_POLICY_H_
+
+#include "types/Xid.h"
+
+namespace OpenLogReplicator {
+    class Ctx;
+    class SwapChunk;
+
+    class SwapPolicy {
+    protected:
+        Ctx* ctx;
+
+        [[nodiscard]] bool isSwappable(Xid xid, const SwapChunk* sc) const;
+
+    public:
+        explicit SwapPolicy(Ctx* newCtx);
+        virtual ~SwapPolicy() = default;
+
+        // Called with swapMtx held, returns nullptr when no transaction can be swapped
+        [[nodiscard]] virtual SwapChunk* selectVictim(Xid& xid) = 0;
+        [[nodiscard]] virtual const char* getName() const = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,71 @@
+/* Swap victim selection: big and cold transactions first
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+
+#include "Ctx.h"
+#include "SwapPolicyCost.h"
+
+namespace OpenLogReplicator {
+    SwapPolicyCost::SwapPolicyCost(Ctx* newCtx) :
+            SwapPolicy(newCtx),
+            lastXid(0, 0, 0) {
+    }
+
+    uint64_t SwapPolicyCost::score(const SwapChunk* sc) const {
+        // Time is measured in transaction chunks allocated, so idle and age are expressed in MB
+        const uint64_t swappable = sc->chunks.size() - 1 - sc->swapNext();
+        const uint64_t idle = ctx->swapClock - sc->touched;
+        const uint64_t age = ctx->swapClock - sc->created;
+        return (swappable * (idle + 1)) + age;
+    }
+
+    SwapChunk* SwapPolicyCost::selectVictim(Xid& xid) {
+        // Keep swapping the previous victim as long as it did not grow, to avoid spreading swap over many files
+        if (lastXid.toUint() != 0) {
+            const auto& it = ctx->swapChunks.find(lastXid);
+            if (it != ctx->swapChunks.end() && it->second->touched == lastTouched && isSwappable(lastXid, it->second)) {
+                xid = lastXid;
+                return it->second;
+            }
+        }
+
+        SwapChunk* victim = nullptr;
+        uint64_t victimScore = 0;
+        for (const auto& [swapXid, sc]: ctx->swapChunks) {
+            if (!isSwappable(swapXid, sc))
+                continue;
+
+            const uint64_t swapScore = score(sc);
+            if (victim == nullptr || swapScore > victimScore) {
+                victim = sc;
+                victimScore = swapScore;
+                xid = swapXid;
+            }
+        }
+
+        if (victim == nullptr) {
+            lastXid = 0;
+            return nullptr;
+        }
+
+        lastXid = xid;
+        lastTouched = victim->touched;
+        return victim;
+    }
+}
@@ -0,0 +1,39 @@
+/* Swap victim selection: first swappable transaction
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+
+#include "Ctx.h"
+#include "SwapPolicyOrder.h"
+
+namespace OpenLogReplicator {
+    SwapPolicyOrder::SwapPolicyOrder(Ctx* newCtx) :
+            SwapPolicy(newCtx) {
+    }
+
+    SwapChunk* SwapPolicyOrder::selectVictim(Xid& xid) {
+        for (const auto& [swapXid, sc]: ctx->swapChunks) {
+            if (!isSwappable(swapXid, sc))
+                continue;
+
+            xid = swapXid;
+            return sc;
+        }
+        return nullptr;
+    }
+}
@@ -0,0 +1,57 @@
+/* Thread reading swapped memory chunks back from disk
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include "Ctx.h"
+#include "MemoryManager.h"
+#include "SwapReader.h"
+#include "exception/RuntimeException.h"
+
+namespace OpenLogReplicator {
+    SwapReader::SwapReader(Ctx* newCtx, std::string newAlias, MemoryManager* newMemoryManager) :
+            Thread(newCtx, std::move(newAlias)),
+            memoryManager(newMemoryManager) {
+    }
+
+    void SwapReader::wakeUp() {
+        memoryManager->wakeUpIo(this);
+    }
+
+    void SwapReader::run() {
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "swap reader (" + ss.str() + ") start");
+        }
+
+        try {
+            UnswapRequest request{};
+            while (memoryManager->getUnswapRequest(this, request))
+                memoryManager->unswapPrefetched(this, request);
+        } catch (RuntimeException& ex) {
+            ctx->error(ex.code, ex.msg);
+            ctx->stopHard();
+        }
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "swap reader (" + ss.str() + ") stop");
+        }
+    }
+}
@@ -0,0 +1,45 @@
+/* Header for SwapReader class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef SWAP_READER_H_
+#define SWAP_READER_H_
+
+#include "Thread.h"
+
+namespace OpenLogReplicator {
+    class MemoryManager;
+
+    class SwapReader final : public Thread {
+    protected:
+        MemoryManager* memoryManager;
+
+    public:
+        SwapReader(Ctx* newCtx, std::string newAlias, MemoryManager* newMemoryManager);
+        ~SwapReader() override = default;
+
+        void wakeUp() override;
+        void run() override;
+
+        std::string getName() const override {
+            return {"SwapReader"};
+        }
+    };
+}
+
+#endif
@@ -56,10 +56,13 @@ namespace OpenLogReplicator {
             // MUTEX原因 - 与互斥锁相关的操作
             BUILDER_RELEASE, BUILDER_ROTATE, BUILDER_COMMIT, CHECKPOINT_RUN, // 1-4
             // ...其他互斥锁相关原因...
+            MEMORY_PREFETCH, MEMORY_SWAP_READ, SWAP_READER_WAKEUP, TRANSACTION_FLUSH, TRANSACTION_FLUSHER_WAKEUP, MEMORY_GOVERNOR_WAKEUP,
+            ORPHANED_LOBS,
             
             // SLEEP原因 - 与线程睡眠相关的操作
             CHECKPOINT_NO_WORK, MEMORY_EXHAUSTED, METADATA_WAIT_WRITER, METADATA_WAIT_FOR_REPLICATOR, READER_CHECK, // 55-59
             // ...其他睡眠相关原因...
+            SWAP_READER_NO_WORK, TRANSACTION_FLUSHER_NO_WORK, TRANSACTION_FLUSHER_PUBLISH, TRANSACTION_FLUSH_WAIT, MEMORY_GOVERNOR_NO_WORK,
             
             // 其他原因组
             OS, MEM, TRAN, CHKPT, // 67-70
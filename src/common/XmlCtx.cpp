@@ -21,6 +21,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 
 #include <utility>
 
+#include "types/Data.h"
+
 namespace OpenLogReplicator {
     XmlCtx::XmlCtx(Ctx* newCtx, std::string newTokSuf, uint64_t newFlags) :
             ctx(newCtx),
@@ -33,8 +35,120 @@ namespace OpenLogReplicator {
     }
 
     void XmlCtx::purgeDicts() noexcept {
+        tokensChanged = true;
+        qnTokens.clear();
+        qnTokensSparse.clear();
+        nmSpcTokens.clear();
+        nmSpcTokensSparse.clear();
+
         xdbXNmPack.clear(ctx);
         xdbXQnPack.clear(ctx);
         xdbXPtPack.clear(ctx);
     }
+
+    // Token ids are stored as hex strings with even number of upper case digits, as emitted by the binary XML decoder
+    bool XmlCtx::parseTokenId(const std::string& id, uint64_t& value) {
+        if (id.empty() || id.length() > 8 || (id.length() & 1) != 0)
+            return false;
+
+        value = 0;
+        for (const char c: id) {
+            if (c >= '0' && c <= '9')
+                value = (value << 4) | static_cast<uint64_t>(c - '0');
+            else if (c >= 'A' && c <= 'F')
+                value = (value << 4) | static_cast<uint64_t>(c - 'A' + 10);
+            else
+                return false;
+        }
+
+        // Non-canonical form (leading zero byte) would never match the decoded key
+        uint64_t expectedLength = 8;
+        if (value < 0x100)
+            expectedLength = 2;
+        else if (value < 0x10000)
+            expectedLength = 4;
+        else if (value < 0x1000000)
+            expectedLength = 6;
+        return id.length() == expectedLength;
+    }
+
+    std::string XmlCtx::tokenIdToString(uint64_t id) {
+        uint64_t digits = 8;
+        if (id < 0x100)
+            digits = 2;
+        else if (id < 0x10000)
+            digits = 4;
+        else if (id < 0x1000000)
+            digits = 6;
+
+        std::string str(digits, '0');
+        for (uint64_t i = 0; i < digits; ++i)
+            str[digits - 1 - i] = Data::map16U((id >> (i * 4)) & 0x0F);
+        return str;
+    }
+
+    void XmlCtx::fillToken(XmlToken& token, const XdbXQn* xdbXQn, uint64_t nmSpcId) {
+        token.valid = true;
+        token.isAttribute = !xdbXQn->flags.empty() &&
+                            (((xdbXQn->flags.back() - '0') & XdbXQn::FLAG_ISATTRIBUTE) != 0);
+        token.nmSpcId = nmSpcId;
+        token.localName = xdbXQn->localName;
+        token.tagOpen = "<" + xdbXQn->localName;
+        token.tagClose = "</" + xdbXQn->localName + ">";
+        token.attribute = " " + xdbXQn->localName + "=\"";
+    }
+
+    void XmlCtx::buildTokenCache() {
+        // The new cache is built aside, so the old one stays complete until it is swapped
+        std::vector<XmlToken> newQnTokens;
+        std::unordered_map<uint64_t, XmlToken> newQnTokensSparse;
+        std::vector<XmlNamespace> newNmSpcTokens;
+        std::unordered_map<uint64_t, XmlNamespace> newNmSpcTokensSparse;
+
+        uint64_t id;
+        uint64_t qnMax = 0;
+        for (const auto& [key, _]: xdbXQnPack.unorderedMapKey)
+            if (parseTokenId(key.id, id) && id < TOKEN_CACHE_FLAT_MAX && id + 1 > qnMax)
+                qnMax = id + 1;
+        newQnTokens.resize(qnMax);
+
+        for (const auto& [key, xdbXQn]: xdbXQnPack.unorderedMapKey) {
+            if (!parseTokenId(key.id, id))
+                continue;
+
+            uint64_t nmSpcId;
+            if (!parseTokenId(xdbXQn->nmSpcId, nmSpcId))
+                nmSpcId = NMSPC_NONE;
+
+            if (id < TOKEN_CACHE_FLAT_MAX)
+                fillToken(newQnTokens[id], xdbXQn, nmSpcId);
+            else
+                fillToken(newQnTokensSparse[id], xdbXQn, nmSpcId);
+        }
+
+        uint64_t nmMax = 0;
+        for (const auto& [key, _]: xdbXNmPack.unorderedMapKey)
+            if (parseTokenId(key.id, id) && id < TOKEN_CACHE_FLAT_MAX && id + 1 > nmMax)
+                nmMax = id + 1;
+        newNmSpcTokens.resize(nmMax);
+
+        for (const auto& [key, xdbXNm]: xdbXNmPack.unorderedMapKey) {
+            if (!parseTokenId(key.id, id))
+                continue;
+
+            XmlNamespace& nmSpc = (id < TOKEN_CACHE_FLAT_MAX) ? newNmSpcTokens[id] : newNmSpcTokensSparse[id];
+            nmSpc.valid = true;
+            nmSpc.uri = xdbXNm->nmSpcUri;
+        }
+
+        qnTokens.swap(newQnTokens);
+        qnTokensSparse.swap(newQnTokensSparse);
+        nmSpcTokens.swap(newNmSpcTokens);
+        nmSpcTokensSparse.swap(newNmSpcTokensSparse);
+        tokensChanged = false;
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::SYSTEM)))
+            ctx->logTrace(Ctx::TRACE::SYSTEM, "xml token cache " + tokSuf + ": qn: " + std::to_string(xdbXQnPack.unorderedMapKey.size()) + ", nm: " +
+                                              std::to_string(xdbXNmPack.unorderedMapKey.size()));
+    }
 }
@@ -21,7 +21,9 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define XML_CTX_H_
 
 #include <map>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "../common/Ctx.h"
 #include "../common/table/TablePack.h"
@@ -37,11 +39,46 @@ namespace OpenLogReplicator {
 
     // XML上下文类 - 负责处理Oracle XML类型数据
     class XmlCtx final {
+    public:
+        // 已解码的QName令牌，包含预先生成的输出片段
+        struct XmlToken {
+            bool valid{false};
+            bool isAttribute{false};
+            uint64_t nmSpcId{0};
+            std::string localName;
+            std::string tagOpen;       // <name
+            std::string tagClose;      // </name>
+            std::string attribute;     //  name="
+        };
+
+        // 已解码的命名空间令牌
+        struct XmlNamespace {
+            bool valid{false};
+            std::string uri;
+        };
+
+        // 令牌ID小于该值时使用平面数组，否则使用哈希表
+        static constexpr uint64_t TOKEN_CACHE_FLAT_MAX{0x10000};
+        static constexpr uint64_t NMSPC_NONE{0xFFFFFFFFFFFFFFFF};
+
     protected:
-        Ctx* ctx;          // 上下文对象
-        bool experimental; // 是否处于实验模式
+        std::vector<XmlToken> qnTokens;
+        std::unordered_map<uint64_t, XmlToken> qnTokensSparse;
+        std::vector<XmlNamespace> nmSpcTokens;
+        std::unordered_map<uint64_t, XmlNamespace> nmSpcTokensSparse;
+
+        static void fillToken(XmlToken& token, const XdbXQn* xdbXQn, uint64_t nmSpcId);
 
     public:
+        Ctx* ctx;          // 上下文对象
+        std::string tokSuf; // 令牌表后缀
+        uint64_t flags;    // XDB.XDB$TTSET标志
+        bool tokensChanged{true}; // 字典已变更，需要重建令牌缓存
+
+        TablePack<XdbXNm, TabRowIdKeyDefault, XdbXNmKey> xdbXNmPack; // XDB.X$NM命名空间字典
+        TablePack<XdbXPt, TabRowIdKeyDefault, XdbXPtKey> xdbXPtPack; // XDB.X$PT路径字典
+        TablePack<XdbXQn, TabRowIdKeyDefault, XdbXQnKey> xdbXQnPack; // XDB.X$QN限定名字典
+
         // XML命名空间常量
         static constexpr std::string_view NS_XDBC{"http://xmlns.oracle.com/xdb/xdbconfig.xsd"};
         static constexpr std::string_view NS_XDBCA{"http://xmlns.oracle.com/xdb/access.xsd"};
@@ -76,9 +113,39 @@ namespace OpenLogReplicator {
 
         std::unordered_map<std::string, std::string> xmlNamespaces; // XML命名空间映射
         
-        // 构造函数
-        explicit XmlCtx(Ctx* newCtx);
-        
+        // 构造与析构函数
+        XmlCtx(Ctx* newCtx, std::string newTokSuf, uint64_t newFlags);
+        ~XmlCtx();
+
+        // 字典管理
+        void purgeDicts() noexcept;
+
+        // 令牌缓存 - 字典变更后在旁边构建再交换，解析时按数字ID直接访问
+        void buildTokenCache();
+        [[nodiscard]] static bool parseTokenId(const std::string& id, uint64_t& value);
+        [[nodiscard]] static std::string tokenIdToString(uint64_t id);
+        [[nodiscard]] const XmlToken* findQn(uint64_t id) const {
+            if (id < qnTokens.size()) {
+                const XmlToken& token = qnTokens[id];
+                return token.valid ? &token : nullptr;
+            }
+            auto qnTokensSparseIt = qnTokensSparse.find(id);
+            if (qnTokensSparseIt == qnTokensSparse.end())
+                return nullptr;
+            return &qnTokensSparseIt->second;
+        }
+
+        [[nodiscard]] const std::string* findNmSpcUri(uint64_t id) const {
+            if (id < nmSpcTokens.size()) {
+                const XmlNamespace& nmSpc = nmSpcTokens[id];
+                return nmSpc.valid ? &nmSpc.uri : nullptr;
+            }
+            auto nmSpcTokensSparseIt = nmSpcTokensSparse.find(id);
+            if (nmSpcTokensSparseIt == nmSpcTokensSparse.end())
+                return nullptr;
+            return &nmSpcTokensSparseIt->second.uri;
+        }
+
         // 添加命名空间
         void addNamespace(const std::string& nspace, const std::string& path);
         
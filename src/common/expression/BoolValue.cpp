@@ -41,38 +41,60 @@ namespace OpenLogReplicator {
         }
     }
 
-    bool BoolValue::evaluateToBool(char op, const std::unordered_map<std::string, std::string>* attributes) {
+    void BoolValue::compile(Condition* condition) {
         switch (boolType) {
             case VALUE::FALSE:
-                return false;
+                condition->emit(Condition::OPCODE::PUSH_FALSE, 0);
+                return;
 
             case VALUE::TRUE:
-                return true;
+                condition->emit(Condition::OPCODE::PUSH_TRUE, 0);
+                return;
 
             case VALUE::OPERATOR_AND:
-                if (!left->evaluateToBool(op, attributes))
-                    return false;
-                return right->evaluateToBool(op, attributes);
-
-            case VALUE::OPERATOR_OR:
-                if (left->evaluateToBool(op, attributes))
-                    return true;
-                return right->evaluateToBool(op, attributes);
+            case VALUE::OPERATOR_OR: {
+                left->compile(condition);
+                const uint64_t jump = condition->emitJump(boolType == VALUE::OPERATOR_AND ? Condition::OPCODE::AND_JUMP : Condition::OPCODE::OR_JUMP);
+                right->compile(condition);
+                condition->patchJump(jump);
+                return;
+            }
 
             case VALUE::OPERATOR_NOT:
-                return !left->evaluateToBool(op, attributes);
+                left->compile(condition);
+                condition->emit(Condition::OPCODE::NOT, 0);
+                return;
 
             case VALUE::OPERATOR_EQUAL:
-                return (left->evaluateToString(op, attributes) == right->evaluateToString(op, attributes));
+                compileCompare(condition, Condition::OPCODE::EQUAL);
+                return;
 
             case VALUE::OPERATOR_NOT_EQUAL:
-                return (left->evaluateToString(op, attributes) != right->evaluateToString(op, attributes));
+                compileCompare(condition, Condition::OPCODE::NOT_EQUAL);
+                return;
+
+            case VALUE::OPERATOR_LESS:
+                compileCompare(condition, Condition::OPCODE::LESS);
+                return;
+
+            case VALUE::OPERATOR_LESS_EQUAL:
+                compileCompare(condition, Condition::OPCODE::LESS_EQUAL);
+                return;
+
+            case VALUE::OPERATOR_GREATER:
+                compileCompare(condition, Condition::OPCODE::GREATER);
+                return;
+
+            case VALUE::OPERATOR_GREATER_EQUAL:
+                compileCompare(condition, Condition::OPCODE::GREATER_EQUAL);
+                return;
         }
         throw RuntimeException(50066, "invalid expression evaluation: invalid bool type");
     }
 
-    std::string BoolValue::evaluateToString(char op __attribute__((unused)), const std::unordered_map<std::string,
-            std::string>* attributes __attribute__((unused))) {
-        throw RuntimeException(50066, "invalid expression evaluation: bool to string");
+    void BoolValue::compileCompare(Condition* condition, Condition::OPCODE opcode) {
+        left->compile(condition);
+        right->compile(condition);
+        condition->emit(opcode, 0, left->isNumber() || right->isNumber());
     }
 }
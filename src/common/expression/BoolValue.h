@@ -17,6 +17,7 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include "Condition.h"
 #include "Expression.h"
 
 #ifndef EXPRESSION_BOOL_H_
@@ -26,7 +27,8 @@ namespace OpenLogReplicator {
     class BoolValue : public Expression {
     public:
         enum class VALUE : unsigned char {
-            FALSE, TRUE, OPERATOR_AND, OPERATOR_OR, OPERATOR_NOT, OPERATOR_EQUAL, OPERATOR_NOT_EQUAL
+            FALSE, TRUE, OPERATOR_AND, OPERATOR_OR, OPERATOR_NOT, OPERATOR_EQUAL, OPERATOR_NOT_EQUAL, OPERATOR_LESS, OPERATOR_LESS_EQUAL,
+            OPERATOR_GREATER, OPERATOR_GREATER_EQUAL
         };
 
     protected:
@@ -34,14 +36,15 @@ namespace OpenLogReplicator {
         Expression* left;
         Expression* right;
 
+        void compileCompare(Condition* condition, Condition::OPCODE opcode);
+
     public:
         BoolValue(VALUE newBoolType, Expression* newLeft, Expression* newRight);
         ~BoolValue() override;
 
         bool isBool() override { return true; }
 
-        bool evaluateToBool(char op, const std::unordered_map<std::string, std::string>* attributes) override;
-        std::string evaluateToString(char op, const std::unordered_map<std::string, std::string>* attributes) override;
+        void compile(Condition* condition) override;
     };
 }
 
@@ -0,0 +1,45 @@
+/* Column value reference for expressions evaluated on row data
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <utility>
+
+#include "ColumnValue.h"
+#include "Condition.h"
+
+namespace OpenLogReplicator {
+    ColumnValue::ColumnValue(typeCol newColumn, SysCol::COLTYPE newColumnType, std::string newColumnName) :
+            column(newColumn),
+            columnType(newColumnType),
+            columnName(std::move(newColumnName)) {
+    }
+
+    void ColumnValue::compile(Condition* condition) {
+        if (column == COLUMN_NULL) {
+            condition->emit(Condition::OPCODE::PUSH_NULL, 0);
+            return;
+        }
+
+        condition->emit(columnType == SysCol::COLTYPE::NUMBER ? Condition::OPCODE::PUSH_COLUMN_NUMBER : Condition::OPCODE::PUSH_COLUMN_STRING,
+                        static_cast<uint32_t>(column));
+    }
+
+    bool ColumnValue::isTypeSupported(SysCol::COLTYPE type) {
+        return type == SysCol::COLTYPE::NUMBER || type == SysCol::COLTYPE::VARCHAR || type == SysCol::COLTYPE::CHAR;
+    }
+}
@@ -0,0 +1,48 @@
+/* Header for ColumnValue class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include "Expression.h"
+#include "../table/SysCol.h"
+
+#ifndef COLUMN_VALUE_H_
+#define COLUMN_VALUE_H_
+
+namespace OpenLogReplicator {
+    class ColumnValue : public Expression {
+    public:
+        // Column removed by a DDL change, the value is always NULL
+        static constexpr typeCol COLUMN_NULL{-1};
+
+        typeCol column;
+        SysCol::COLTYPE columnType;
+        std::string columnName;
+
+        ColumnValue(typeCol newColumn, SysCol::COLTYPE newColumnType, std::string newColumnName);
+
+        bool isString() override { return true; }
+
+        bool isNumber() override { return columnType == SysCol::COLTYPE::NUMBER; }
+
+        void compile(Condition* condition) override;
+
+        static bool isTypeSupported(SysCol::COLTYPE type);
+    };
+}
+
+#endif
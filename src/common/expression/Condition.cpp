@@ -0,0 +1,417 @@
+/* Condition compiled from expression tree
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "../exception/RuntimeException.h"
+#include "Condition.h"
+
+namespace OpenLogReplicator {
+    std::mutex Condition::slotsMtx;
+    std::vector<uint64_t> Condition::slotsFree;
+    uint64_t Condition::slotNext{0};
+    std::atomic<uint64_t> Condition::serialNext{1};
+
+    Condition::Condition(const std::string& condition, Expression* root) :
+            slot(slotAcquire()),
+            serial(serialNext++) {
+        try {
+            root->compile(this);
+
+            if (maxDepth > STACK_SIZE)
+                throw RuntimeException(50067, "invalid condition: " + condition + " too complex, stack depth: " + std::to_string(maxDepth));
+        } catch (...) {
+            slotRelease(slot);
+            throw;
+        }
+    }
+
+    Condition::~Condition() {
+        slotRelease(slot);
+    }
+
+    uint64_t Condition::slotAcquire() {
+        std::unique_lock<std::mutex> const lck(slotsMtx);
+        if (slotsFree.empty())
+            return slotNext++;
+
+        const uint64_t freeSlot = slotsFree.back();
+        slotsFree.pop_back();
+        return freeSlot;
+    }
+
+    void Condition::slotRelease(uint64_t freeSlot) {
+        std::unique_lock<std::mutex> const lck(slotsMtx);
+        slotsFree.push_back(freeSlot);
+    }
+
+    void Condition::emit(OPCODE opcode, uint32_t arg, bool numeric) {
+        switch (opcode) {
+            case OPCODE::PUSH_COLUMN_STRING:
+            case OPCODE::PUSH_COLUMN_NUMBER:
+                rowDependent = true;
+                [[fallthrough]];
+
+            case OPCODE::PUSH_FALSE:
+            case OPCODE::PUSH_TRUE:
+            case OPCODE::PUSH_OP:
+            case OPCODE::PUSH_ATTRIBUTE:
+            case OPCODE::PUSH_STRING:
+            case OPCODE::PUSH_NUMBER:
+            case OPCODE::PUSH_NULL:
+                if (++depth > maxDepth)
+                    maxDepth = depth;
+                break;
+
+            case OPCODE::NOT:
+                break;
+
+            default:
+                // Jumps drop the left operand when the right one is evaluated, comparisons replace two operands with the result
+                --depth;
+        }
+
+        program.push_back({opcode, numeric, arg});
+    }
+
+    uint64_t Condition::emitJump(OPCODE opcode) {
+        emit(opcode, 0);
+        return program.size() - 1;
+    }
+
+    void Condition::patchJump(uint64_t position) {
+        program[position].arg = static_cast<uint32_t>(program.size());
+    }
+
+    uint32_t Condition::addString(const std::string& str) {
+        for (uint32_t i = 0; i < strings.size(); ++i)
+            if (strings[i] == str)
+                return i;
+
+        strings.push_back(str);
+        return static_cast<uint32_t>(strings.size() - 1);
+    }
+
+    uint32_t Condition::addNumber(long double number) {
+        for (uint32_t i = 0; i < numbers.size(); ++i)
+            if (numbers[i] == number)
+                return i;
+
+        numbers.push_back(number);
+        return static_cast<uint32_t>(numbers.size() - 1);
+    }
+
+    bool Condition::evaluate(char op, const std::unordered_map<std::string, std::string>* attributes, const ExpressionRow* row,
+                             ConditionCache* cache) const {
+        if (cache == nullptr || rowDependent)
+            return run(op, attributes, row);
+
+        // Two bits for every operation: evaluated and result
+        uint shift;
+        switch (op) {
+            case 'i':
+                shift = 0;
+                break;
+
+            case 'u':
+                shift = 2;
+                break;
+
+            case 'd':
+                shift = 4;
+                break;
+
+            default:
+                return run(op, attributes, row);
+        }
+
+        uint8_t& result = cache->result(slot, serial);
+        if ((result & (1 << shift)) != 0)
+            return (result & (2 << shift)) != 0;
+
+        const bool matches = run(op, attributes, row);
+        result |= static_cast<uint8_t>((1 << shift) | (matches ? (2 << shift) : 0));
+        return matches;
+    }
+
+    bool Condition::run(char op, const std::unordered_map<std::string, std::string>* attributes, const ExpressionRow* row) const {
+        Value stack[STACK_SIZE];
+        uint top = 0;
+        uint64_t pc = 0;
+
+        while (pc < program.size()) {
+            const Instruction& instruction = program[pc++];
+
+            switch (instruction.opcode) {
+                case OPCODE::PUSH_FALSE:
+                case OPCODE::PUSH_TRUE: {
+                    Value& value = stack[top++];
+                    value.type = VALUE_TYPE::BOOL;
+                    value.result = (instruction.opcode == OPCODE::PUSH_TRUE);
+                    break;
+                }
+
+                case OPCODE::PUSH_OP: {
+                    Value& value = stack[top++];
+                    value.type = VALUE_TYPE::STRING;
+                    value.data = &op;
+                    value.length = 1;
+                    break;
+                }
+
+                case OPCODE::PUSH_ATTRIBUTE: {
+                    // Missing attribute is an empty string
+                    Value& value = stack[top++];
+                    value.type = VALUE_TYPE::STRING;
+                    value.data = "";
+                    value.length = 0;
+                    if (attributes != nullptr) {
+                        auto attributesIt = attributes->find(strings[instruction.arg]);
+                        if (attributesIt != attributes->end()) {
+                            value.data = attributesIt->second.data();
+                            value.length = attributesIt->second.length();
+                        }
+                    }
+                    break;
+                }
+
+                case OPCODE::PUSH_STRING: {
+                    Value& value = stack[top++];
+                    value.type = VALUE_TYPE::STRING;
+                    value.data = strings[instruction.arg].data();
+                    value.length = strings[instruction.arg].length();
+                    break;
+                }
+
+                case OPCODE::PUSH_NUMBER: {
+                    Value& value = stack[top++];
+                    value.type = VALUE_TYPE::NUMBER;
+                    value.number = numbers[instruction.arg];
+                    break;
+                }
+
+                case OPCODE::PUSH_NULL: {
+                    Value& value = stack[top++];
+                    value.type = VALUE_TYPE::NONE;
+                    value.data = "";
+                    value.length = 0;
+                    break;
+                }
+
+                case OPCODE::PUSH_COLUMN_STRING:
+                case OPCODE::PUSH_COLUMN_NUMBER: {
+                    // NULL is an empty string, like a missing session attribute
+                    Value& value = stack[top++];
+                    value.type = VALUE_TYPE::NONE;
+                    value.data = "";
+                    value.length = 0;
+
+                    const uint8_t* data;
+                    uint64_t size;
+                    if (row == nullptr || !row->columnValue(op, static_cast<typeCol>(instruction.arg), data, size) || size == 0)
+                        break;
+
+                    if (instruction.opcode == OPCODE::PUSH_COLUMN_NUMBER) {
+                        if (decodeNumber(data, size, value.number))
+                            value.type = VALUE_TYPE::NUMBER;
+                    } else {
+                        value.type = VALUE_TYPE::STRING;
+                        value.data = reinterpret_cast<const char*>(data);
+                        value.length = size;
+                    }
+                    break;
+                }
+
+                case OPCODE::NOT:
+                    stack[top - 1].result = !stack[top - 1].result;
+                    break;
+
+                case OPCODE::AND_JUMP:
+                    if (!stack[top - 1].result)
+                        pc = instruction.arg;
+                    else
+                        --top;
+                    break;
+
+                case OPCODE::OR_JUMP:
+                    if (stack[top - 1].result)
+                        pc = instruction.arg;
+                    else
+                        --top;
+                    break;
+
+                case OPCODE::EQUAL:
+                case OPCODE::NOT_EQUAL:
+                case OPCODE::LESS:
+                case OPCODE::LESS_EQUAL:
+                case OPCODE::GREATER:
+                case OPCODE::GREATER_EQUAL: {
+                    const Value& right = stack[--top];
+                    Value& left = stack[top - 1];
+                    int result = 0;
+                    bool matches;
+
+                    if (instruction.numeric) {
+                        // Compared to a number, NULL or a non-numeric value is just different
+                        long double leftNumber;
+                        long double rightNumber;
+                        if (!toNumber(left, leftNumber) || !toNumber(right, rightNumber)) {
+                            left.type = VALUE_TYPE::BOOL;
+                            left.result = (instruction.opcode == OPCODE::NOT_EQUAL);
+                            break;
+                        }
+
+                        if (leftNumber < rightNumber)
+                            result = -1;
+                        else if (leftNumber > rightNumber)
+                            result = 1;
+                    } else
+                        result = compareStrings(left, right);
+
+                    switch (instruction.opcode) {
+                        case OPCODE::EQUAL:
+                            matches = (result == 0);
+                            break;
+
+                        case OPCODE::NOT_EQUAL:
+                            matches = (result != 0);
+                            break;
+
+                        case OPCODE::LESS:
+                            matches = (result < 0);
+                            break;
+
+                        case OPCODE::LESS_EQUAL:
+                            matches = (result <= 0);
+                            break;
+
+                        case OPCODE::GREATER:
+                            matches = (result > 0);
+                            break;
+
+                        default:
+                            matches = (result >= 0);
+                    }
+
+                    left.type = VALUE_TYPE::BOOL;
+                    left.result = matches;
+                    break;
+                }
+            }
+        }
+
+        return stack[0].result;
+    }
+
+    bool Condition::toNumber(const Value& value, long double& number) {
+        if (value.type == VALUE_TYPE::NUMBER) {
+            number = value.number;
+            return true;
+        }
+
+        if (value.type != VALUE_TYPE::STRING || value.length == 0 || value.length >= NUMBER_LENGTH)
+            return false;
+
+        char buffer[NUMBER_LENGTH];
+        memcpy(buffer, value.data, value.length);
+        buffer[value.length] = 0;
+        char* end = nullptr;
+        number = std::strtold(buffer, &end);
+        return end == buffer + value.length;
+    }
+
+    int Condition::compareStrings(const Value& left, const Value& right) {
+        const int result = memcmp(left.data, right.data, std::min(left.length, right.length));
+        if (result != 0)
+            return result;
+        if (left.length < right.length)
+            return -1;
+        if (left.length > right.length)
+            return 1;
+        return 0;
+    }
+
+    bool Condition::decodeNumber(const uint8_t* data, uint64_t size, long double& number) {
+        // Oracle NUMBER: exponent byte followed by base-100 digits, negative values are complemented and end with 0x66
+        if (data[0] == 0x80) {
+            number = 0;
+            return true;
+        }
+
+        const bool negative = data[0] < 0x80;
+        int64_t exponent;
+        uint64_t length = size - 1;
+
+        if (negative) {
+            if (size == 1) {
+                number = -HUGE_VALL;
+                return true;
+            }
+            exponent = 0x3E - static_cast<int64_t>(data[0]);
+            if (data[size - 1] == 0x66)
+                --length;
+        } else {
+            if (size == 2 && data[0] == 0xFF && data[1] == 0x65) {
+                number = HUGE_VALL;
+                return true;
+            }
+            exponent = static_cast<int64_t>(data[0]) - 0xC1;
+        }
+
+        if (unlikely(length > 21))
+            return false;
+
+        // The digits are converted as decimal text, so the value is rounded the same way as a number in the condition
+        char buffer[NUMBER_LENGTH];
+        uint64_t pos = 0;
+        if (negative)
+            buffer[pos++] = '-';
+        buffer[pos++] = '0';
+        buffer[pos++] = '.';
+        for (uint64_t i = 0; i < length; ++i) {
+            const uint8_t digit = data[i + 1];
+            if (unlikely(digit < 1 || digit > 101))
+                return false;
+            const uint value = negative ? 101 - digit : digit - 1;
+            if (unlikely(value > 99))
+                return false;
+            buffer[pos++] = static_cast<char>('0' + (value / 10));
+            buffer[pos++] = static_cast<char>('0' + (value % 10));
+        }
+        // Decimal exponent, at most 3 digits
+        int64_t decimalExponent = (exponent + 1) * 2;
+        buffer[pos++] = 'e';
+        if (decimalExponent < 0) {
+            buffer[pos++] = '-';
+            decimalExponent = -decimalExponent;
+        }
+        if (decimalExponent >= 100)
+            buffer[pos++] = static_cast<char>('0' + (decimalExponent / 100));
+        if (decimalExponent >= 10)
+            buffer[pos++] = static_cast<char>('0' + ((decimalExponent / 10) % 10));
+        buffer[pos++] = static_cast<char>('0' + (decimalExponent % 10));
+        buffer[pos] = 0;
+
+        char* end = nullptr;
+        number = std::strtold(buffer, &end);
+        return *end == '\0';
+    }
+}
@@ -0,0 +1,140 @@
+/* Header for Condition class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Expression.h"
+
+#ifndef CONDITION_H_
+#define CONDITION_H_
+
+namespace OpenLogReplicator {
+    class Condition;
+
+    // Results of conditions which don't depend on row values, valid for one transaction
+    class ConditionCache final {
+    protected:
+        struct Entry {
+            uint64_t generation;
+            uint64_t serial;
+            uint8_t result;
+        };
+
+        std::vector<Entry> entries;
+        uint64_t generation{1};
+
+    public:
+        // Results of the previous transaction become stale without touching the entries
+        void reset() {
+            ++generation;
+        }
+
+        uint8_t& result(uint64_t slot, uint64_t serial) {
+            if (unlikely(slot >= entries.size()))
+                entries.resize(slot + 1, Entry{0, 0, 0});
+
+            // The slot may have been used by a condition which was dropped with its table
+            Entry& entry = entries[slot];
+            if (entry.generation != generation || entry.serial != serial) {
+                entry.generation = generation;
+                entry.serial = serial;
+                entry.result = 0;
+            }
+            return entry.result;
+        }
+    };
+
+    // Condition compiled to a postfix program, evaluated without allocations
+    class Condition final {
+    public:
+        enum class OPCODE : unsigned char {
+            PUSH_FALSE, PUSH_TRUE, PUSH_OP, PUSH_ATTRIBUTE, PUSH_STRING, PUSH_NUMBER, PUSH_NULL, PUSH_COLUMN_STRING, PUSH_COLUMN_NUMBER, NOT, AND_JUMP, OR_JUMP,
+            EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL
+        };
+
+        static constexpr uint STACK_SIZE{64};
+        static constexpr uint NUMBER_LENGTH{64};
+
+    protected:
+        enum class VALUE_TYPE : unsigned char {
+            BOOL, NONE, STRING, NUMBER
+        };
+
+        struct Instruction {
+            OPCODE opcode;
+            // Comparison of numbers instead of strings
+            bool numeric;
+            uint32_t arg;
+        };
+
+        struct Value {
+            VALUE_TYPE type;
+            bool result;
+            const char* data;
+            uint64_t length;
+            long double number;
+        };
+
+        // Slots of dropped conditions are reused, so the cache size is bound by the number of conditions in the schema
+        static std::mutex slotsMtx;
+        static std::vector<uint64_t> slotsFree;
+        static uint64_t slotNext;
+        static std::atomic<uint64_t> serialNext;
+
+        std::vector<Instruction> program;
+        std::vector<std::string> strings;
+        std::vector<long double> numbers;
+        uint depth{0};
+        uint maxDepth{0};
+        bool rowDependent{false};
+
+        [[nodiscard]] bool run(char op, const std::unordered_map<std::string, std::string>* attributes, const ExpressionRow* row) const;
+        static bool toNumber(const Value& value, long double& number);
+        static int compareStrings(const Value& left, const Value& right);
+        static uint64_t slotAcquire();
+        static void slotRelease(uint64_t freeSlot);
+
+    public:
+        const uint64_t slot;
+        const uint64_t serial;
+
+        Condition(const std::string& condition, Expression* root);
+        ~Condition();
+
+        void emit(OPCODE opcode, uint32_t arg, bool numeric = false);
+        [[nodiscard]] uint64_t emitJump(OPCODE opcode);
+        void patchJump(uint64_t position);
+        [[nodiscard]] uint32_t addString(const std::string& str);
+        [[nodiscard]] uint32_t addNumber(long double number);
+
+        [[nodiscard]] bool isRowDependent() const {
+            return rowDependent;
+        }
+
+        [[nodiscard]] bool evaluate(char op, const std::unordered_map<std::string, std::string>* attributes, const ExpressionRow* row,
+                                    ConditionCache* cache) const;
+        static bool decodeNumber(const uint8_t* data, uint64_t size, long double& number);
+    };
+}
+
+#endif
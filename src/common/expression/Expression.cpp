@@ -17,8 +17,14 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <cstdlib>
+
+#include "../DbColumn.h"
+#include "../Ctx.h"
+#include "../DbTable.h"
 #include "../exception/RuntimeException.h"
 #include "BoolValue.h"
+#include "ColumnValue.h"
 #include "Expression.h"
 #include "StringValue.h"
 #include "Token.h"
@@ -51,11 +57,12 @@ namespace OpenLogReplicator {
                         expressionType = Token::TYPE::IDENTIFIER;
                         tokenIndex = ++i;
                         continue;
-                    } else if (condition[i] == '|' || condition[i] == '&' || condition[i] == '!' || condition[i] == '=') {
+                    } else if (condition[i] == '|' || condition[i] == '&' || condition[i] == '!' || condition[i] == '=' ||
+                            condition[i] == '<' || condition[i] == '>') {
                         expressionType = Token::TYPE::OPERATOR;
                         tokenIndex = i++;
                         continue;
-                    } else if ((condition[i] >= '0' && condition[i] <= '9') || condition[i] == '.') {
+                    } else if ((condition[i] >= '0' && condition[i] <= '9') || condition[i] == '.' || condition[i] == '-') {
                         expressionType = Token::TYPE::NUMBER;
                         tokenIndex = i++;
                         continue;
@@ -91,7 +98,8 @@ namespace OpenLogReplicator {
                             ++i;
                             continue;
                         }
-                    } else if (condition[i] == '|' || condition[i] == '&' || condition[i] == '!' || condition[i] == '=') {
+                    } else if (condition[i] == '|' || condition[i] == '&' || condition[i] == '!' || condition[i] == '=' ||
+                               condition[i] == '<' || condition[i] == '>') {
                         ++i;
                         continue;
                     }
@@ -133,7 +141,8 @@ namespace OpenLogReplicator {
             tokens.push_back(new Token(expressionType, condition.substr(tokenIndex, i - tokenIndex)));
     }
 
-    BoolValue* Expression::buildCondition(const std::string& condition, std::vector<Token*>& tokens, std::vector<Expression*>& stack) {
+    BoolValue* Expression::buildCondition(const Ctx* ctx, const std::string& condition, std::vector<Token*>& tokens, std::vector<Expression*>& stack,
+                                          DbTable* table, bool afterDdl) {
         uint64_t i = 0;
         while (stack.size() > 1 || i < tokens.size()) {
             if (stack.size() >= 2) {
@@ -177,22 +186,30 @@ namespace OpenLogReplicator {
                 // STRING TOKEN STRING
                 if (left->isString() && middle->isToken() && right->isString()) {
                     const Token* middleToken = dynamic_cast<Token*>(middle);
-
-                    // A == B
-                    if (middleToken->stringValue == "==") {
+                    BoolValue::VALUE compareType;
+                    bool compare = true;
+
+                    if (middleToken->stringValue == "==")
+                        compareType = BoolValue::VALUE::OPERATOR_EQUAL;
+                    else if (middleToken->stringValue == "!=")
+                        compareType = BoolValue::VALUE::OPERATOR_NOT_EQUAL;
+                    else if (middleToken->stringValue == "<")
+                        compareType = BoolValue::VALUE::OPERATOR_LESS;
+                    else if (middleToken->stringValue == "<=")
+                        compareType = BoolValue::VALUE::OPERATOR_LESS_EQUAL;
+                    else if (middleToken->stringValue == ">")
+                        compareType = BoolValue::VALUE::OPERATOR_GREATER;
+                    else if (middleToken->stringValue == ">=")
+                        compareType = BoolValue::VALUE::OPERATOR_GREATER_EQUAL;
+                    else
+                        compare = false;
+
+                    // A == B, A != B, A < B, A <= B, A > B, A >= B
+                    if (compare) {
                         stack.pop_back();
                         stack.pop_back();
                         stack.pop_back();
-                        stack.push_back(new BoolValue(BoolValue::VALUE::OPERATOR_EQUAL, left, right));
-                        continue;
-                    }
-
-                    // A != B
-                    if (middleToken->stringValue == "!=") {
-                        stack.pop_back();
-                        stack.pop_back();
-                        stack.pop_back();
-                        stack.push_back(new BoolValue(BoolValue::VALUE::OPERATOR_NOT_EQUAL, left, right));
+                        stack.push_back(new BoolValue(compareType, left, right));
                         continue;
                     }
                 }
@@ -234,6 +251,8 @@ namespace OpenLogReplicator {
                             stack.push_back(new BoolValue(BoolValue::VALUE::TRUE, nullptr, nullptr));
                         else if (token->stringValue == "false")
                             stack.push_back(new BoolValue(BoolValue::VALUE::FALSE, nullptr, nullptr));
+                        else if (token->stringValue.compare(0, 7, "column:") == 0)
+                            stack.push_back(buildColumnValue(ctx, condition, token->stringValue.substr(7), table, afterDdl));
                         else
                             stack.push_back(new StringValue(StringValue::TYPE::SESSION_ATTRIBUTE, token->stringValue));
                         continue;
@@ -245,9 +264,14 @@ namespace OpenLogReplicator {
                         stack.push_back(token);
                         continue;
 
-                    // Unsupported
-                    case Token::TYPE::NUMBER:
-                        break;
+                    case Token::TYPE::NUMBER: {
+                        char* end = nullptr;
+                        std::strtold(token->stringValue.c_str(), &end);
+                        if (*end != '\0')
+                            throw RuntimeException(50067, "invalid condition: " + condition + " number: " + token->stringValue);
+                        stack.push_back(new StringValue(StringValue::TYPE::NUMBER, token->stringValue));
+                        continue;
+                    }
 
                     case Token::TYPE::STRING:
                         stack.push_back(new StringValue(StringValue::TYPE::VALUE, token->stringValue));
@@ -278,5 +302,38 @@ namespace OpenLogReplicator {
         return root;
     }
 
+    ColumnValue* Expression::buildColumnValue(const Ctx* ctx, const std::string& condition, const std::string& name, DbTable* table, bool afterDdl) {
+        if (table == nullptr)
+            throw RuntimeException(50067, "invalid condition: " + condition + " column: " + name + " used outside of table");
+
+        for (typeCol column = 0; column < static_cast<typeCol>(table->columns.size()); ++column) {
+            // Slots of columns without definition can't be referenced, their value is always NULL
+            const DbColumn* dbColumn = table->columns[column];
+            if (dbColumn == nullptr || dbColumn->name != name)
+                continue;
+
+            if (!ColumnValue::isTypeSupported(dbColumn->type)) {
+                const std::string msg = "condition: " + condition + " column: " + name + " has unsupported type: " +
+                                        std::to_string(static_cast<uint>(dbColumn->type));
+                // The configuration was checked at startup, a DDL change must not stop replication
+                if (!afterDdl)
+                    throw RuntimeException(50067, "invalid " + msg);
+                ctx->warning(60040, msg + ", evaluated as NULL");
+                return new ColumnValue(ColumnValue::COLUMN_NULL, SysCol::COLTYPE::NONE, name);
+            }
+
+            // The value must be present for evaluation even if not selected for output
+            if (table->isColumnSkipped(column))
+                table->keepColumn(column);
+            return new ColumnValue(column, dbColumn->type, name);
+        }
+
+        const std::string msg = "condition: " + condition + " column: " + name + " not found in table: " + table->owner + "." + table->name;
+        if (!afterDdl)
+            throw RuntimeException(50067, "invalid " + msg);
+        ctx->warning(60040, msg + ", evaluated as NULL");
+        return new ColumnValue(ColumnValue::COLUMN_NULL, SysCol::COLTYPE::NONE, name);
+    }
+
     Expression::Expression() = default;
 }
@@ -17,7 +17,7 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
-#include <unordered_map>
+#include <string>
 #include <vector>
 
 #include "../types/Types.h"
@@ -27,12 +27,29 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 
 namespace OpenLogReplicator {
     class BoolValue;
+    class ColumnValue;
+    class Condition;
+    class Ctx;
+    class DbTable;
     class Token;
 
+    // Column values of the row being evaluated, provided by the builder
+    class ExpressionRow {
+    public:
+        virtual ~ExpressionRow() = default;
+
+        // Returns false for a NULL or missing value
+        virtual bool columnValue(char op, typeCol column, const uint8_t*& data, uint64_t& size) const = 0;
+    };
+
     class Expression {
+    protected:
+        static ColumnValue* buildColumnValue(const Ctx* ctx, const std::string& condition, const std::string& name, DbTable* table, bool afterDdl);
+
     public:
         static void buildTokens(const std::string& condition, std::vector<Token*>& tokens);
-        static BoolValue* buildCondition(const std::string& condition, std::vector<Token*>& tokens, std::vector<Expression*>& stack);
+        static BoolValue* buildCondition(const Ctx* ctx, const std::string& condition, std::vector<Token*>& tokens, std::vector<Expression*>& stack,
+                                         DbTable* table, bool afterDdl);
 
         Expression();
         virtual ~Expression() = default;
@@ -43,8 +60,9 @@ namespace OpenLogReplicator {
 
         virtual bool isToken() { return false; }
 
-        virtual bool evaluateToBool(char op, const std::unordered_map<std::string, std::string>* attributes) = 0;
-        virtual std::string evaluateToString(char op, const std::unordered_map<std::string, std::string>* attributes) = 0;
+        virtual bool isNumber() { return false; }
+
+        virtual void compile(Condition* condition) = 0;
     };
 }
 
@@ -17,9 +17,11 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <cstdlib>
 #include <utility>
 
 #include "../exception/RuntimeException.h"
+#include "Condition.h"
 #include "StringValue.h"
 
 namespace OpenLogReplicator {
@@ -28,24 +30,23 @@ namespace OpenLogReplicator {
             stringValue(std::move(newStringValue)) {
     }
 
-    bool StringValue::evaluateToBool(char op __attribute__((unused)), const std::unordered_map<std::string, std::string>* attributes __attribute__((unused))) {
-        throw RuntimeException(50066, "invalid expression evaluation: string to bool");
-    }
-
-    std::string StringValue::evaluateToString(char op, const std::unordered_map<std::string, std::string>* attributes) {
+    void StringValue::compile(Condition* condition) {
         switch (stringType) {
-            case TYPE::SESSION_ATTRIBUTE: {
-                auto attributesIt = attributes->find(stringValue);
-                if (attributesIt == attributes->end())
-                    return "";
-                return attributesIt->second;
-            }
+            case TYPE::SESSION_ATTRIBUTE:
+                condition->emit(Condition::OPCODE::PUSH_ATTRIBUTE, condition->addString(stringValue));
+                return;
 
             case TYPE::OP:
-                return {op};
+                condition->emit(Condition::OPCODE::PUSH_OP, 0);
+                return;
 
             case TYPE::VALUE:
-                return stringValue;
+                condition->emit(Condition::OPCODE::PUSH_STRING, condition->addString(stringValue));
+                return;
+
+            case TYPE::NUMBER:
+                condition->emit(Condition::OPCODE::PUSH_NUMBER, condition->addNumber(std::strtold(stringValue.c_str(), nullptr)));
+                return;
         }
 
         throw RuntimeException(50066, "invalid expression evaluation: invalid string type");
@@ -26,7 +26,7 @@ namespace OpenLogReplicator {
     class StringValue : public Expression {
     public:
         enum class TYPE : unsigned char {
-            SESSION_ATTRIBUTE, OP, VALUE
+            SESSION_ATTRIBUTE, OP, VALUE, NUMBER
         };
 
         TYPE stringType;
@@ -36,8 +36,9 @@ namespace OpenLogReplicator {
 
         bool isString() override { return true; }
 
-        bool evaluateToBool(char op, const std::unordered_map<std::string, std::string>* attributes) override;
-        std::string evaluateToString(char op, const std::unordered_map<std::string, std::string>* attributes) override;
+        bool isNumber() override { return stringType == TYPE::NUMBER; }
+
+        void compile(Condition* condition) override;
     };
 }
 
@@ -28,13 +28,7 @@ namespace OpenLogReplicator {
             stringValue(std::move(newStringValue)) {
     }
 
-    bool Token::evaluateToBool(char op __attribute__((unused)), const std::unordered_map<std::string,
-            std::string>* attributes __attribute__((unused))) {
-        throw RuntimeException(50066, "invalid expression evaluation: token to bool");
-    }
-
-    std::string Token::evaluateToString(char op __attribute__((unused)), const std::unordered_map<std::string,
-            std::string>* attributes __attribute__((unused))) {
-        throw RuntimeException(50066, "invalid expression evaluation: token to string");
+    void Token::compile(Condition* condition __attribute__((unused))) {
+        throw RuntimeException(50066, "invalid expression evaluation: token to condition");
     }
 }
@@ -40,8 +40,7 @@ namespace OpenLogReplicator {
 
         bool isToken() override { return true; }
 
-        bool evaluateToBool(char op, const std::unordered_map<std::string, std::string>* attributes) override;
-        std::string evaluateToString(char op, const std::unordered_map<std::string, std::string>* attributes) override;
+        void compile(Condition* condition) override;
     };
 }
 
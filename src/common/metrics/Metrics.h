@@ -95,11 +95,21 @@ namespace OpenLogReplicator {
         // memory_allocated_mb
         virtual void emitMemoryAllocatedMb(int64_t gauge) = 0;
 
+        // memory_quota_changes
+        virtual void emitMemoryQuotaChangesGrow(uint64_t counter) = 0;
+        virtual void emitMemoryQuotaChangesShrink(uint64_t counter) = 0;
+
+        // memory_quota_mb
+        virtual void emitMemoryQuotaMbBuilder(int64_t gauge) = 0;
+        virtual void emitMemoryQuotaMbReader(int64_t gauge) = 0;
+        virtual void emitMemoryQuotaMbSwap(int64_t gauge) = 0;
+
         // memory_used_total_mb
         virtual void emitMemoryUsedTotalMb(int64_t gauge) = 0;
 
         // memory_used_mb
         virtual void emitMemoryUsedMbBuilder(int64_t gauge) = 0;
+        virtual void emitMemoryUsedMbLobs(int64_t gauge) = 0;
         virtual void emitMemoryUsedMbMisc(int64_t gauge) = 0;
         virtual void emitMemoryUsedMbParser(int64_t gauge) = 0;
         virtual void emitMemoryUsedMbReader(int64_t gauge) = 0;
@@ -120,6 +130,15 @@ namespace OpenLogReplicator {
         // swap_usage_mb
         virtual void emitSwapUsageMb(int64_t gauge) = 0;
 
+        // swap_victims
+        virtual void emitSwapVictims(uint64_t counter) = 0;
+
+        // swap_victim_idle_mb
+        virtual void emitSwapVictimIdleMb(int64_t gauge) = 0;
+
+        // swap_victim_size_mb
+        virtual void emitSwapVictimSizeMb(int64_t gauge) = 0;
+
         // transactions
         virtual void emitTransactionsCommitOut(uint64_t counter) = 0;
         virtual void emitTransactionsRollbackOut(uint64_t counter) = 0;
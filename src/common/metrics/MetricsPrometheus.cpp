@@ -106,6 +106,18 @@ namespace OpenLogReplicator {
         memoryAllocatedMb = &prometheus::BuildGauge().Name("memory_allocated_mb").Help("Amount of allocated memory in MB").Register(*registry);
         memoryAllocatedMbGauge = &memoryAllocatedMb->Add({});
 
+        // memory_quota_changes
+        memoryQuotaChanges = &prometheus::BuildCounter().Name("memory_quota_changes").Help("Number of memory quota changes made by memory governor")
+                .Register(*registry);
+        memoryQuotaChangesGrowCounter = &memoryQuotaChanges->Add({{"type", "grow"}});
+        memoryQuotaChangesShrinkCounter = &memoryQuotaChanges->Add({{"type", "shrink"}});
+
+        // memory_quota_mb
+        memoryQuotaMb = &prometheus::BuildGauge().Name("memory_quota_mb").Help("Memory quota by module").Register(*registry);
+        memoryQuotaMbBuilderGauge = &memoryQuotaMb->Add({{"type", "builder"}});
+        memoryQuotaMbReaderGauge = &memoryQuotaMb->Add({{"type", "reader"}});
+        memoryQuotaMbSwapGauge = &memoryQuotaMb->Add({{"type", "swap"}});
+
         // memory_used_total_mb
         memoryUsedTotalMb = &prometheus::BuildGauge().Name("memory_used_total_mb").Help("Total used memory").Register(*registry);
         memoryUsedTotalMbGauge = &memoryUsedTotalMb->Add({});
@@ -113,6 +125,7 @@ namespace OpenLogReplicator {
         // memory_used_mb
         memoryUsedMb = &prometheus::BuildGauge().Name("memory_used_mb").Help("Memory used by module: builder").Register(*registry);
         memoryUsedMbBuilderGauge = &memoryUsedMb->Add({{"type", "builder"}});
+        memoryUsedMbLobsGauge = &memoryUsedMb->Add({{"type", "lobs"}});
         memoryUsedMbMiscGauge = &memoryUsedMb->Add({{"type", "misc"}});
         memoryUsedMbParserGauge = &memoryUsedMb->Add({{"type", "parser"}});
         memoryUsedMbReaderGauge = &memoryUsedMb->Add({{"type", "reader"}});
@@ -134,6 +147,19 @@ namespace OpenLogReplicator {
         swapUsageMb = &prometheus::BuildGauge().Name("swap_usage_mb").Help("Swap usage in MB").Register(*registry);
         swapUsageMbGauge = &swapUsageMb->Add({});
 
+        // swap_victims
+        swapVictims = &prometheus::BuildCounter().Name("swap_victims").Help("Number of transactions selected for swapping").Register(*registry);
+        swapVictimsCounter = &swapVictims->Add({});
+
+        // swap_victim_idle_mb
+        swapVictimIdleMb = &prometheus::BuildGauge().Name("swap_victim_idle_mb").Help("Idle time of last swap victim in MB allocated")
+                .Register(*registry);
+        swapVictimIdleMbGauge = &swapVictimIdleMb->Add({});
+
+        // swap_victim_size_mb
+        swapVictimSizeMb = &prometheus::BuildGauge().Name("swap_victim_size_mb").Help("Size of last swap victim in MB").Register(*registry);
+        swapVictimSizeMbGauge = &swapVictimSizeMb->Add({});
+
         memoryUsedTotalMb = &prometheus::BuildGauge().Name("memory_used_total_mb").Help("Total used memory").Register(*registry);
         memoryUsedTotalMbGauge = &memoryUsedTotalMb->Add({});
 
@@ -361,6 +387,28 @@ namespace OpenLogReplicator {
         memoryAllocatedMbGauge->Set(gauge);
     }
 
+    // memory_quota_changes
+    void MetricsPrometheus::emitMemoryQuotaChangesGrow(uint64_t counter) {
+        memoryQuotaChangesGrowCounter->Increment(counter);
+    }
+
+    void MetricsPrometheus::emitMemoryQuotaChangesShrink(uint64_t counter) {
+        memoryQuotaChangesShrinkCounter->Increment(counter);
+    }
+
+    // memory_quota_mb
+    void MetricsPrometheus::emitMemoryQuotaMbBuilder(int64_t gauge) {
+        memoryQuotaMbBuilderGauge->Set(gauge);
+    }
+
+    void MetricsPrometheus::emitMemoryQuotaMbReader(int64_t gauge) {
+        memoryQuotaMbReaderGauge->Set(gauge);
+    }
+
+    void MetricsPrometheus::emitMemoryQuotaMbSwap(int64_t gauge) {
+        memoryQuotaMbSwapGauge->Set(gauge);
+    }
+
     // memory_used_total_mb
     void MetricsPrometheus::emitMemoryUsedTotalMb(int64_t gauge) {
         memoryUsedTotalMbGauge->Set(gauge);
@@ -371,6 +419,10 @@ namespace OpenLogReplicator {
         memoryUsedMbBuilderGauge->Set(gauge);
     }
 
+    void MetricsPrometheus::emitMemoryUsedMbLobs(int64_t gauge) {
+        memoryUsedMbLobsGauge->Set(gauge);
+    }
+
     void MetricsPrometheus::emitMemoryUsedMbMisc(int64_t gauge) {
         memoryUsedMbMiscGauge->Set(gauge);
     }
@@ -419,6 +471,21 @@ namespace OpenLogReplicator {
         swapUsageMbGauge->Set(gauge);
     }
 
+    // swap_victims
+    void MetricsPrometheus::emitSwapVictims(uint64_t counter) {
+        swapVictimsCounter->Increment(counter);
+    }
+
+    // swap_victim_idle_mb
+    void MetricsPrometheus::emitSwapVictimIdleMb(int64_t gauge) {
+        swapVictimIdleMbGauge->Set(gauge);
+    }
+
+    // swap_victim_size_mb
+    void MetricsPrometheus::emitSwapVictimSizeMb(int64_t gauge) {
+        swapVictimSizeMbGauge->Set(gauge);
+    }
+
     // transactions
     void MetricsPrometheus::emitTransactionsCommitOut(uint64_t counter) {
         transactionsCommitOutCounter->Increment(counter);
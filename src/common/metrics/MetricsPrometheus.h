@@ -97,6 +97,17 @@ namespace OpenLogReplicator {
         prometheus::Family<prometheus::Gauge>* memoryAllocatedMb{nullptr};
         prometheus::Gauge* memoryAllocatedMbGauge{nullptr};
 
+        // memory_quota_changes
+        prometheus::Family<prometheus::Counter>* memoryQuotaChanges{nullptr};
+        prometheus::Counter* memoryQuotaChangesGrowCounter{nullptr};
+        prometheus::Counter* memoryQuotaChangesShrinkCounter{nullptr};
+
+        // memory_quota_mb
+        prometheus::Family<prometheus::Gauge>* memoryQuotaMb{nullptr};
+        prometheus::Gauge* memoryQuotaMbBuilderGauge{nullptr};
+        prometheus::Gauge* memoryQuotaMbReaderGauge{nullptr};
+        prometheus::Gauge* memoryQuotaMbSwapGauge{nullptr};
+
         // memory_used_total_mb
         prometheus::Family<prometheus::Gauge>* memoryUsedTotalMb{nullptr};
         prometheus::Gauge* memoryUsedTotalMbGauge{nullptr};
@@ -104,6 +115,7 @@ namespace OpenLogReplicator {
         // memory_used_mb
         prometheus::Family<prometheus::Gauge>* memoryUsedMb{nullptr};
         prometheus::Gauge* memoryUsedMbBuilderGauge{nullptr};
+        prometheus::Gauge* memoryUsedMbLobsGauge{nullptr};
         prometheus::Gauge* memoryUsedMbMiscGauge{nullptr};
         prometheus::Gauge* memoryUsedMbParserGauge{nullptr};
         prometheus::Gauge* memoryUsedMbReaderGauge{nullptr};
@@ -128,6 +140,18 @@ namespace OpenLogReplicator {
         prometheus::Family<prometheus::Gauge>* swapUsageMb{nullptr};
         prometheus::Gauge* swapUsageMbGauge{nullptr};
 
+        // swap_victims
+        prometheus::Family<prometheus::Counter>* swapVictims{nullptr};
+        prometheus::Counter* swapVictimsCounter{nullptr};
+
+        // swap_victim_idle_mb
+        prometheus::Family<prometheus::Gauge>* swapVictimIdleMb{nullptr};
+        prometheus::Gauge* swapVictimIdleMbGauge{nullptr};
+
+        // swap_victim_size_mb
+        prometheus::Family<prometheus::Gauge>* swapVictimSizeMb{nullptr};
+        prometheus::Gauge* swapVictimSizeMbGauge{nullptr};
+
         // transactions
         prometheus::Family<prometheus::Counter>* transactions{nullptr};
         prometheus::Counter* transactionsCommitOutCounter{nullptr};
@@ -196,11 +220,21 @@ namespace OpenLogReplicator {
         // memory_allocated_mb
         void emitMemoryAllocatedMb(int64_t gauge) override;
 
+        // memory_quota_changes
+        void emitMemoryQuotaChangesGrow(uint64_t counter) override;
+        void emitMemoryQuotaChangesShrink(uint64_t counter) override;
+
+        // memory_quota_mb
+        void emitMemoryQuotaMbBuilder(int64_t gauge) override;
+        void emitMemoryQuotaMbReader(int64_t gauge) override;
+        void emitMemoryQuotaMbSwap(int64_t gauge) override;
+
         // memory_used_total_mb
         void emitMemoryUsedTotalMb(int64_t gauge) override;
 
         // memory_used_mb
         void emitMemoryUsedMbBuilder(int64_t gauge) override;
+        void emitMemoryUsedMbLobs(int64_t gauge) override;
         void emitMemoryUsedMbMisc(int64_t gauge) override;
         void emitMemoryUsedMbParser(int64_t gauge) override;
         void emitMemoryUsedMbReader(int64_t gauge) override;
@@ -221,6 +255,15 @@ namespace OpenLogReplicator {
         // swap_usage_mb
         void emitSwapUsageMb(int64_t gauge) override;
 
+        // swap_victims
+        void emitSwapVictims(uint64_t counter) override;
+
+        // swap_victim_idle_mb
+        void emitSwapVictimIdleMb(int64_t gauge) override;
+
+        // swap_victim_size_mb
+        void emitSwapVictimSizeMb(int64_t gauge) override;
+
         // transactions
         void emitTransactionsCommitOut(uint64_t counter) override;
         void emitTransactionsRollbackOut(uint64_t counter) override;
@@ -17,6 +17,7 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <algorithm>
 #include <cctype>
 #include <string>
 
@@ -46,9 +47,167 @@ namespace OpenLogReplicator {
             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 
+    const char Data::map100[201]{
+            "0001020304050607080910111213141516171819"
+            "2021222324252627282930313233343536373839"
+            "4041424344454647484950515253545556575859"
+            "6061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899"};
+
+    const char Data::map256[513]{
+            "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+            "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+            "404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+            "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+            "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+            "a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+            "c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+            "e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff"};
+
+    const uint64_t Data::pow10[20]{
+            1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+            100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+            100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL};
+
     const int64_t Data::cumDays[12]{0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
     const int64_t Data::cumDaysLeap[12]{0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335};
 
+    bool Data::decimalToUnscaled(const char* text, uint64_t size, int precision, int scale, typeUInt128& value) {
+        typeUInt128 limit = 1;
+        for (int i = 0; i < precision && i < 38; ++i)
+            limit *= 10;
+
+        uint64_t pos = 0;
+        const bool minus = size > 0 && text[0] == '-';
+        if (minus)
+            ++pos;
+
+        value = 0;
+        int fraction = -1;
+        bool roundUp = false;
+        for (; pos < size; ++pos) {
+            if (text[pos] == '.') {
+                fraction = 0;
+                continue;
+            }
+            if (fraction >= 0) {
+                // Digits beyond the scale are rounded half away from zero, like Oracle does
+                if (fraction == scale) {
+                    roundUp = text[pos] >= '5';
+                    break;
+                }
+                ++fraction;
+            }
+            const uint digit = static_cast<uint>(text[pos] - '0');
+            if (value > (limit - 1 - digit) / 10)
+                return false;
+            value = (value * 10) + digit;
+        }
+
+        for (int i = std::max(fraction, 0); i < scale; ++i) {
+            if (value > (limit - 1) / 10)
+                return false;
+            value *= 10;
+        }
+
+        if (roundUp) {
+            if (value == limit - 1)
+                return false;
+            ++value;
+        }
+
+        if (minus)
+            value = ~value + 1;
+        return true;
+    }
+
+    uint64_t Data::numberToText(const uint8_t* data, uint64_t size, char* out) {
+        // Oracle NUMBER: exponent byte followed by base-100 digits, negative values are complemented and end with 0x66
+        if (unlikely(size == 0 || size > 22))
+            return 0;
+
+        if (data[0] == 0x80) {
+            out[0] = '0';
+            return 1;
+        }
+
+        const bool negative = data[0] < 0x80;
+        uint8_t digits[21];
+        uint64_t length = size - 1;
+        int64_t exponent;
+        char* ptr = out;
+
+        if (negative) {
+            if (length > 0 && data[size - 1] == 0x66)
+                --length;
+            exponent = 0x3E - static_cast<int64_t>(data[0]);
+            for (uint64_t i = 0; i < length; ++i) {
+                if (unlikely(data[i + 1] < 2 || data[i + 1] > 101))
+                    return 0;
+                digits[i] = 101 - data[i + 1];
+            }
+            *ptr++ = '-';
+        } else {
+            exponent = static_cast<int64_t>(data[0]) - 0xC1;
+            for (uint64_t i = 0; i < length; ++i) {
+                if (unlikely(data[i + 1] < 1 || data[i + 1] > 100))
+                    return 0;
+                digits[i] = data[i + 1] - 1;
+            }
+        }
+
+        while (length > 0 && digits[length - 1] == 0)
+            --length;
+        if (unlikely(length == 0 || length > 20))
+            return 0;
+
+        // Integer below 10^18
+        if (exponent >= static_cast<int64_t>(length) - 1 && exponent <= 8) {
+            uint64_t value = 0;
+            for (int64_t i = 0; i <= exponent; ++i)
+                value = (value * 100) + (i < static_cast<int64_t>(length) ? digits[i] : 0);
+            const uint valueLength = decLength(value);
+            writeDec(ptr, value, valueLength);
+            return (ptr - out) + valueLength;
+        }
+
+        if (exponent < 0) {
+            *ptr++ = '0';
+            *ptr++ = '.';
+            for (int64_t i = exponent + 1; i < 0; ++i) {
+                *ptr++ = '0';
+                *ptr++ = '0';
+            }
+        } else {
+            if (digits[0] < 10) {
+                *ptr++ = map10(digits[0]);
+            } else {
+                *ptr++ = map100[digits[0] * 2];
+                *ptr++ = map100[(digits[0] * 2) + 1];
+            }
+
+            for (int64_t i = 1; i <= exponent; ++i) {
+                const uint pair = (i < static_cast<int64_t>(length) ? digits[i] : 0) * 2;
+                *ptr++ = map100[pair];
+                *ptr++ = map100[pair + 1];
+            }
+
+            if (static_cast<int64_t>(length) <= exponent + 1)
+                return ptr - out;
+            *ptr++ = '.';
+        }
+
+        for (uint64_t i = (exponent < 0 ? 0 : exponent + 1); i < length; ++i) {
+            *ptr++ = map100[digits[i] * 2];
+            *ptr++ = map100[(digits[i] * 2) + 1];
+        }
+
+        // The last digit pair is not zero, but it can end with zero
+        if (*(ptr - 1) == '0')
+            --ptr;
+        return ptr - out;
+    }
+
     bool Data::parseTimezone(std::string str, int64_t& out) {
         if (str == "Etc/GMT-14") str = "-14:00"; else
         if (str == "Etc/GMT-13") str = "-13:00"; else
@@ -407,6 +566,42 @@ namespace OpenLogReplicator {
         return ss;
     }
 
+    // Same escaping as the JSON builder output, used for precomputed name fragments
+    void Data::writeEscapeJson(std::string& out, const std::string& str) {
+        for (const char c : str) {
+            switch (c) {
+                case '\t':
+                    out.append("\\t");
+                    break;
+                case '\r':
+                    out.append("\\r");
+                    break;
+                case '\n':
+                    out.append("\\n");
+                    break;
+                case '\f':
+                    out.append("\\f");
+                    break;
+                case '\b':
+                    out.append("\\b");
+                    break;
+                case '"':
+                case '\\':
+                case '/':
+                    out.push_back('\\');
+                    out.push_back(c);
+                    break;
+                default:
+                    if (static_cast<uint8_t>(c) < 0x20) {
+                        out.append("\\u00");
+                        out.push_back(map16((c >> 4) & 0x0F));
+                        out.push_back(map16(c & 0x0F));
+                    } else
+                        out.push_back(c);
+            }
+        }
+    }
+
     bool Data::checkNameCase(const std::string& name) {
         if (unlikely(name.length() >= 1024))
             throw DataException(20004, "identifier '" + std::string(name) + "' is too long");
@@ -51,6 +51,10 @@ namespace OpenLogReplicator {
     public:
         static const char map64L[65];
         static const char map64R[256];
+        // Two characters for every value: decimal 00-99 and hex 00-ff
+        static const char map100[201];
+        static const char map256[513];
+        static const uint64_t pow10[20];
 
         static const int64_t cumDays[12];
         static const int64_t cumDaysLeap[12];
@@ -75,11 +79,55 @@ namespace OpenLogReplicator {
             return map64L[x];
         }
 
+        static uint decLength(uint64_t value) {
+            // Estimate from bit length, corrected with a single comparison
+            const uint bits = 64 - __builtin_clzll(value | 1);
+            const uint length = (bits * 1233) >> 12;
+            return length + ((value | 1) >= pow10[length] ? 1 : 0);
+        }
+
+        // Writes exactly length digits, leading digits are cut or filled with zeros
+        static void writeDec(char* out, uint64_t value, uint length) {
+            char* ptr = out + length;
+            while (length >= 2) {
+                const uint64_t pair = (value % 100) * 2;
+                value /= 100;
+                *--ptr = map100[pair + 1];
+                *--ptr = map100[pair];
+                length -= 2;
+            }
+            if (length == 1)
+                *--ptr = map10(value % 10);
+        }
+
+        // Writes exactly length lowercase hex digits
+        static void writeHex(char* out, uint64_t value, uint length) {
+            char* ptr = out + length;
+            while (length >= 2) {
+                const uint64_t pair = (value & 0xFF) * 2;
+                value >>= 8;
+                *--ptr = map256[pair + 1];
+                *--ptr = map256[pair];
+                length -= 2;
+            }
+            if (length == 1)
+                *--ptr = map16(value & 0xF);
+        }
+
+        // Oracle NUMBER +infinity is 0xFF 0x65 and -infinity is a single 0x00 byte, they have no decimal text
+        static bool isNumberInfinity(const uint8_t* data, uint64_t size) {
+            return (size == 1 && data[0] == 0x00) || (size == 2 && data[0] == 0xFF && data[1] == 0x65);
+        }
+
+        static uint64_t numberToText(const uint8_t* data, uint64_t size, char* out);
+        // Decimal text is converted to an unscaled two's complement value rounded to the scale, false when it doesn't fit in the precision
+        static bool decimalToUnscaled(const char* text, uint64_t size, int precision, int scale, typeUInt128& value);
         static bool parseTimezone(std::string str, int64_t& out);
         static std::string timezoneToString(int64_t tz);
         static time_t valuesToEpoch(int year, int month, int day, int hour, int minute, int second, int tz);
         static uint64_t epochToIso8601(time_t timestamp, char* buffer, bool addT, bool addZ);
         static std::ostringstream& writeEscapeValue(std::ostringstream& ss, const std::string& str);
+        static void writeEscapeJson(std::string& out, const std::string& str);
         static bool checkNameCase(const std::string& name);
     };
 }
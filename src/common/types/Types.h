@@ -69,6 +69,7 @@ using typeUnicode = uint64_t;
 using time_ut = int64_t;
 using typeMask = uint64_t;
 using uint = unsigned int;
+__extension__ typedef unsigned __int128 typeUInt128;
 
 #define likely(x)                               __builtin_expect(!!(x),1)
 #define unlikely(x)                             __builtin_expect(!!(x),0)
@@ -216,7 +216,7 @@ namespace OpenLogReplicator {
         // Suspend transaction processing for the schema update
         {
             contextSet(Thread::CONTEXT::TRAN, Thread::REASON::TRAN);
-            std::unique_lock<std::mutex> const lckTransaction(metadata->mtxTransaction);
+            std::unique_lock<std::shared_mutex> const lckTransaction(metadata->mtxTransaction);
             metadata->commitElements();
             metadata->schema->purgeMetadata();
 
@@ -226,7 +226,7 @@ namespace OpenLogReplicator {
 
             std::vector<std::string> msgs;
             std::unordered_map<typeObj, std::string> tablesUpdated;
-            metadata->buildMaps(msgs, tablesUpdated);
+            metadata->buildMaps(msgs, tablesUpdated, false);
             for (const auto& msg: msgs)
                 ctx->info(0, msg);
             for (const auto& [_, tableName]: tablesUpdated)
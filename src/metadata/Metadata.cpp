@@ -242,15 +242,15 @@ namespace OpenLogReplicator {
         newSchemaElements.clear();
     }
 
-    void Metadata::buildMaps(std::vector<std::string>& msgs, std::unordered_map<typeObj, std::string>& tablesUpdated) {
+    void Metadata::buildMaps(std::vector<std::string>& msgs, std::unordered_map<typeObj, std::string>& tablesUpdated, bool afterDdl) {
         for (const SchemaElement* element: schemaElements) {
             if (ctx->isLogLevelAt(Ctx::LOG::DEBUG))
                 msgs.push_back("- creating table schema for owner: " + element->owner + " table: " + element->table + " options: " +
                                std::to_string(static_cast<uint>(element->options)));
 
             schema->buildMaps(element->owner, element->table, element->keyList, element->key, element->tagType, element->tagList, element->tag,
-                              element->condition, element->options, tablesUpdated, suppLogDbPrimary, suppLogDbAll, defaultCharacterMapId,
-                              defaultCharacterNcharMapId);
+                              element->columnsType, element->columnsList, element->condition, element->options, tablesUpdated, suppLogDbPrimary,
+                              suppLogDbAll, defaultCharacterMapId, defaultCharacterNcharMapId, afterDdl);
         }
     }
 
@@ -19,6 +19,7 @@
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
 #include <set>
+#include <shared_mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -117,7 +118,7 @@ namespace OpenLogReplicator {
         std::set<RedoLog*> redoLogs; // 重做日志文件集合
 
         // 事务架构一致性互斥锁
-        std::mutex mtxTransaction;
+        std::shared_mutex mtxTransaction;
 
         // 检查点信息及其互斥锁
         std::mutex mtxCheckpoint;
@@ -299,8 +300,9 @@ namespace OpenLogReplicator {
          * 
          * @param msgs 消息列表
          * @param tablesUpdated 已更新表映射
+         * @param afterDdl DDL变更后重建，条件中缺失的列按NULL处理
          */
-        void buildMaps(std::vector<std::string>& msgs, std::unordered_map<typeObj, std::string>& tablesUpdated);
+        void buildMaps(std::vector<std::string>& msgs, std::unordered_map<typeObj, std::string>& tablesUpdated, bool afterDdl);
 
         /**
          * 等待写入器线程
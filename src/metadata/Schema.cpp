@@ -485,15 +485,14 @@ namespace OpenLogReplicator {
     }
 
     void Schema::updateXmlCtx() {
+        // Called with the schema lock held, flush threads are drained before a system transaction
         if (ctx->isFlagSet(Ctx::REDO_FLAGS::EXPERIMENTAL_XMLTYPE)) {
             xmlCtxDefault = nullptr;
-            auto schemaXmlMapIt = schemaXmlMap.cbegin();
-            while (schemaXmlMapIt != schemaXmlMap.cend()) {
-                if (schemaXmlMapIt->second->flags == 0) {
-                    xmlCtxDefault = schemaXmlMapIt->second;
-                    break;
-                }
-                ++schemaXmlMapIt;
+            for (const auto& [_, schemaXmlCtx]: schemaXmlMap) {
+                if (schemaXmlCtx->tokensChanged)
+                    schemaXmlCtx->buildTokenCache();
+                if (xmlCtxDefault == nullptr && schemaXmlCtx->flags == 0)
+                    xmlCtxDefault = schemaXmlCtx;
             }
             if (unlikely(xmlCtxDefault == nullptr))
                 throw DataException(50069, "no active XML context found");
@@ -502,8 +501,9 @@ namespace OpenLogReplicator {
 
     void Schema::buildMaps(const std::string& owner, const std::string& table, const std::vector<std::string>& keyList, const std::string& key,
                            SchemaElement::TAG_TYPE tagType, const std::vector<std::string>& tagList, const std::string& tag __attribute__((unused)),
-                           const std::string& condition, DbTable::OPTIONS options, std::unordered_map<typeObj, std::string>& tablesUpdated, bool suppLogDbPrimary,
-                           bool suppLogDbAll, uint64_t defaultCharacterMapId, uint64_t defaultCharacterNcharMapId) {
+                           SchemaElement::COLUMNS_TYPE columnsType, const std::vector<std::string>& columnsList, const std::string& condition,
+                           DbTable::OPTIONS options, std::unordered_map<typeObj, std::string>& tablesUpdated, bool suppLogDbPrimary, bool suppLogDbAll,
+                           uint64_t defaultCharacterMapId, uint64_t defaultCharacterNcharMapId, bool afterDdl) {
         const std::regex regexOwner(owner);
         const std::regex regexTable(table);
         char sysLobConstraintName[26]{"SYS_LOB0000000000C00000$$"};
@@ -728,6 +728,7 @@ namespace OpenLogReplicator {
                 }
 
                 //typeCol tagCol = -1;
+                bool tagColumn = false;
                 // Part of a defined tag
                 switch (tagType) {
                     case SchemaElement::TAG_TYPE::NONE:
@@ -737,6 +738,7 @@ namespace OpenLogReplicator {
                         if (numPk > 0) {
                             //tagCol = tableTmp->tagCols.size();
                             tableTmp->tagCols.push_back(sysCol->segCol);
+                            tagColumn = true;
                         }
                         break;
 
@@ -747,6 +749,7 @@ namespace OpenLogReplicator {
 
                             //tagCol = x;
                             tableTmp->tagCols[x] = sysCol->segCol;
+                            tagColumn = true;
                             break;
                         }
                         break;
@@ -755,6 +758,7 @@ namespace OpenLogReplicator {
                     case SchemaElement::TAG_TYPE::ALL:
                         //tagCol = tableTmp->tagCols.size();
                         tableTmp->tagCols.push_back(sysCol->segCol);
+                        tagColumn = true;
                         break;
                 }
 
@@ -784,6 +788,20 @@ namespace OpenLogReplicator {
 
                 tableTmp->addColumn(columnTmp);
                 columnTmp = nullptr;
+
+                // Column projection - primary key, tag and guard columns are always kept
+                if (columnsType != SchemaElement::COLUMNS_TYPE::NONE && numPk == 0 && !tagColumn && !sysCol->isGuard()) {
+                    bool listed = false;
+                    for (const auto& val: columnsList) {
+                        if (columnName == val) {
+                            listed = true;
+                            break;
+                        }
+                    }
+
+                    if ((columnsType == SchemaElement::COLUMNS_TYPE::INCLUDE) != listed)
+                        tableTmp->skipColumn(sysCol->segCol - static_cast<typeCol>(1));
+                }
             }
             if (unlikely(tableTmp->columns.size() < static_cast<size_t>(tableTmp->maxSegCol))) {
                 ctx->warning(50073, "table " + std::string(sysUser->name) + "." + sysObj->name + " - missmatch in column details: " +
@@ -944,10 +962,15 @@ namespace OpenLogReplicator {
                         throw DataException(10041, "table " + std::string(sysUser->name) + "." + sysObj->name + " - couldn't find all tag sets (" +
                                                    tagList[x] + ")");
 
+            // Columns referenced by the condition are kept, even if not selected for output
+            tableTmp->setCondition(ctx, condition, afterDdl);
+
             std::ostringstream ss;
             ss << sysUser->name << "." << sysObj->name << " (dataobj: " << std::dec << sysTab->dataObj << ", obj: " << std::dec << sysObj->obj <<
                ", columns: " << std::dec << tableTmp->maxSegCol << ", lobs: " << std::dec << tableTmp->totalLobs << lobList.str() <<
                ", lob-idx: " << std::dec << lobIndexes << lobIndexesList.str() << ")";
+            if (tableTmp->columnsSkipped > 0)
+                ss << ", skipped columns: " << std::dec << tableTmp->columnsSkipped;
             if (sysTab->isClustered())
                 ss << ", part of cluster";
             if (sysTab->isPartitioned())
@@ -976,7 +999,6 @@ namespace OpenLogReplicator {
             }
             tablesUpdated[sysObj->obj] = ss.str();
 
-            tableTmp->setCondition(condition);
             addTableToDict(tableTmp);
             tableTmp = nullptr;
         }
@@ -36,6 +36,15 @@ namespace OpenLogReplicator {
             LIST   // 指定列列表
         };
 
+        /**
+         * 列投影类型枚举
+         */
+        enum class COLUMNS_TYPE : unsigned char {
+            NONE,    // 输出所有列
+            INCLUDE, // 仅输出列表中的列
+            EXCLUDE  // 不输出列表中的列
+        };
+
         std::string condition;       // 过滤条件
         std::string key;             // 键定义(逗号分隔)
         std::string owner;           // 表所有者
@@ -43,8 +52,10 @@ namespace OpenLogReplicator {
         std::string tag;             // 标签定义
         DbTable::OPTIONS options;    // 表选项
         TAG_TYPE tagType{TAG_TYPE::NONE}; // 标签类型
+        COLUMNS_TYPE columnsType{COLUMNS_TYPE::NONE}; // 列投影类型
         std::vector<std::string> keyList; // 键列表
         std::vector<std::string> tagList; // 标签列表
+        std::vector<std::string> columnsList; // 列投影列表
 
         /**
          * 构造函数
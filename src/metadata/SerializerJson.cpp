@@ -719,7 +719,7 @@ namespace OpenLogReplicator {
                 }
 
                 // 从配置文件加载Schema
-                metadata->buildMaps(msgs, tablesUpdated);
+                metadata->buildMaps(msgs, tablesUpdated, false);
                 metadata->schema->resetTouched();
                 metadata->schema->loaded = true;
                 return true;
@@ -364,7 +364,12 @@ namespace OpenLogReplicator {
                         --lwnRecords;
                     }
 
+                    // All transactions committed in this LWN must be sent before the checkpoint
+                    transactionBuffer->flushWait(ctx->parserThread);
+
                     if (lwnScn > metadata->firstDataScn) {
+                        transactionBuffer->stream(lwnScn, sequence, lwnTimestamp.toEpoch(ctx->hostTimezone));
+
                         if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
                             ctx->logTrace(Ctx::TRACE::CHECKPOINT, "on: " + lwnScn.toString());
                         builder->processCheckpoint(lwnScn, sequence, lwnTimestamp.toEpoch(ctx->hostTimezone),
@@ -374,6 +379,7 @@ namespace OpenLogReplicator {
                         FileOffset minFileOffset;
                         Xid minXid;
                         transactionBuffer->checkpoint(minSequence, minFileOffset, minXid);
+                        transactionBuffer->evictOrphanedLobs();
                         if (unlikely(ctx->isTraceSet(Ctx::TRACE::LWN)))
                             ctx->logTrace(Ctx::TRACE::LWN, "* checkpoint: " + lwnScn.toString());
                         metadata->checkpoint(ctx->parserThread, lwnScn, lwnTimestamp, sequence, FileOffset(currentBlock, reader->getBlockSize()),
@@ -427,6 +433,7 @@ namespace OpenLogReplicator {
             }
 
             if (ctx->softShutdown) {
+                transactionBuffer->flushWait(ctx->parserThread);
                 if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
                     ctx->logTrace(Ctx::TRACE::CHECKPOINT, "on: " + lwnScn.toString() + " at exit");
                 builder->processCheckpoint(lwnScn, sequence, lwnTimestamp.toEpoch(ctx->hostTimezone),
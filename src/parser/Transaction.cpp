@@ -32,7 +32,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "TransactionBuffer.h"
 
 namespace OpenLogReplicator {
-    Transaction::Transaction(Xid newXid, std::map<LobKey, uint8_t*>* newOrphanedLobs, XmlCtx* newXmlCtx) :
+    Transaction::Transaction(Xid newXid, OrphanedLobs* newOrphanedLobs, XmlCtx* newXmlCtx) :
             xmlCtx(newXmlCtx),
             xid(newXid) {
         lobCtx.orphanedLobs = newOrphanedLobs;
@@ -176,42 +176,145 @@ namespace OpenLogReplicator {
                                       " empty buffer, offset: " + redoLogRecord1->fileOffset.toString() + ", xid: " + xid.toString() + ", pos: 1");
     }
 
-    void Transaction::flush(Metadata* metadata, Builder* builder, Scn lwnScn) {
-        metadata->ctx->swappedMemoryFlush(metadata->ctx->parserThread, xid);
-        bool opFlush;
-        const uint64_t maxMessageMb = builder->getMaxMessageMb();
-        metadata->ctx->parserThread->contextSet(Thread::CONTEXT::TRAN, Thread::REASON::TRAN);
-        std::unique_lock<std::mutex> const lckTransaction(metadata->mtxTransaction);
+    void Transaction::rollbackStream(const Ctx* ctx) {
+        if (streamChunk == 0 && streamElement == 0)
+            return;
+
+        // The last operation of the last chunk is removed, check if it was already sent as provisional
+        const uint64_t chunk = ctx->swappedMemorySize(ctx->parserThread, xid) - 1;
+        const uint64_t element = lastTc->elements - 1;
+        if (chunk > streamChunk || (chunk == streamChunk && element >= streamElement))
+            return;
+
+        // Sent operations can't be corrected, streaming stops and the whole transaction is sent again with the commit.
+        // Streamed chunks are kept until commit, so the operations before the savepoint are still available
+        streamChunk = 0;
+        streamElement = 0;
+        streamPos = 0;
+        streamUndone = true;
+    }
+
+    void Transaction::streamDiscard(Metadata* metadata, Builder* builder, Scn scn, Scn lwnScn, Seq sequence, time_t timestamp) {
+        // Provisional output can't be corrected, the consumer is told to drop the staged parts which are sent again
+        metadata->ctx->warning(60038, "transaction rolled back partially after provisional output, staged parts sent again with commit, xid: " +
+                                      xid.toString());
+        builder->processBegin(xid, scn, lwnScn, &attributes);
+        builder->processRollback(scn, sequence, timestamp);
+        streamUndone = false;
+    }
+
+    void Transaction::flush(Thread* t, Metadata* metadata, Builder* builder, Scn lwnScn) {
+        metadata->ctx->swappedMemoryFlush(t, xid);
+        t->contextSet(Thread::CONTEXT::TRAN, Thread::REASON::TRAN);
+        std::shared_lock<std::shared_mutex> const lckTransaction(metadata->mtxTransaction);
         std::unique_lock<std::mutex> lckSchema(metadata->mtxSchema, std::defer_lock);
 
         if (opCodes == 0 || rollback) {
-            metadata->ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+            // Provisional data already sent must be discarded by the consumer
+            if (streamed) {
+                builder->processBegin(xid, commitScn, lwnScn, &attributes);
+                builder->processRollback(commitScn, commitSequence, commitTimestamp.toEpoch(metadata->ctx->hostTimezone));
+            }
+            t->contextSet(Thread::CONTEXT::CPU);
             return;
         }
         if (unlikely(metadata->ctx->isTraceSet(Ctx::TRACE::TRANSACTION)))
             metadata->ctx->logTrace(Ctx::TRACE::TRANSACTION, toString(metadata->ctx));
 
         if (system) {
-            metadata->ctx->parserThread->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_SYSTEM);
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_SYSTEM);
             lckSchema.lock();
-            metadata->ctx->parserThread->contextSet(Thread::CONTEXT::TRAN, Thread::REASON::TRAN);
+            t->contextSet(Thread::CONTEXT::TRAN, Thread::REASON::TRAN);
 
             if (unlikely(builder->systemTransaction != nullptr))
                 throw RedoLogException(50056, "system transaction already active");
             builder->systemTransaction = new SystemTransaction(builder, metadata);
             metadata->schema->scn = commitScn;
         }
+        if (streamUndone)
+            streamDiscard(metadata, builder, commitScn, lwnScn, commitSequence, commitTimestamp.toEpoch(metadata->ctx->hostTimezone));
+        builder->packReserve(size + TransactionChunk::DATA_BUFFER_SIZE);
         builder->processBegin(xid, commitScn, lwnScn, &attributes);
 
+        const uint64_t mMax = metadata->ctx->swappedMemorySize(t, xid);
+        flushChunks(t, metadata, builder, commitScn, lwnScn, commitSequence, commitTimestamp.toEpoch(metadata->ctx->hostTimezone), mMax, false);
+
+        for (auto k: deallocChunks)
+            metadata->ctx->swappedMemoryRelease(t, xid, k);
+        deallocChunks.clear();
+
+        opCodes = 0;
+        streamChunk = 0;
+        streamElement = 0;
+        streamPos = 0;
+        streamUndone = false;
+
+        if (system) {
+            builder->systemTransaction->commit(commitScn);
+            delete builder->systemTransaction;
+            builder->systemTransaction = nullptr;
+            metadata->schema->scn = commitScn;
+
+            // Unlock schema
+            lckSchema.unlock();
+        }
+        builder->processCommit(commitScn, commitSequence, commitTimestamp.toEpoch(metadata->ctx->hostTimezone));
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void Transaction::stream(Metadata* metadata, Builder* builder, Scn lwnScn, Seq sequence, time_t timestamp) {
+        const uint64_t streamTransactionMb = builder->getStreamTransactionMb();
+        if (streamTransactionMb == 0 || opCodes == 0 || rollback || system || schema || streamUndone)
+            return;
+
+        // The last chunk is still appended to, stream only full chunks
+        const uint64_t mMax = metadata->ctx->swappedMemorySize(metadata->ctx->parserThread, xid);
+        if (mMax < streamChunk + streamTransactionMb + 1)
+            return;
+
+        if (unlikely(metadata->ctx->isTraceSet(Ctx::TRACE::TRANSACTION)))
+            metadata->ctx->logTrace(Ctx::TRACE::TRANSACTION, "stream xid: " + xid.toString() + " chunks: " + std::to_string(streamChunk) + " to " +
+                                                             std::to_string(mMax - 2));
+
+        const uint64_t oldStreamChunk = streamChunk;
+        const uint64_t oldStreamElement = streamElement;
+        metadata->ctx->swappedMemoryFlush(metadata->ctx->parserThread, xid);
+        {
+            metadata->ctx->parserThread->contextSet(Thread::CONTEXT::TRAN, Thread::REASON::TRAN);
+            std::shared_lock<std::shared_mutex> const lckTransaction(metadata->mtxTransaction);
+
+            builder->processBegin(xid, lwnScn, lwnScn, &attributes);
+            flushChunks(metadata->ctx->parserThread, metadata, builder, lwnScn, lwnScn, sequence, timestamp, mMax - 1, true);
+            builder->processProvisional(lwnScn, sequence, timestamp);
+
+            // Sent chunks are kept until commit, a rollback to a savepoint may require sending them again
+            deallocChunks.clear();
+        }
+        metadata->ctx->swappedMemoryFlushEnd(metadata->ctx->parserThread, xid);
+        metadata->ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+
+        if (streamChunk != oldStreamChunk || streamElement != oldStreamElement)
+            streamed = true;
+    }
+
+    void Transaction::flushChunks(Thread* t, Metadata* metadata, Builder* builder, Scn scn, Scn lwnScn, Seq sequence, time_t timestamp, uint64_t mEnd,
+                                  bool provisional) {
+        bool opFlush;
+        const uint64_t maxMessageMb = builder->getMaxMessageMb();
         Format::TRANSACTION_TYPE transactionType = Format::TRANSACTION_TYPE::T_NONE;
         std::deque<const RedoLogRecord*> redo1;
         std::deque<const RedoLogRecord*> redo2;
 
-        const uint64_t mMax = metadata->ctx->swappedMemorySize(metadata->ctx->parserThread, xid);
-        for (uint64_t m = 0; m < mMax; ++m) {
-            auto* const tc = reinterpret_cast<TransactionChunk*>(metadata->ctx->swappedMemoryGet(metadata->ctx->parserThread, xid, m));
+        for (uint64_t m = streamChunk; m < mEnd; ++m) {
+            auto* const tc = reinterpret_cast<TransactionChunk*>(metadata->ctx->swappedMemoryGet(t, xid, m));
             uint64_t pos = 0;
-            for (uint64_t i = 0; i < tc->elements; ++i) {
+            uint64_t i = 0;
+            if (m == streamChunk) {
+                // Skip operations already sent as provisional
+                pos = streamPos;
+                i = streamElement;
+            }
+            for (; i < tc->elements; ++i) {
                 typeOp2 const op = *reinterpret_cast<const typeOp2*>(tc->buffer + pos);
 
                 auto* redoLogRecord1 = reinterpret_cast<RedoLogRecord*>(tc->buffer + pos + TransactionBuffer::ROW_HEADER_DATA0);
@@ -373,7 +476,7 @@ namespace OpenLogReplicator {
                         for (typeSize j = start; j < redoLogRecord2->indKeyDataSize; j += 4) {
                             const typeDba page = Ctx::read32Big(redoLogRecord2->data(redoLogRecord2->indKeyData + j));
                             if (page > 0) {
-                                lobCtx.setPage(redoLogRecord2->lobId, page, pageNo, xid, redoLogRecord1->fileOffset);
+                                lobCtx.setPage(redoLogRecord2->lobId, page, pageNo);
                                 pages << " [0x" << std::setfill('0') << std::setw(8) << std::hex << page << "]";
                             }
                             ++pageNo;
@@ -463,7 +566,7 @@ namespace OpenLogReplicator {
                         }
 
                         if ((redoLogRecord1->suppLogFb & RedoLogRecord::FB_L) != 0) {
-                            builder->processDml(redo2.front()->scnRecord, commitSequence, commitTimestamp.toEpoch(metadata->ctx->hostTimezone),
+                            builder->processDml(redo2.front()->scnRecord, sequence, timestamp,
                                                 &lobCtx, xmlCtx, redo1, redo2, transactionType, system, schema, dump);
                             opFlush = true;
                         }
@@ -471,23 +574,23 @@ namespace OpenLogReplicator {
 
                     case 0x05010B0B:
                         // Insert multiple rows
-                        builder->processInsertMultiple(redoLogRecord2->scnRecord, commitSequence,
-                                                       commitTimestamp.toEpoch(metadata->ctx->hostTimezone), &lobCtx, xmlCtx, redoLogRecord1,
+                        builder->processInsertMultiple(redoLogRecord2->scnRecord, sequence,
+                                                       timestamp, &lobCtx, xmlCtx, redoLogRecord1,
                                                        redoLogRecord2, system, schema, dump);
                         opFlush = true;
                         break;
 
                     case 0x05010B0C:
                         // Delete multiple rows
-                        builder->processDeleteMultiple(redoLogRecord2->scnRecord, commitSequence,
-                                                       commitTimestamp.toEpoch(metadata->ctx->hostTimezone), &lobCtx, xmlCtx, redoLogRecord1,
+                        builder->processDeleteMultiple(redoLogRecord2->scnRecord, sequence,
+                                                       timestamp, &lobCtx, xmlCtx, redoLogRecord1,
                                                        redoLogRecord2, system, schema, dump);
                         opFlush = true;
                         break;
 
                     case 0x18010000:
                         // DDL operation
-                        builder->processDdl(commitScn, commitSequence, commitTimestamp.toEpoch(metadata->ctx->hostTimezone), redoLogRecord1);
+                        builder->processDdl(scn, sequence, timestamp, redoLogRecord1);
                         opFlush = true;
                         break;
 
@@ -504,7 +607,7 @@ namespace OpenLogReplicator {
                     if (system) {
                         if (unlikely(metadata->ctx->isTraceSet(Ctx::TRACE::SYSTEM)))
                             metadata->ctx->logTrace(Ctx::TRACE::SYSTEM, "commit");
-                        builder->systemTransaction->commit(commitScn);
+                        builder->systemTransaction->commit(scn);
                         delete builder->systemTransaction;
                         builder->systemTransaction = nullptr;
 
@@ -513,8 +616,11 @@ namespace OpenLogReplicator {
                         builder->systemTransaction = new SystemTransaction(builder, metadata);
                     }
 
-                    builder->processCommit(commitScn, commitSequence, commitTimestamp.toEpoch(metadata->ctx->hostTimezone));
-                    builder->processBegin(xid, commitScn, lwnScn, &attributes);
+                    if (provisional)
+                        builder->processProvisional(scn, sequence, timestamp);
+                    else
+                        builder->processCommit(scn, sequence, timestamp);
+                    builder->processBegin(xid, scn, lwnScn, &attributes);
                 }
 
                 if (opFlush) {
@@ -522,43 +628,34 @@ namespace OpenLogReplicator {
                     redo2.clear();
                     transactionType = Format::TRANSACTION_TYPE::T_NONE;
 
-                    for (auto k: deallocChunks)
-                        metadata->ctx->swappedMemoryRelease(metadata->ctx->parserThread, xid, k);
+                    if (!provisional)
+                        for (auto k: deallocChunks)
+                            metadata->ctx->swappedMemoryRelease(t, xid, k);
                     deallocChunks.clear();
+
+                    // Remember where the next provisional part or the final flush starts
+                    if (provisional) {
+                        if (i + 1 == tc->elements) {
+                            streamChunk = m + 1;
+                            streamElement = 0;
+                            streamPos = 0;
+                        } else {
+                            streamChunk = m;
+                            streamElement = i + 1;
+                            streamPos = pos;
+                        }
+                    }
                 }
             }
 
             deallocChunks.push_back(m);
         }
-
-        for (auto k: deallocChunks)
-            metadata->ctx->swappedMemoryRelease(metadata->ctx->parserThread, xid, k);
-        deallocChunks.clear();
-
-        opCodes = 0;
-
-        if (system) {
-            builder->systemTransaction->commit(commitScn);
-            delete builder->systemTransaction;
-            builder->systemTransaction = nullptr;
-            metadata->schema->scn = commitScn;
-
-            // Unlock schema
-            lckSchema.unlock();
-        }
-        builder->processCommit(commitScn, commitSequence, commitTimestamp.toEpoch(metadata->ctx->hostTimezone));
-        metadata->ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
     }
 
     void Transaction::purge(Ctx* ctx) {
         ctx->swappedMemoryRemove(ctx->parserThread, xid);
         deallocChunks.clear();
 
-        if (mergeBuffer != nullptr) {
-            delete[] mergeBuffer;
-            mergeBuffer = nullptr;
-        }
-
         lobCtx.purge();
 
         size = 0;
@@ -20,14 +20,14 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #ifndef TRANSACTION_H_
 #define TRANSACTION_H_
 
-#include <map>
 #include <unordered_map>
 #include <vector>
 
-#include "../common/LobKey.h"
 #include "../common/LobCtx.h"
+#include "../common/OrphanedLobs.h"
 #include "../common/RedoLogRecord.h"
 #include "../common/types/FileOffset.h"
+#include "../common/types/Scn.h"
 #include "../common/types/Time.h"
 #include "../common/types/Types.h"
 #include "../common/types/Xid.h"
@@ -36,6 +36,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     class Builder;
     class Metadata;
+    class Thread;
     class TransactionBuffer;
     struct TransactionChunk;
     class XmlCtx;
@@ -44,9 +45,16 @@ namespace OpenLogReplicator {
     protected:
         std::vector<uint64_t> deallocChunks;
         uint64_t opCodes{0};
+        uint64_t streamChunk{0};
+        uint64_t streamElement{0};
+        uint64_t streamPos{0};
+        bool streamUndone{false};
+
+        void flushChunks(Thread* t, Metadata* metadata, Builder* builder, Scn scn, Scn lwnScn, Seq sequence, time_t timestamp, uint64_t mEnd,
+                         bool provisional);
+        void streamDiscard(Metadata* metadata, Builder* builder, Scn scn, Scn lwnScn, Seq sequence, time_t timestamp);
 
     public:
-        uint8_t* mergeBuffer{nullptr};
         LobCtx lobCtx;
         XmlCtx* xmlCtx;
         Xid xid;
@@ -63,19 +71,22 @@ namespace OpenLogReplicator {
         bool shutdown{false};
         bool lastSplit{false};
         bool dump{false};
+        bool streamed{false};
         typeTransactionSize size{0};
 
         // Attributes
         std::unordered_map<std::string, std::string> attributes;
 
-        explicit Transaction(Xid newXid, std::map<LobKey, uint8_t*>* newOrphanedLobs, XmlCtx* newXmlCtx);
+        explicit Transaction(Xid newXid, OrphanedLobs* newOrphanedLobs, XmlCtx* newXmlCtx);
 
         void add(const Metadata* metadata, TransactionBuffer* transactionBuffer, RedoLogRecord* redoLogRecord1);
         void add(const Metadata* metadata, TransactionBuffer* transactionBuffer, RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2);
         void rollbackLastOp(const Metadata* metadata, TransactionBuffer* transactionBuffer, const RedoLogRecord* redoLogRecord1,
                             const RedoLogRecord* redoLogRecord2);
         void rollbackLastOp(const Metadata* metadata, TransactionBuffer* transactionBuffer, const RedoLogRecord* redoLogRecord1);
-        void flush(Metadata* metadata, Builder* builder, Scn lwnScn);
+        void rollbackStream(const Ctx* ctx);
+        void flush(Thread* t, Metadata* metadata, Builder* builder, Scn lwnScn);
+        void stream(Metadata* metadata, Builder* builder, Scn lwnScn, Seq sequence, time_t timestamp);
         void purge(Ctx* ctx);
 
         void log(const Ctx* ctx, const char* msg, const RedoLogRecord* redoLogRecord1) const {
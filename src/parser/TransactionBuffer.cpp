@@ -20,6 +20,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <cstddef>
 #include <cstring>
 
+#include "../builder/Builder.h"
 #include "../common/RedoLogRecord.h"
 #include "../common/Thread.h"
 #include "../common/exception/RedoLogException.h"
@@ -28,21 +29,42 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "OpCode050B.h"
 #include "Transaction.h"
 #include "TransactionBuffer.h"
+#include "TransactionFlusher.h"
 
 namespace OpenLogReplicator {
-    TransactionBuffer::TransactionBuffer(Ctx* newCtx) :
-            ctx(newCtx) {
-        buffer[0] = 0;
+    TransactionBuffer::TransactionBuffer(Ctx* newCtx, std::string newAlias, uint64_t newFlushThreads) :
+            ctx(newCtx),
+            alias(std::move(newAlias)),
+            orphanedLobs(newCtx),
+            flushThreads(newFlushThreads) {
+        mergeBuffer[0] = 0;
     }
 
     TransactionBuffer::~TransactionBuffer() {
+        for (TransactionFlusher* flusher: flushers)
+            delete flusher;
+        flushers.clear();
+
+        for (const FlushRequest& request: flushQueue) {
+            request.transaction->purge(ctx);
+            delete request.transaction;
+        }
+        flushQueue.clear();
+
         skipXidList.clear();
         dumpXidList.clear();
         brokenXidMapList.clear();
+    }
 
-        for (const auto& [_, data]: orphanedLobs)
-            delete[] data;
-        orphanedLobs.clear();
+    void TransactionBuffer::initialize(Metadata* newMetadata, Builder* newBuilder) {
+        metadata = newMetadata;
+        builder = newBuilder;
+
+        for (uint64_t i = 0; i < flushThreads; ++i) {
+            auto* flusher = new TransactionFlusher(ctx, alias + "-flusher-" + std::to_string(i), metadata, this, builder->newWorkerBuilder());
+            flushers.push_back(flusher);
+            ctx->spawnThread(flusher);
+        }
     }
 
     void TransactionBuffer::purge() {
@@ -51,6 +73,8 @@ namespace OpenLogReplicator {
             delete transaction;
         }
         xidTransactionMap.clear();
+
+        orphanedLobs.purge(ctx->parserThread);
     }
 
     Transaction* TransactionBuffer::findTransaction(XmlCtx* xmlCtx, Xid xid, typeConId conId, bool old, bool add, bool rollback) {
@@ -107,9 +131,7 @@ namespace OpenLogReplicator {
             auto lastSize = *reinterpret_cast<typeChunkSize*>(lastTc->buffer + lastTc->size - sizeof(typeChunkSize));
             const auto* const last501 = reinterpret_cast<const RedoLogRecord*>(lastTc->buffer + lastTc->size - lastSize + ROW_HEADER_DATA0);
 
-            const uint32_t mergeSize = last501->size + redoLogRecord->size;
-            transaction->mergeBuffer = new uint8_t[mergeSize];
-            mergeBlocks(transaction->mergeBuffer, redoLogRecord, last501);
+            mergeBlocks(redoLogRecord, last501);
             rollbackTransactionChunk(transaction);
         }
         transaction->lastSplit = (redoLogRecord->flg & (OpCode::FLG_MULTIBLOCKUNDOTAIL | OpCode::FLG_MULTIBLOCKUNDOMID)) != 0;
@@ -134,11 +156,6 @@ namespace OpenLogReplicator {
         lastTc->size += chunkSize;
         ++lastTc->elements;
         transaction->size += chunkSize;
-
-        if (transaction->mergeBuffer != nullptr) {
-            delete[] transaction->mergeBuffer;
-            transaction->mergeBuffer = nullptr;
-        }
     }
 
     void TransactionBuffer::addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2) {
@@ -160,9 +177,7 @@ namespace OpenLogReplicator {
             const auto lastSize = *reinterpret_cast<typeChunkSize*>(lastTc->buffer + lastTc->size - sizeof(typeChunkSize));
             const auto* last501 = reinterpret_cast<const RedoLogRecord*>(lastTc->buffer + lastTc->size - lastSize + ROW_HEADER_DATA0);
 
-            const uint32_t mergeSize = last501->size + redoLogRecord1->size;
-            transaction->mergeBuffer = new uint8_t[mergeSize];
-            mergeBlocks(transaction->mergeBuffer, redoLogRecord1, last501);
+            mergeBlocks(redoLogRecord1, last501);
 
             typePos fieldPos = redoLogRecord1->fieldPos;
             typeSize const fieldSize = ctx->read16(redoLogRecord1->data(redoLogRecord1->fieldSizesDelta + (1 * 2)));
@@ -202,11 +217,6 @@ namespace OpenLogReplicator {
         lastTc->size += chunkSize;
         ++lastTc->elements;
         transaction->size += chunkSize;
-
-        if (transaction->mergeBuffer != nullptr) {
-            delete[] transaction->mergeBuffer;
-            transaction->mergeBuffer = nullptr;
-        }
     }
 
     void TransactionBuffer::rollbackTransactionChunk(Transaction* transaction) {
@@ -216,6 +226,7 @@ namespace OpenLogReplicator {
         if (unlikely(lastTc->size < ROW_HEADER_TOTAL || lastTc->elements == 0))
             throw RedoLogException(50044, "trying to remove from empty buffer size: " + std::to_string(lastTc->size) +
                                           " elements: " + std::to_string(lastTc->elements));
+        transaction->rollbackStream(ctx);
 
         typeChunkSize const chunkSize = *reinterpret_cast<typeChunkSize*>(lastTc->buffer + lastTc->size - sizeof(typeChunkSize));
         lastTc->size -= chunkSize;
@@ -228,7 +239,13 @@ namespace OpenLogReplicator {
         transaction->lastTc = reinterpret_cast<TransactionChunk*>(ctx->swappedMemoryShrink(ctx->parserThread, transaction->xid));
     }
 
-    void TransactionBuffer::mergeBlocks(uint8_t* mergeBuffer, RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2) {
+    void TransactionBuffer::mergeBlocks(RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2) {
+        // The joined record is stored in a single chunk, so it can never exceed the chunk size
+        const uint64_t mergeSize = static_cast<uint64_t>(redoLogRecord1->size) + redoLogRecord2->size;
+        if (unlikely(mergeSize > TransactionChunk::DATA_BUFFER_SIZE))
+            throw RedoLogException(50040, "block size (" + std::to_string(mergeSize) + ") exceeding max block size (" +
+                                          std::to_string(TransactionChunk::DATA_BUFFER_SIZE) + "), please report this issue");
+
         memcpy(reinterpret_cast<void*>(mergeBuffer),
                reinterpret_cast<const void*>(redoLogRecord1->data()), redoLogRecord1->fieldSizesDelta);
         typePos pos = redoLogRecord1->fieldSizesDelta;
@@ -287,20 +304,122 @@ namespace OpenLogReplicator {
         }
     }
 
-    void TransactionBuffer::addOrphanedLob(RedoLogRecord* redoLogRecord1) {
-        if (unlikely(ctx->isTraceSet(Ctx::TRACE::LOB)))
-            ctx->logTrace(Ctx::TRACE::LOB, "id: " + redoLogRecord1->lobId.upper() + " page: " + std::to_string(redoLogRecord1->dba) +
-                                           " can't match, offset: " + redoLogRecord1->fileOffset.toString());
+    void TransactionBuffer::evictOrphanedLobs() {
+        orphanedLobs.evict(ctx->parserThread);
+    }
+
+    void TransactionBuffer::stream(Scn lwnScn, Seq sequence, time_t timestamp) {
+        const uint64_t streamTransactionMb = builder->getStreamTransactionMb();
+        if (streamTransactionMb == 0)
+            return;
 
-        const LobKey lobKey(redoLogRecord1->lobId, redoLogRecord1->dba);
+        for (const auto& [_, transaction] : xidTransactionMap) {
+            if (transaction->size < streamTransactionMb * Ctx::MEMORY_CHUNK_SIZE)
+                continue;
+            transaction->stream(metadata, builder, lwnScn, sequence, timestamp);
+        }
+    }
 
-        if (orphanedLobs.find(lobKey) != orphanedLobs.end()) {
-            ctx->warning(60009, "duplicate orphaned lob: " + redoLogRecord1->lobId.lower() + ", page: " +
-                                std::to_string(redoLogRecord1->dba));
+    void TransactionBuffer::flushTransaction(Transaction* transaction, Scn lwnScn) {
+        // Schema changes must be applied in commit order before any later transaction is built
+        if (flushers.empty() || transaction->system || transaction->schema) {
+            flushWait(ctx->parserThread);
+            transaction->flush(ctx->parserThread, metadata, builder, lwnScn);
+            transaction->purge(ctx);
+            delete transaction;
             return;
         }
 
-        orphanedLobs.insert_or_assign(lobKey, allocateLob(redoLogRecord1));
+        {
+            ctx->parserThread->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FLUSH);
+            std::unique_lock<std::mutex> const lck(flushMtx);
+            flushQueue.push_back({transaction, lwnScn, flushTicketNext++});
+            condFlush.notify_one();
+        }
+        ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void TransactionBuffer::flushWait(Thread* t) {
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FLUSH);
+            std::unique_lock<std::mutex> lck(flushMtx);
+            while (flushTicketPublished != flushTicketNext && !ctx->hardShutdown) {
+                if (unlikely(ctx->isTraceSet(Ctx::TRACE::SLEEP)))
+                    ctx->logTrace(Ctx::TRACE::SLEEP, "TransactionBuffer:flushWait");
+                t->contextSet(Thread::CONTEXT::WAIT, Thread::REASON::TRANSACTION_FLUSH_WAIT);
+                condPublished.wait(lck);
+                t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FLUSH);
+            }
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    bool TransactionBuffer::getFlushRequest(Thread* t, FlushRequest& request) {
+        t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FLUSH);
+        std::unique_lock<std::mutex> lck(flushMtx);
+        while (flushQueue.empty()) {
+            if (ctx->hardShutdown || ctx->replicatorFinished) {
+                t->contextSet(Thread::CONTEXT::CPU);
+                return false;
+            }
+
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::SLEEP)))
+                ctx->logTrace(Ctx::TRACE::SLEEP, "TransactionBuffer:getFlushRequest");
+            t->contextSet(Thread::CONTEXT::WAIT, Thread::REASON::TRANSACTION_FLUSHER_NO_WORK);
+            condFlush.wait(lck);
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FLUSH);
+        }
+
+        request = flushQueue.front();
+        flushQueue.pop_front();
+        t->contextSet(Thread::CONTEXT::CPU);
+        return true;
+    }
+
+    void TransactionBuffer::publishFlush(Thread* t, Builder* workerBuilder, const FlushRequest& request) {
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FLUSH);
+            std::unique_lock<std::mutex> lck(flushMtx);
+            while (flushTicketPublished != request.ticket) {
+                if (ctx->hardShutdown) {
+                    t->contextSet(Thread::CONTEXT::CPU);
+                    return;
+                }
+                t->contextSet(Thread::CONTEXT::WAIT, Thread::REASON::TRANSACTION_FLUSHER_PUBLISH);
+                condPublished.wait(lck);
+                t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FLUSH);
+            }
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+
+        // Only the owner of the current ticket reaches this point
+        builder->publish(t, workerBuilder);
+
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FLUSH);
+            std::unique_lock<std::mutex> const lck(flushMtx);
+            ++flushTicketPublished;
+            condPublished.notify_all();
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void TransactionBuffer::wakeUpFlush(Thread* t) {
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FLUSHER_WAKEUP);
+            std::unique_lock<std::mutex> const lck(flushMtx);
+            condFlush.notify_all();
+            condPublished.notify_all();
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void TransactionBuffer::addOrphanedLob(RedoLogRecord* redoLogRecord1) {
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::LOB)))
+            ctx->logTrace(Ctx::TRACE::LOB, "id: " + redoLogRecord1->lobId.upper() + " page: " + std::to_string(redoLogRecord1->dba) +
+                                           " can't match, offset: " + redoLogRecord1->fileOffset.toString());
+
+        orphanedLobs.add(ctx->parserThread, redoLogRecord1);
     }
 
     uint8_t* TransactionBuffer::allocateLob(const RedoLogRecord* redoLogRecord1) {
@@ -20,21 +20,29 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #ifndef TRANSACTION_BUFFER_H_
 #define TRANSACTION_BUFFER_H_
 
-#include <map>
+#include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <set>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "../common/Ctx.h"
-#include "../common/LobKey.h"
+#include "../common/OrphanedLobs.h"
 #include "../common/RedoLogRecord.h"
 #include "../common/types/FileOffset.h"
+#include "../common/types/Scn.h"
 #include "../common/types/Types.h"
 #include "../common/types/Seq.h"
 #include "../common/types/Xid.h"
 
 namespace OpenLogReplicator {
+    class Builder;
+    class Metadata;
+    class Thread;
     class Transaction;
+    class TransactionFlusher;
     class XmlCtx;
 
     struct TransactionChunk {
@@ -47,6 +55,12 @@ namespace OpenLogReplicator {
         uint8_t buffer[1];
     };
 
+    struct FlushRequest {
+        Transaction* transaction;
+        Scn lwnScn;
+        uint64_t ticket;
+    };
+
     class TransactionBuffer {
     public:
         static constexpr uint32_t ROW_HEADER_OP = 0;
@@ -54,14 +68,29 @@ namespace OpenLogReplicator {
         static constexpr uint32_t ROW_HEADER_DATA1 = sizeof(typeOp2) + sizeof(RedoLogRecord);
         static constexpr uint32_t ROW_HEADER_DATA2 = sizeof(typeOp2) + sizeof(RedoLogRecord) + sizeof(RedoLogRecord);
         static constexpr uint32_t ROW_HEADER_TOTAL = sizeof(typeOp2) + sizeof(RedoLogRecord) + sizeof(RedoLogRecord) + sizeof(typeChunkSize);
+        static constexpr uint64_t FLUSH_THREADS_MAX{16};
 
     protected:
         Ctx* ctx;
-        uint8_t buffer[TransactionChunk::DATA_BUFFER_SIZE]{};
+        std::string alias;
+        // Split undo records are joined here just before they are appended to the transaction, parser thread only
+        uint8_t mergeBuffer[TransactionChunk::DATA_BUFFER_SIZE]{};
 
         std::mutex mtx;
         std::unordered_map<XidMap, Transaction*> xidTransactionMap;
-        std::map<LobKey, uint8_t*> orphanedLobs;
+        OrphanedLobs orphanedLobs;
+
+        // Committed transactions are built in parallel and published in commit order
+        Metadata* metadata{nullptr};
+        Builder* builder{nullptr};
+        uint64_t flushThreads;
+        std::vector<TransactionFlusher*> flushers;
+        std::mutex flushMtx;
+        std::condition_variable condFlush;
+        std::condition_variable condPublished;
+        std::deque<FlushRequest> flushQueue;
+        uint64_t flushTicketNext{0};
+        uint64_t flushTicketPublished{0};
 
     public:
         std::set<Xid> skipXidList;
@@ -69,17 +98,25 @@ namespace OpenLogReplicator {
         std::set<XidMap> brokenXidMapList;
         std::string dumpPath;
 
-        explicit TransactionBuffer(Ctx* newCtx);
+        TransactionBuffer(Ctx* newCtx, std::string newAlias, uint64_t newFlushThreads);
         ~TransactionBuffer();
 
+        void initialize(Metadata* newMetadata, Builder* newBuilder);
         void purge();
         [[nodiscard]] Transaction* findTransaction(XmlCtx* xmlCtx, Xid xid, typeConId conId, bool old, bool add, bool rollback);
         void dropTransaction(Xid xid, typeConId conId);
         void addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord);
         void addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2);
         void rollbackTransactionChunk(Transaction* transaction);
-        void mergeBlocks(uint8_t* mergeBuffer, RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2);
+        void mergeBlocks(RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2);
         void checkpoint(Seq& minSequence, FileOffset& minFileOffset, Xid& minXid);
+        void evictOrphanedLobs();
+        void stream(Scn lwnScn, Seq sequence, time_t timestamp);
+        void flushTransaction(Transaction* transaction, Scn lwnScn);
+        void flushWait(Thread* t);
+        [[nodiscard]] bool getFlushRequest(Thread* t, FlushRequest& request);
+        void publishFlush(Thread* t, Builder* workerBuilder, const FlushRequest& request);
+        void wakeUpFlush(Thread* t);
         void addOrphanedLob(RedoLogRecord* redoLogRecord1);
         static uint8_t* allocateLob(const RedoLogRecord* redoLogRecord1);
     };
@@ -0,0 +1,82 @@
+/* Thread flushing committed transactions to a private builder
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+
+#include "../builder/Builder.h"
+#include "../common/exception/DataException.h"
+#include "../common/exception/RedoLogException.h"
+#include "../common/exception/RuntimeException.h"
+#include "../metadata/Metadata.h"
+#include "Transaction.h"
+#include "TransactionBuffer.h"
+#include "TransactionFlusher.h"
+
+namespace OpenLogReplicator {
+    TransactionFlusher::TransactionFlusher(Ctx* newCtx, std::string newAlias, Metadata* newMetadata, TransactionBuffer* newTransactionBuffer,
+                                           Builder* newBuilder) :
+            Thread(newCtx, std::move(newAlias)),
+            metadata(newMetadata),
+            transactionBuffer(newTransactionBuffer),
+            builder(newBuilder) {
+    }
+
+    TransactionFlusher::~TransactionFlusher() {
+        delete builder;
+        builder = nullptr;
+    }
+
+    void TransactionFlusher::wakeUp() {
+        transactionBuffer->wakeUpFlush(this);
+    }
+
+    void TransactionFlusher::run() {
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "transaction flusher (" + ss.str() + ") start");
+        }
+
+        try {
+            FlushRequest request{};
+            while (transactionBuffer->getFlushRequest(this, request)) {
+                request.transaction->flush(this, metadata, builder, request.lwnScn);
+                transactionBuffer->publishFlush(this, builder, request);
+
+                request.transaction->purge(ctx);
+                delete request.transaction;
+                request.transaction = nullptr;
+            }
+        } catch (DataException& ex) {
+            ctx->error(ex.code, ex.msg);
+            ctx->stopHard();
+        } catch (RedoLogException& ex) {
+            ctx->error(ex.code, ex.msg);
+            ctx->stopHard();
+        } catch (RuntimeException& ex) {
+            ctx->error(ex.code, ex.msg);
+            ctx->stopHard();
+        }
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "transaction flusher (" + ss.str() + ") stop");
+        }
+    }
+}
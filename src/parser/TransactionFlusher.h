@@ -0,0 +1,50 @@
+/* Header for TransactionFlusher class
+   Copyright (C) 2018-2025 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+
+#ifndef TRANSACTION_FLUSHER_H_
+#define TRANSACTION_FLUSHER_H_
+
+#include "../common/Thread.h"
+
+namespace OpenLogReplicator {
+    class Builder;
+    class Metadata;
+    class TransactionBuffer;
+
+    class TransactionFlusher final : public Thread {
+    protected:
+        Metadata* metadata;
+        TransactionBuffer* transactionBuffer;
+        Builder* builder;
+
+    public:
+        TransactionFlusher(Ctx* newCtx, std::string newAlias, Metadata* newMetadata, TransactionBuffer* newTransactionBuffer, Builder* newBuilder);
+        ~TransactionFlusher() override;
+
+        void wakeUp() override;
+        void run() override;
+
+        std::string getName() const override {
+            return {"TransactionFlusher"};
+        }
+    };
+}
+
+#endif
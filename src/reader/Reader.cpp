@@ -817,6 +817,7 @@ namespace OpenLogReplicator {
                             if (unlikely(ctx->isTraceSet(Ctx::TRACE::SLEEP)))
                                 ctx->logTrace(Ctx::TRACE::SLEEP, "Reader:mainLoop:bufferFull");
                             contextSet(CONTEXT::WAIT, REASON::READER_BUFFER_FULL);
+                            ++ctx->memoryReadBufferWaits;
                             condBufferFull.wait(lck);
                             contextSet(CONTEXT::CPU);
                             continue;
@@ -1011,7 +1012,12 @@ namespace OpenLogReplicator {
         {
             contextSet(CONTEXT::MUTEX, REASON::READER_CHECK_FREE);
             std::unique_lock<std::mutex> const lck(mtx);
-            isFree = (ctx->bufferSizeFree > 0);
+            // 读取缓冲区配额可能被内存调节线程调小
+            isFree = (ctx->memoryChunksReadBufferMax - ctx->bufferSizeFree < ctx->memoryChunksReadBufferQuota);
+            // The reader polls the quota, a wait is counted when it starts and not on every check
+            if (!isFree && !bufferQuotaWait)
+                ++ctx->memoryReadBufferWaits;
+            bufferQuotaWait = !isFree;
         }
         contextSet(CONTEXT::CPU);
         return isFree;
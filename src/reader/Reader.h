@@ -60,6 +60,7 @@ namespace OpenLogReplicator {
         bool configuredBlockSum;               // 是否配置块校验和
         bool readBlocks{false};                // 是否读取块
         bool reachedZero{false};               // 是否达到零点
+        bool bufferQuotaWait{false};           // 是否在等待读取缓冲区配额 - 每次等待只计数一次
         std::string fileNameWrite;             // 写入文件名
         int group;                             // 组号
         Seq sequence;                          // 序列号
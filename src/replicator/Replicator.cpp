@@ -167,6 +167,8 @@ namespace OpenLogReplicator {
         try {
             // 等待写入器就绪
             metadata->waitForWriter(ctx->parserThread);
+            // 启动并行事务刷新线程
+            transactionBuffer->initialize(metadata, builder);
 
             // 加载数据库元数据
             loadDatabaseMetadata();
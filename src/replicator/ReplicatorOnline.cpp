@@ -494,7 +494,8 @@ namespace OpenLogReplicator {
 
             for (const SchemaElement* element: metadata->schemaElements)
                 createSchemaForTable(metadata->firstDataScn, element->owner, element->table, element->keyList, element->key, element->tagType,
-                                     element->tagList, element->tag, element->condition, element->options, tablesUpdated);
+                                     element->tagList, element->tag, element->columnsType, element->columnsList, element->condition, element->options,
+                                     tablesUpdated);
             metadata->schema->resetTouched();
 
             if (unlikely(metadata->ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
@@ -1406,6 +1407,7 @@ namespace OpenLogReplicator {
 
     void ReplicatorOnline::createSchemaForTable(Scn targetScn, const std::string& owner, const std::string& table, const std::vector<std::string>& keyList,
                                                 const std::string& key, SchemaElement::TAG_TYPE tagType, const std::vector<std::string>& tagList, const std::string& tag,
+                                                SchemaElement::COLUMNS_TYPE columnsType, const std::vector<std::string>& columnsList,
                                                 const std::string& condition, DbTable::OPTIONS options, std::unordered_map<typeObj, std::string>& tablesUpdated) {
         if (unlikely(ctx->isTraceSet(Ctx::TRACE::REDO)))
             ctx->logTrace(Ctx::TRACE::REDO, "creating table schema for owner: " + owner + " table: " + table + " options: " +
@@ -1413,9 +1415,9 @@ namespace OpenLogReplicator {
 
         readSystemDictionaries(metadata->schema, targetScn, owner, table, options);
 
-        metadata->schema->buildMaps(owner, table, keyList, key, tagType, tagList, tag, condition, options, tablesUpdated, metadata->suppLogDbPrimary,
-                                    metadata->suppLogDbAll, metadata->defaultCharacterMapId,
-                                    metadata->defaultCharacterNcharMapId);
+        metadata->schema->buildMaps(owner, table, keyList, key, tagType, tagList, tag, columnsType, columnsList, condition, options, tablesUpdated,
+                                    metadata->suppLogDbPrimary, metadata->suppLogDbAll, metadata->defaultCharacterMapId,
+                                    metadata->defaultCharacterNcharMapId, false);
     }
 
     void ReplicatorOnline::updateOnlineRedoLogData() {
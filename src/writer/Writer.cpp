@@ -23,6 +23,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <unistd.h>
 
 #include "../builder/Builder.h"
+#include "../common/Compressor.h"
 #include "../common/Ctx.h"
 #include "../common/exception/DataException.h"
 #include "../common/exception/NetworkException.h"
@@ -44,6 +45,12 @@ namespace OpenLogReplicator {
     Writer::~Writer() {
         delete[] queue;
         queue = nullptr;
+        delete compressor;
+        compressor = nullptr;
+    }
+
+    void Writer::setCompressor(Compressor* newCompressor) {
+        compressor = newCompressor;
     }
 
     void Writer::initialize() {
@@ -27,6 +27,7 @@ namespace OpenLogReplicator {
     class Builder;
     class BuilderMsg;
     class BuilderQueue;
+    class Compressor;
     class Metadata;
 
     // 写入器基类 - 所有输出写入器的基础类
@@ -37,6 +38,7 @@ namespace OpenLogReplicator {
         std::string database;              // 数据库名称
         Builder* builder;                  // 构建器指针
         Metadata* metadata;                // 元数据指针
+        Compressor* compressor{nullptr};   // 消息压缩器（可选）
         
         // 本地检查点信息
         BuilderQueue* builderQueue{nullptr};  // 构建器队列
@@ -81,6 +83,7 @@ namespace OpenLogReplicator {
         void confirmMessage(BuilderMsg* msg);         // 确认消息
         void wakeUp() override;                       // 唤醒线程
         virtual void flush() {};                      // 刷新数据（可选实现）
+        void setCompressor(Compressor* newCompressor); // 设置消息压缩器
     };
 }
 
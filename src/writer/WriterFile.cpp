@@ -28,6 +28,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <unistd.h>
 
 #include "../builder/Builder.h"
+#include "../common/Compressor.h"
 #include "../common/exception/ConfigurationException.h"
 #include "../common/exception/RuntimeException.h"
 #include "../metadata/Metadata.h"
@@ -298,17 +299,35 @@ namespace OpenLogReplicator {
             contextSet(CONTEXT::CPU);
             if (lseekRet == -1)
                 throw RuntimeException(10011, "file: " + fullFileName + " - seek returned: " + strerror(errno));
+
+            // 新文件需要重新写入压缩字典
+            if (compressor != nullptr)
+                compressor->resetSent();
         }
     }
 
     // 发送消息 - 写入到文件
     void WriterFile::sendMessage(BuilderMsg* msg) {
-        // 先检查文件状态
-        checkFile(msg->scn, msg->sequence, msg->size + newLine);
-
-        // 写入消息内容
-        bufferedWrite(msg->data + msg->tagSize, msg->size - msg->tagSize);
-        fileSize += msg->size - msg->tagSize;
+        // 写入消息内容，启用压缩时先压缩，按压缩帧（含未写入的字典帧）大小检查文件状态
+        if (compressor != nullptr) {
+            uint64_t frameSize;
+            const uint8_t* frame = compressor->compressData(msg->obj, msg->data + msg->tagSize, msg->size - msg->tagSize, frameSize);
+            checkFile(msg->scn, msg->sequence, compressor->pendingDictionarySize(msg->obj) + frameSize + newLine);
+
+            // 轮换后的新文件也需要先写入字典帧
+            uint64_t dictionaryFrameSize;
+            const uint8_t* dictionaryFrame = compressor->dictionaryFrame(msg->obj, dictionaryFrameSize);
+            if (dictionaryFrame != nullptr) {
+                bufferedWrite(dictionaryFrame, dictionaryFrameSize);
+                fileSize += dictionaryFrameSize;
+            }
+            bufferedWrite(frame, frameSize);
+            fileSize += frameSize;
+        } else {
+            checkFile(msg->scn, msg->sequence, msg->size + newLine);
+            bufferedWrite(msg->data + msg->tagSize, msg->size - msg->tagSize);
+            fileSize += msg->size - msg->tagSize;
+        }
 
         // 添加换行符（如果配置了的话）
         if (newLine > 0) {
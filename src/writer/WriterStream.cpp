@@ -18,6 +18,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
 #include "../builder/Builder.h"
+#include "../common/Compressor.h"
 #include "../common/OraProtoBuf.pb.h"
 #include "../common/exception/NetworkException.h"
 #include "../metadata/Metadata.h"
@@ -156,6 +157,9 @@ namespace OpenLogReplicator {
 
             ctx->info(0, "streaming to client");
             streaming = true;
+            // 新客户端需要重新发送压缩字典
+            if (compressor != nullptr)
+                compressor->resetSent();
         } else {
             ctx->logTrace(Ctx::TRACE::WRITER, "starting failed");
             response.set_code(pb::ResponseCode::FAILED_START);
@@ -191,6 +195,8 @@ namespace OpenLogReplicator {
         response.set_code(pb::ResponseCode::REPLICATE);
         ctx->info(0, "streaming to client");
         streaming = true;
+        if (compressor != nullptr)
+            compressor->resetSent();
     }
 
     // 处理CONFIRM请求 - 确认客户端已接收消息
@@ -310,7 +316,14 @@ namespace OpenLogReplicator {
 
         if (success) {
             try {
-                stream->sendMessage(message.c_str(), message.length());
+                // 启用压缩时发送压缩帧
+                if (compressor != nullptr) {
+                    uint64_t frameSize;
+                    const uint8_t* frame = compressor->compress(msg->obj, reinterpret_cast<const uint8_t*>(message.c_str()), message.length(),
+                                                                frameSize);
+                    stream->sendMessage(reinterpret_cast<const char*>(frame), frameSize);
+                } else
+                    stream->sendMessage(message.c_str(), message.length());
             } catch (NetworkException& ex) {
                 ctx->error(ex.code, ex.msg);
                 streaming = false;